@@ -1,6 +1,7 @@
 #pragma once
 #include "../iterator/iterator.hpp"
 #include <type_traits>
+#include <cstring>
 
 namespace zstl
 {
@@ -27,25 +28,27 @@ namespace zstl
         b = std::move(tmp);
     }
 
-    // 填充函数
     template <typename ForwardIt, typename T>
-    void fill(ForwardIt first, ForwardIt last, const T &value)
-    {
-        for (; first != last; ++first)
-        {
-            *first = value;
-        }
-    }
+    void fill(ForwardIt first, ForwardIt last, const T &value);
 
     // 填充函数
     template <typename OutputIt, typename Size, typename T>
     OutputIt fill_n(OutputIt first, Size n, const T &value)
     {
-        for (size_t i = 0; i < n; ++i)
+        if constexpr (is_segmented_iterator_v<OutputIt>)
         {
-            *first++ = value;
+            OutputIt last = first + n;
+            zstl::fill(first, last, value);
+            return last;
+        }
+        else
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                *first++ = value;
+            }
+            return first;
         }
-        return first;
     }
 
     // 优化：对 trivial 类型使用 memset
@@ -62,11 +65,60 @@ namespace zstl
         return first + n;
     }
 
+    // 填充函数：分段迭代器逐段处理，指针区间交给 fill_n（单字节类型走 memset）
+    template <typename ForwardIt, typename T>
+    void fill(ForwardIt first, ForwardIt last, const T &value)
+    {
+        if constexpr (is_segmented_iterator_v<ForwardIt>)
+        {
+            for_each_segment(first, last, [&](auto b, auto e)
+                             { zstl::fill(b, e, value); });
+        }
+        else if constexpr (std::is_pointer_v<ForwardIt>)
+        {
+            zstl::fill_n(first, last - first, value);
+        }
+        else
+        {
+            for (; first != last; ++first)
+            {
+                *first = value;
+            }
+        }
+    }
+
     // 功能：拷贝范围内的元素到目标位置
     template <typename InputIt, typename OutputIt>
     OutputIt copy(InputIt first, InputIt last, OutputIt dest)
     {
-        if constexpr (is_random_access_iterator_v<InputIt>)
+        using in_value = std::remove_cv_t<typename iterator_traits<InputIt>::value_type>;
+        if constexpr (is_segmented_iterator_v<InputIt>)
+        {
+            // 源为分段迭代器：逐段按指针区间拷贝
+            for_each_segment(first, last, [&](auto b, auto e)
+                             { dest = zstl::copy(b, e, dest); });
+            return dest;
+        }
+        else if constexpr (is_segmented_iterator_v<OutputIt> && is_random_access_iterator_v<InputIt>)
+        {
+            // 目标为分段迭代器：先由目标迭代器自身算出尾后位置，再逐段拷贝，
+            // 遍历止于尾后位置所在的段，不会越过最后一段去访问中控数组
+            OutputIt dest_last = dest + (last - first);
+            for_each_segment(dest, dest_last, [&](auto b, auto e)
+                             { zstl::copy(first, first + (e - b), b); first += e - b; });
+            return dest_last;
+        }
+        else if constexpr (std::is_pointer_v<InputIt> && std::is_pointer_v<OutputIt> &&
+                           std::is_same_v<in_value, std::remove_pointer_t<OutputIt>> &&
+                           std::is_trivially_copyable_v<in_value>)
+        {
+            // 同类型指针区间：等价于 memmove
+            const auto n = static_cast<size_t>(last - first);
+            if (n)
+                std::memmove(dest, first, n * sizeof(in_value));
+            return dest + n;
+        }
+        else if constexpr (is_random_access_iterator_v<InputIt>)
         {
             auto n = last - first;
             for (size_t i = 0; i < n; ++i)
@@ -179,9 +231,17 @@ namespace zstl
     typename iterator_traits<InputIter>::difference_type count(InputIter first, InputIter last, const T &value)
     {
         typename iterator_traits<InputIter>::difference_type n = 0;
-        for (; first != last; ++first)
-            if (*first == value)
-                ++n;
+        if constexpr (is_segmented_iterator_v<InputIter>)
+        {
+            for_each_segment(first, last, [&](auto b, auto e)
+                             { n += zstl::count(b, e, value); });
+        }
+        else
+        {
+            for (; first != last; ++first)
+                if (*first == value)
+                    ++n;
+        }
         return n;
     }
 
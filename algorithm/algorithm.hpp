@@ -2,3 +2,4 @@
 #include "algo.hpp"
 #include "heap_algo.hpp"
 #include "set_algo.hpp"
+#include "string_search.hpp"
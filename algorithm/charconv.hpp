@@ -0,0 +1,908 @@
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+#include "pow10_table.hpp"
+namespace zstl
+{
+    // 与 std::to_chars / std::from_chars 相同的返回约定：ec 为 errc{} 表示成功
+    struct to_chars_result
+    {
+        char *ptr;
+        std::errc ec;
+    };
+
+    struct from_chars_result
+    {
+        const char *ptr;
+        std::errc ec;
+    };
+
+    /* 整数 */
+
+    // "00" ~ "99" 的两位数字表，整数格式化每次除以 100 写出两位
+    struct DigitPairTable
+    {
+        char pairs_[200];
+
+        constexpr DigitPairTable() : pairs_()
+        {
+            for (int i = 0; i < 100; ++i)
+            {
+                pairs_[2 * i] = static_cast<char>('0' + i / 10);
+                pairs_[2 * i + 1] = static_cast<char>('0' + i % 10);
+            }
+        }
+    };
+    inline constexpr DigitPairTable DIGIT_PAIRS{};
+
+    // 十进制位数
+    inline int decimal_length(uint64_t v) noexcept
+    {
+        int n = 1;
+        for (;;)
+        {
+            if (v < 10)
+                return n;
+            if (v < 100)
+                return n + 1;
+            if (v < 1000)
+                return n + 2;
+            if (v < 10000)
+                return n + 3;
+            v /= 10000;
+            n += 4;
+        }
+    }
+
+    // 从 end 向前写出 v 的十进制数字，调用方保证空间足够
+    inline void write_decimal(char *end, uint64_t v) noexcept
+    {
+        while (v >= 100)
+        {
+            uint64_t r = v % 100;
+            v /= 100;
+            end -= 2;
+            std::memcpy(end, DIGIT_PAIRS.pairs_ + 2 * r, 2);
+        }
+        if (v >= 10)
+            std::memcpy(end - 2, DIGIT_PAIRS.pairs_ + 2 * v, 2);
+        else
+            end[-1] = static_cast<char>('0' + v);
+    }
+
+    template <typename T>
+    inline constexpr bool is_charconv_integer_v = std::is_integral_v<T> && !std::is_same_v<T, bool>;
+
+    // 字符对应的数值，非数字 / 字母返回 255
+    inline unsigned char_digit_value(char c) noexcept
+    {
+        if (c >= '0' && c <= '9')
+            return static_cast<unsigned>(c - '0');
+        if (c >= 'a' && c <= 'z')
+            return static_cast<unsigned>(c - 'a' + 10);
+        if (c >= 'A' && c <= 'Z')
+            return static_cast<unsigned>(c - 'A' + 10);
+        return 255;
+    }
+
+    /**
+     * 整数格式化：十进制先算出位数，再从末尾按两位一组写出，不经过中间缓冲区
+     * 其他进制（2 ~ 36，小写字母）逐位写出；空间不足时返回 {last, value_too_large}
+     */
+    template <typename T, typename = std::enable_if_t<is_charconv_integer_v<T>>>
+    to_chars_result to_chars(char *first, char *last, T value, int base = 10)
+    {
+        assert(base >= 2 && base <= 36);
+        using U = std::make_unsigned_t<T>;
+        U u = static_cast<U>(value);
+        if constexpr (std::is_signed_v<T>)
+        {
+            if (value < 0)
+            {
+                if (first == last)
+                    return {last, std::errc::value_too_large};
+                *first++ = '-';
+                u = static_cast<U>(U(0) - u);
+            }
+        }
+        if (base == 10)
+        {
+            int n = decimal_length(u);
+            if (last - first < n)
+                return {last, std::errc::value_too_large};
+            write_decimal(first + n, u);
+            return {first + n, std::errc()};
+        }
+        char buf[std::numeric_limits<U>::digits];
+        char *p = buf + sizeof(buf);
+        do
+        {
+            *--p = "0123456789abcdefghijklmnopqrstuvwxyz"[u % static_cast<unsigned>(base)];
+            u = static_cast<U>(u / static_cast<unsigned>(base));
+        } while (u);
+        ptrdiff_t n = buf + sizeof(buf) - p;
+        if (last - first < n)
+            return {last, std::errc::value_too_large};
+        std::memcpy(first, p, static_cast<size_t>(n));
+        return {first + n, std::errc()};
+    }
+
+    /**
+     * 整数解析：可选的 '-'（仅有符号类型），随后为 base 进制数字
+     * 十进制下前 digits10 位不可能溢出，不做检查；之后逐位检查
+     * 无数字时返回 {first, invalid_argument}；溢出时跳过全部数字并返回 result_out_of_range，value 不变
+     */
+    template <typename T, typename = std::enable_if_t<is_charconv_integer_v<T>>>
+    from_chars_result from_chars(const char *first, const char *last, T &value, int base = 10)
+    {
+        assert(base >= 2 && base <= 36);
+        using U = std::make_unsigned_t<T>;
+        const char *p = first;
+        bool neg = false;
+        if constexpr (std::is_signed_v<T>)
+        {
+            if (p != last && *p == '-')
+            {
+                neg = true;
+                ++p;
+            }
+        }
+        const char *digits = p;
+        U v = 0;
+        if (base == 10)
+        {
+            const char *fast_end = last - p > std::numeric_limits<U>::digits10 ? p + std::numeric_limits<U>::digits10 : last;
+            for (; p != fast_end && static_cast<unsigned>(*p - '0') < 10; ++p)
+                v = static_cast<U>(v * 10 + static_cast<unsigned>(*p - '0'));
+        }
+        const U max_div = static_cast<U>(std::numeric_limits<U>::max() / static_cast<unsigned>(base));
+        const unsigned max_mod = static_cast<unsigned>(std::numeric_limits<U>::max() % static_cast<unsigned>(base));
+        bool overflow = false;
+        for (; p != last; ++p)
+        {
+            unsigned d = char_digit_value(*p);
+            if (d >= static_cast<unsigned>(base))
+                break;
+            if (v > max_div || (v == max_div && d > max_mod))
+                overflow = true;
+            else if (!overflow)
+                v = static_cast<U>(v * static_cast<unsigned>(base) + d);
+        }
+        if (p == digits)
+            return {first, std::errc::invalid_argument};
+        if (overflow)
+            return {p, std::errc::result_out_of_range};
+        if constexpr (std::is_signed_v<T>)
+        {
+            U max_mag = static_cast<U>(std::numeric_limits<T>::max()) + U(neg);
+            if (v > max_mag)
+                return {p, std::errc::result_out_of_range};
+            value = static_cast<T>(neg ? U(0) - v : v);
+        }
+        else
+            value = v;
+        return {p, std::errc()};
+    }
+
+    /* 浮点：公共部分 */
+
+    // IEEE 754 二进制格式参数，以及解析时用到的十进制范围（取自 Eisel-Lemire 算法的推导）
+    template <typename F>
+    struct FloatFormat;
+
+    template <>
+    struct FloatFormat<double>
+    {
+        using bits_type = uint64_t;
+        static constexpr int SIG_BITS = 52;           // 显式尾数位数
+        static constexpr int EXP_BITS = 11;           // 指数位数
+        static constexpr int BIAS = 1075;             // 指数偏移 + 尾数位数：值 = c * 2^(e - BIAS)
+        static constexpr int MIN_EXPONENT = -1023;    // 最小二进制指数（减去偏移后）
+        static constexpr int INF_POWER = 0x7FF;       // 无穷的指数字段
+        static constexpr int SMALLEST_POW10 = -342;   // 更小的十进制指数必为 0
+        static constexpr int LARGEST_POW10 = 308;     // 更大的十进制指数必为无穷
+        static constexpr int MIN_ROUND_TO_EVEN = -4;  // 乘积可能恰为中点的十进制指数范围
+        static constexpr int MAX_ROUND_TO_EVEN = 23;
+        static constexpr int MAX_EXACT_POW10 = 22;    // 10^k 可精确表示的最大 k
+        static constexpr int MAX_DIGITS = 17;         // 最短表示的最大位数
+    };
+
+    template <>
+    struct FloatFormat<float>
+    {
+        using bits_type = uint32_t;
+        static constexpr int SIG_BITS = 23;
+        static constexpr int EXP_BITS = 8;
+        static constexpr int BIAS = 150;
+        static constexpr int MIN_EXPONENT = -127;
+        static constexpr int INF_POWER = 0xFF;
+        static constexpr int SMALLEST_POW10 = -64;
+        static constexpr int LARGEST_POW10 = 38;
+        static constexpr int MIN_ROUND_TO_EVEN = -17;
+        static constexpr int MAX_ROUND_TO_EVEN = 10;
+        static constexpr int MAX_EXACT_POW10 = 10;
+        static constexpr int MAX_DIGITS = 9;
+    };
+
+    // 64 x 64 -> 128 位乘法
+    inline Uint128Parts mul_128(uint64_t a, uint64_t b) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 p = static_cast<unsigned __int128>(a) * b;
+        return {static_cast<uint64_t>(p >> 64), static_cast<uint64_t>(p)};
+#else
+        uint64_t a0 = a & 0xFFFFFFFFu, a1 = a >> 32, b0 = b & 0xFFFFFFFFu, b1 = b >> 32;
+        uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+        uint64_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFFu) + (p10 & 0xFFFFFFFFu);
+        return {p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32), (mid << 32) | (p00 & 0xFFFFFFFFu)};
+#endif
+    }
+
+    inline int count_leading_zeros(uint64_t v) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_clzll(v);
+#else
+        int n = 0;
+        for (uint64_t bit = uint64_t(1) << 63; !(v & bit); bit >>= 1)
+            ++n;
+        return n;
+#endif
+    }
+
+    inline Uint128Parts pow10_significand(int k) noexcept
+    {
+        assert(k >= POW10_TABLE_MIN && k <= POW10_TABLE_MAX);
+        return POW10_SIGNIFICANDS[k - POW10_TABLE_MIN];
+    }
+
+    /* 浮点格式化：Schubfach 算法求最短且能往返的十进制表示 */
+
+    // 十进制结果：值 = digits_ * 10^exponent_
+    struct DecimalFloat
+    {
+        uint64_t digits_;
+        int exponent_;
+    };
+
+    // floor(log10(2^e))、floor(log10(3/4 * 2^e))、floor(log2(10^e))，在所需范围内精确
+    inline int floor_log10_pow2(int e) noexcept { return (e * 1262611) >> 22; }
+    inline int floor_log10_three_quarters_pow2(int e) noexcept { return (e * 1262611 - 524031) >> 22; }
+    inline int floor_log2_pow10(int e) noexcept { return (e * 1741647) >> 19; }
+
+    // floor(g * cp / 2^128) 并把被截掉的非零部分记入最低位（向奇数舍入）
+    inline uint64_t round_to_odd(Uint128Parts g, uint64_t cp) noexcept
+    {
+        Uint128Parts x = mul_128(g.lo_, cp);
+        Uint128Parts y = mul_128(g.hi_, cp);
+        uint64_t z = y.lo_ + x.hi_;
+        uint64_t vb = y.hi_ + (z < y.lo_);
+        return vb | (z > 1);
+    }
+
+    /**
+     * Schubfach（R. Giulietti）：取 10 的幂使舍入区间内最多含一个 10 倍数的候选，
+     * 三个边界各做一次 128 位乘法即可确定最短位数；位数相同时取最接近的值，中点向偶数舍入
+     * 表中为 floor(10^k 规格化)，此处用其加一作为上界近似
+     */
+    template <typename F>
+    DecimalFloat shortest_decimal(uint64_t ieee_sig, int ieee_exp) noexcept
+    {
+        using Fmt = FloatFormat<F>;
+        uint64_t c;
+        int q;
+        if (ieee_exp != 0)
+        {
+            c = (uint64_t(1) << Fmt::SIG_BITS) | ieee_sig;
+            q = ieee_exp - Fmt::BIAS;
+            // 小整数直接返回
+            if (0 <= -q && -q <= Fmt::SIG_BITS && (c & ((uint64_t(1) << -q) - 1)) == 0)
+                return {c >> -q, 0};
+        }
+        else
+        {
+            c = ieee_sig;
+            q = 1 - Fmt::BIAS;
+        }
+
+        bool is_even = (c % 2 == 0);
+        bool lower_closer = (ieee_sig == 0 && ieee_exp > 1); // 2 的幂：下侧间距只有上侧的一半
+        uint64_t cbl = 4 * c - 2 + lower_closer;
+        uint64_t cb = 4 * c;
+        uint64_t cbr = 4 * c + 2;
+
+        int k = lower_closer ? floor_log10_three_quarters_pow2(q) : floor_log10_pow2(q);
+        int h = q + floor_log2_pow10(-k) + 1;
+        Uint128Parts g = pow10_significand(-k);
+        g.lo_ += 1;
+        g.hi_ += (g.lo_ == 0);
+
+        uint64_t vbl = round_to_odd(g, cbl << h);
+        uint64_t vb = round_to_odd(g, cb << h);
+        uint64_t vbr = round_to_odd(g, cbr << h);
+        uint64_t lower = vbl + !is_even;
+        uint64_t upper = vbr - !is_even;
+
+        uint64_t s = vb / 4;
+        if (s >= 10)
+        {
+            uint64_t sp = s / 10;
+            bool up_inside = lower <= 40 * sp;
+            bool wp_inside = 40 * sp + 40 <= upper;
+            if (up_inside != wp_inside)
+                return {sp + wp_inside, k + 1};
+        }
+        bool u_inside = lower <= 4 * s;
+        bool w_inside = 4 * s + 4 <= upper;
+        if (u_inside != w_inside)
+            return {s + w_inside, k};
+        uint64_t mid = 4 * s + 2;
+        bool round_up = vb > mid || (vb == mid && (s & 1) != 0);
+        return {s + round_up, k};
+    }
+
+    // 写出 c * 2^q（q > 0，结果小于 10^38）的全部十进制数字
+    inline char *write_exact_integer(char *p, uint64_t c, int q) noexcept
+    {
+        Uint128Parts v{q >= 64 ? c << (q - 64) : (q > 0 ? c >> (64 - q) : 0), q >= 64 ? 0 : c << q};
+        if (v.hi_ == 0)
+        {
+            int n = decimal_length(v.lo_);
+            write_decimal(p + n, v.lo_);
+            return p + n;
+        }
+        // 按 10^9 分段：逐 32 位长除，余数即低 9 位
+        uint32_t words[4] = {static_cast<uint32_t>(v.hi_ >> 32), static_cast<uint32_t>(v.hi_),
+                             static_cast<uint32_t>(v.lo_ >> 32), static_cast<uint32_t>(v.lo_)};
+        uint32_t parts[5];
+        int count = 0;
+        while (words[0] | words[1] | words[2] | words[3])
+        {
+            uint64_t rem = 0;
+            for (uint32_t &w : words)
+            {
+                uint64_t cur = (rem << 32) | w;
+                w = static_cast<uint32_t>(cur / 1000000000u);
+                rem = cur % 1000000000u;
+            }
+            parts[count++] = static_cast<uint32_t>(rem);
+        }
+        int n = decimal_length(parts[--count]);
+        write_decimal(p + n, parts[count]);
+        p += n;
+        while (count > 0)
+        {
+            std::memset(p, '0', 9);
+            if (parts[--count])
+                write_decimal(p + 9, parts[count]);
+            p += 9;
+        }
+        return p;
+    }
+
+    /**
+     * 把 digits * 10^exp 写成与 std::to_chars(value) 相同的形式：
+     * 在定点（f）与科学计数（e，指数至少两位）中取较短者，等长时取定点
+     * 定点形式带末尾补零时改写原值 c * 2^q 的精确整数，与标准库“等长时取最接近原值”一致
+     */
+    inline char *format_shortest(char *p, uint64_t digits, int exp, uint64_t c, int q) noexcept
+    {
+        while (digits % 10 == 0)
+        {
+            digits /= 10;
+            ++exp;
+        }
+        int n = decimal_length(digits);
+        int sci_exp = exp + n - 1;
+        int abs_sci = sci_exp < 0 ? -sci_exp : sci_exp;
+        int sci_len = n + (n > 1) + 2 + (abs_sci >= 100 ? 3 : 2);
+        int fixed_len = exp >= 0 ? n + exp : (n + exp > 0 ? n + 1 : 2 - exp);
+
+        if (fixed_len <= sci_len)
+        {
+            if (exp > 0 && q > 0)
+                return write_exact_integer(p, c, q);
+            if (exp >= 0)
+            {
+                write_decimal(p + n, digits);
+                std::memset(p + n, '0', static_cast<size_t>(exp));
+                return p + n + exp;
+            }
+            int int_len = n + exp;
+            if (int_len > 0)
+            {
+                write_decimal(p + n + 1, digits);
+                std::memmove(p, p + 1, static_cast<size_t>(int_len));
+                p[int_len] = '.';
+                return p + n + 1;
+            }
+            p[0] = '0';
+            p[1] = '.';
+            std::memset(p + 2, '0', static_cast<size_t>(-int_len));
+            write_decimal(p + fixed_len, digits);
+            return p + fixed_len;
+        }
+
+        write_decimal(p + 1 + n, digits);
+        p[0] = p[1];
+        char *out = p + 1;
+        if (n > 1)
+        {
+            p[1] = '.';
+            out = p + n + 1;
+        }
+        *out++ = 'e';
+        *out++ = sci_exp < 0 ? '-' : '+';
+        if (abs_sci >= 100)
+        {
+            *out++ = static_cast<char>('0' + abs_sci / 100);
+            abs_sci %= 100;
+        }
+        std::memcpy(out, DIGIT_PAIRS.pairs_ + 2 * abs_sci, 2);
+        return out + 2;
+    }
+
+    template <typename F>
+    to_chars_result float_to_chars(char *first, char *last, F value) noexcept
+    {
+        using Fmt = FloatFormat<F>;
+        using Bits = typename Fmt::bits_type;
+        Bits bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        uint64_t sig = bits & ((Bits(1) << Fmt::SIG_BITS) - 1);
+        int exp = static_cast<int>((bits >> Fmt::SIG_BITS) & ((Bits(1) << Fmt::EXP_BITS) - 1));
+
+        char buf[32]; // 最长为负号 + 定点 / 科学计数形式，不超过 26 个字符
+        char *p = buf;
+        if (bits >> (Fmt::SIG_BITS + Fmt::EXP_BITS))
+            *p++ = '-';
+        if (exp == Fmt::INF_POWER)
+        {
+            std::memcpy(p, sig ? "nan" : "inf", 3);
+            p += 3;
+        }
+        else if (exp == 0 && sig == 0)
+            *p++ = '0';
+        else
+        {
+            DecimalFloat d = shortest_decimal<F>(sig, exp);
+            uint64_t c = exp ? (uint64_t(1) << Fmt::SIG_BITS) | sig : sig;
+            p = format_shortest(p, d.digits_, d.exponent_, c, (exp ? exp : 1) - Fmt::BIAS);
+        }
+        ptrdiff_t n = p - buf;
+        if (last - first < n)
+            return {last, std::errc::value_too_large};
+        std::memcpy(first, buf, static_cast<size_t>(n));
+        return {first + n, std::errc()};
+    }
+
+    // 最短往返表示：按原值解析能得到同一个浮点数的最少位数
+    inline to_chars_result to_chars(char *first, char *last, double value) noexcept
+    {
+        return float_to_chars(first, last, value);
+    }
+    inline to_chars_result to_chars(char *first, char *last, float value) noexcept
+    {
+        return float_to_chars(first, last, value);
+    }
+
+    /* 浮点解析：Clinger 快速路径 + Eisel-Lemire，超过 19 位有效数字且无法判定时用大整数精确比较 */
+
+    inline constexpr double EXACT_POW10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                             1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    inline constexpr int DECIMAL_FAST_DIGITS = 19;  // 可无损放入 uint64_t 的有效数字位数
+    inline constexpr int DECIMAL_MAX_DIGITS = 768;  // 精确比较使用的最多有效数字，其余只记是否非零
+    inline constexpr int BIGINT_LIMBS = 320;        // 精确比较所需的 32 位字数上限
+
+    // 二进制结果：尾数字段与指数字段（已加偏移，0 表示非规格化数 / 零）
+    struct BinaryFloat
+    {
+        uint64_t mantissa_;
+        int power2_;
+    };
+
+    /**
+     * Eisel-Lemire：w * 10^q 的正确舍入（w 为精确的十进制有效数字）
+     * 与表中 10^q 的 128 位近似相乘，高位即为结果；截断误差不影响舍入（Mushtak & Lemire 的证明）
+     * 表项在 -27 <= q < 0 时取上界（floor + 1），与该证明使用的表一致
+     */
+    template <typename F>
+    BinaryFloat eisel_lemire(int64_t q, uint64_t w) noexcept
+    {
+        using Fmt = FloatFormat<F>;
+        if (w == 0 || q < Fmt::SMALLEST_POW10)
+            return {0, 0};
+        if (q > Fmt::LARGEST_POW10)
+            return {0, Fmt::INF_POWER};
+        int lz = count_leading_zeros(w);
+        w <<= lz;
+
+        Uint128Parts t = pow10_significand(static_cast<int>(q));
+        if (q >= -27 && q < 0)
+        {
+            t.lo_ += 1;
+            t.hi_ += (t.lo_ == 0);
+        }
+        const uint64_t precision_mask = ~uint64_t(0) >> (Fmt::SIG_BITS + 3);
+        Uint128Parts product = mul_128(w, t.hi_);
+        if ((product.hi_ & precision_mask) == precision_mask)
+        {
+            Uint128Parts second = mul_128(w, t.lo_);
+            product.lo_ += second.hi_;
+            if (second.hi_ > product.lo_)
+                ++product.hi_;
+        }
+
+        int upperbit = static_cast<int>(product.hi_ >> 63);
+        int shift = upperbit + 64 - Fmt::SIG_BITS - 3;
+        uint64_t mantissa = product.hi_ >> shift;
+        int power2 = static_cast<int>((((152170 + 65536) * q) >> 16) + 63) + upperbit - lz - Fmt::MIN_EXPONENT;
+
+        if (power2 <= 0) // 非规格化数
+        {
+            if (-power2 + 1 >= 64)
+                return {0, 0};
+            mantissa >>= -power2 + 1;
+            mantissa += (mantissa & 1);
+            mantissa >>= 1;
+            return {mantissa, mantissa < (uint64_t(1) << Fmt::SIG_BITS) ? 0 : 1};
+        }
+        // 乘积恰为中点时向偶数舍入
+        if (product.lo_ <= 1 && q >= Fmt::MIN_ROUND_TO_EVEN && q <= Fmt::MAX_ROUND_TO_EVEN && (mantissa & 3) == 1)
+        {
+            if ((mantissa << shift) == product.hi_)
+                mantissa &= ~uint64_t(1);
+        }
+        mantissa += (mantissa & 1);
+        mantissa >>= 1;
+        if (mantissa >= (uint64_t(2) << Fmt::SIG_BITS))
+        {
+            mantissa = uint64_t(1) << Fmt::SIG_BITS;
+            ++power2;
+        }
+        if (power2 >= Fmt::INF_POWER)
+            return {0, Fmt::INF_POWER};
+        return {mantissa, power2};
+    }
+
+    // 精确比较用的定长大整数（小端 32 位字）
+    class BigDecimalInt
+    {
+    public:
+        BigDecimalInt() noexcept : size_(0) {}
+        explicit BigDecimalInt(uint64_t v) noexcept : size_(0)
+        {
+            while (v)
+            {
+                limbs_[size_++] = static_cast<uint32_t>(v);
+                v >>= 32;
+            }
+        }
+
+        // *this = *this * m + a
+        void mul_add(uint32_t m, uint32_t a) noexcept
+        {
+            uint64_t carry = a;
+            for (int i = 0; i < size_; ++i)
+            {
+                uint64_t t = static_cast<uint64_t>(limbs_[i]) * m + carry;
+                limbs_[i] = static_cast<uint32_t>(t);
+                carry = t >> 32;
+            }
+            if (carry)
+                push(static_cast<uint32_t>(carry));
+        }
+
+        void mul_pow5(int64_t n) noexcept
+        {
+            for (; n >= 13; n -= 13)
+                mul_add(1220703125u, 0); // 5^13
+            uint32_t m = 1;
+            for (; n > 0; --n)
+                m *= 5;
+            if (m != 1)
+                mul_add(m, 0);
+        }
+
+        void shift_left(int64_t n) noexcept
+        {
+            if (size_ == 0 || n == 0)
+                return;
+            int words = static_cast<int>(n / 32), bits = static_cast<int>(n % 32);
+            assert(size_ + words + 1 <= BIGINT_LIMBS);
+            if (bits)
+            {
+                uint32_t carry = 0;
+                for (int i = 0; i < size_; ++i)
+                {
+                    uint32_t v = limbs_[i];
+                    limbs_[i] = (v << bits) | carry;
+                    carry = v >> (32 - bits);
+                }
+                if (carry)
+                    push(carry);
+            }
+            if (words)
+            {
+                std::memmove(limbs_ + words, limbs_, sizeof(uint32_t) * size_);
+                std::memset(limbs_, 0, sizeof(uint32_t) * words);
+                size_ += words;
+            }
+        }
+
+        friend int compare(const BigDecimalInt &a, const BigDecimalInt &b) noexcept
+        {
+            if (a.size_ != b.size_)
+                return a.size_ < b.size_ ? -1 : 1;
+            for (int i = a.size_ - 1; i >= 0; --i)
+                if (a.limbs_[i] != b.limbs_[i])
+                    return a.limbs_[i] < b.limbs_[i] ? -1 : 1;
+            return 0;
+        }
+
+    private:
+        void push(uint32_t v) noexcept
+        {
+            assert(size_ < BIGINT_LIMBS);
+            limbs_[size_++] = v;
+        }
+
+        uint32_t limbs_[BIGINT_LIMBS];
+        int size_; // 有效字数，零为 0
+    };
+
+    // 解析出的十进制数：前 19 位有效数字 w、w 对应的十进制指数 q，以及数字区间供精确路径重新扫描
+    struct DecimalParse
+    {
+        uint64_t w_;
+        int64_t q_;
+        bool truncated_; // 超过 19 位的部分是否有非零数字
+        const char *int_first_, *int_last_;
+        const char *frac_first_, *frac_last_;
+        int64_t exp10_;  // 显式指数
+    };
+
+    /**
+     * 候选值 b = r(w * 10^q)（w 截断时真值在 b 与其后继之间）：
+     * 用全部有效数字 D * 10^Q 与 b 和后继的中点 (2m + 1) * 2^(e - 1) 做大整数比较，决定是否进位
+     */
+    template <typename F>
+    BinaryFloat decimal_slow_path(const DecimalParse &d, BinaryFloat b) noexcept
+    {
+        using Fmt = FloatFormat<F>;
+        BigDecimalInt digits;
+        int64_t q = d.exp10_;
+        int count = 0;
+        bool sticky = false, started = false;
+        auto feed = [&](const char *first, const char *last, bool frac)
+        {
+            for (const char *p = first; p != last; ++p)
+            {
+                unsigned v = static_cast<unsigned>(*p - '0');
+                if (!started && v == 0)
+                {
+                    q -= frac;
+                    continue;
+                }
+                started = true;
+                if (count < DECIMAL_MAX_DIGITS)
+                {
+                    digits.mul_add(10, v);
+                    ++count;
+                    q -= frac;
+                }
+                else
+                {
+                    sticky |= v != 0;
+                    q += !frac;
+                }
+            }
+        };
+        feed(d.int_first_, d.int_last_, false);
+        feed(d.frac_first_, d.frac_last_, true);
+
+        // b = m * 2^e，中点 = (2m + 1) * 2^(e - 1)
+        uint64_t m = b.mantissa_;
+        int e;
+        if (b.power2_ == 0)
+            e = 1 - Fmt::BIAS;
+        else
+        {
+            m |= uint64_t(1) << Fmt::SIG_BITS;
+            e = b.power2_ - Fmt::BIAS;
+        }
+        BigDecimalInt half(2 * m + 1);
+        int64_t pow2 = e - 1;
+        if (q >= 0)
+        {
+            digits.mul_pow5(q);
+            pow2 -= q;
+        }
+        else
+        {
+            half.mul_pow5(-q);
+            pow2 -= q;
+        }
+        if (pow2 >= 0)
+            half.shift_left(pow2);
+        else
+            digits.shift_left(-pow2);
+
+        int c = compare(digits, half);
+        if (c > 0 || (c == 0 && (sticky || (m & 1))))
+        {
+            // 取后继：尾数进位可能进入指数字段
+            ++b.mantissa_;
+            if (b.mantissa_ == (uint64_t(1) << Fmt::SIG_BITS))
+            {
+                b.mantissa_ = 0;
+                ++b.power2_;
+            }
+        }
+        return b;
+    }
+
+    inline bool match_word(const char *&p, const char *last, const char *word) noexcept
+    {
+        const char *s = p;
+        for (; *word; ++word, ++s)
+            if (s == last || (*s | 0x20) != *word)
+                return false;
+        p = s;
+        return true;
+    }
+
+    template <typename F>
+    from_chars_result float_from_chars(const char *first, const char *last, F &value) noexcept
+    {
+        using Fmt = FloatFormat<F>;
+        using Bits = typename Fmt::bits_type;
+        const char *p = first;
+        bool neg = false;
+        if (p != last && *p == '-')
+        {
+            neg = true;
+            ++p;
+        }
+
+        // inf / infinity / nan / nan(字母数字与下划线)，不区分大小写
+        if (p != last && ((*p | 0x20) == 'i' || (*p | 0x20) == 'n'))
+        {
+            F r;
+            if (match_word(p, last, "inf"))
+            {
+                match_word(p, last, "inity");
+                r = std::numeric_limits<F>::infinity();
+            }
+            else if (match_word(p, last, "nan"))
+            {
+                if (p != last && *p == '(')
+                {
+                    const char *s = p + 1;
+                    while (s != last && (char_digit_value(*s) < 36 || *s == '_'))
+                        ++s;
+                    if (s != last && *s == ')')
+                        p = s + 1;
+                }
+                r = std::numeric_limits<F>::quiet_NaN();
+            }
+            else
+                return {first, std::errc::invalid_argument};
+            value = neg ? -r : r;
+            return {p, std::errc()};
+        }
+
+        DecimalParse d{0, 0, false, p, p, p, p, 0};
+        int taken = 0;
+        bool started = false;
+        for (; p != last && static_cast<unsigned>(*p - '0') < 10; ++p)
+        {
+            unsigned v = static_cast<unsigned>(*p - '0');
+            started |= v != 0;
+            if (!started)
+                continue;
+            if (taken < DECIMAL_FAST_DIGITS)
+            {
+                d.w_ = d.w_ * 10 + v;
+                ++taken;
+            }
+            else
+            {
+                d.truncated_ |= v != 0;
+                ++d.q_;
+            }
+        }
+        d.int_last_ = p;
+        if (p != last && *p == '.')
+        {
+            d.frac_first_ = ++p;
+            for (; p != last && static_cast<unsigned>(*p - '0') < 10; ++p)
+            {
+                unsigned v = static_cast<unsigned>(*p - '0');
+                started |= v != 0;
+                if (!started)
+                {
+                    --d.q_;
+                    continue;
+                }
+                if (taken < DECIMAL_FAST_DIGITS)
+                {
+                    d.w_ = d.w_ * 10 + v;
+                    ++taken;
+                    --d.q_;
+                }
+                else
+                    d.truncated_ |= v != 0;
+            }
+            d.frac_last_ = p;
+        }
+        else
+            d.frac_first_ = d.frac_last_ = p;
+        if (d.int_last_ == d.int_first_ && d.frac_last_ == d.frac_first_)
+            return {first, std::errc::invalid_argument};
+
+        // 指数部分不完整（如 "1e" "1e+"）时不消耗
+        if (p != last && (*p | 0x20) == 'e')
+        {
+            const char *s = p + 1;
+            bool eneg = false;
+            if (s != last && (*s == '-' || *s == '+'))
+            {
+                eneg = *s == '-';
+                ++s;
+            }
+            if (s != last && static_cast<unsigned>(*s - '0') < 10)
+            {
+                int64_t e = 0;
+                for (; s != last && static_cast<unsigned>(*s - '0') < 10; ++s)
+                    if (e < 100000000)
+                        e = e * 10 + (*s - '0');
+                d.exp10_ = eneg ? -e : e;
+                p = s;
+            }
+        }
+        int64_t q = d.q_ + d.exp10_;
+
+        F r;
+        if (d.w_ == 0)
+            r = F(0);
+        else if (!d.truncated_ && d.w_ <= (uint64_t(1) << (Fmt::SIG_BITS + 1)) && q >= -Fmt::MAX_EXACT_POW10 && q <= Fmt::MAX_EXACT_POW10)
+        {
+            // Clinger：有效数字与 10^|q| 都可精确表示，一次乘除即为正确舍入
+            F w = static_cast<F>(d.w_);
+            r = q >= 0 ? w * static_cast<F>(EXACT_POW10[q]) : w / static_cast<F>(EXACT_POW10[-q]);
+        }
+        else
+        {
+            BinaryFloat b = eisel_lemire<F>(q, d.w_);
+            if (d.truncated_)
+            {
+                BinaryFloat up = eisel_lemire<F>(q, d.w_ + 1);
+                if (up.mantissa_ != b.mantissa_ || up.power2_ != b.power2_)
+                    b = decimal_slow_path<F>(d, b);
+            }
+            if (b.power2_ >= Fmt::INF_POWER || (b.power2_ == 0 && b.mantissa_ == 0))
+                return {p, std::errc::result_out_of_range};
+            Bits bits = static_cast<Bits>((b.mantissa_ & ((uint64_t(1) << Fmt::SIG_BITS) - 1)) |
+                                          (static_cast<uint64_t>(b.power2_) << Fmt::SIG_BITS));
+            std::memcpy(&r, &bits, sizeof(r));
+        }
+        value = neg ? -r : r;
+        return {p, std::errc()};
+    }
+
+    // 解析十进制浮点数（std::chars_format::general）：[-]数字[.数字][e[+-]数字]，以及 inf / nan
+    inline from_chars_result from_chars(const char *first, const char *last, double &value) noexcept
+    {
+        return float_from_chars(first, last, value);
+    }
+    inline from_chars_result from_chars(const char *first, const char *last, float &value) noexcept
+    {
+        return float_from_chars(first, last, value);
+    }
+} // namespace zstl
@@ -7,18 +7,37 @@ namespace zstl
     template <typename InputIt, typename T>
     T accumulate(InputIt first, InputIt last, T init)
     {
-        for (; first != last; ++first)
-            init += *first;
-        return init;
+        if constexpr (is_segmented_iterator_v<InputIt>)
+        {
+            // 分段迭代器：逐段在原始指针上累加
+            for_each_segment(first, last, [&](auto b, auto e)
+                             { init = zstl::accumulate(b, e, std::move(init)); });
+            return init;
+        }
+        else
+        {
+            for (; first != last; ++first)
+                init += *first;
+            return init;
+        }
     }
 
     // 带二元操作的累加
     template <typename InputIt, typename T, typename BinaryOp>
     T accumulate(InputIt first, InputIt last, T init, BinaryOp op)
     {
-        for (; first != last; ++first)
-            init = op(init, *first);
-        return init;
+        if constexpr (is_segmented_iterator_v<InputIt>)
+        {
+            for_each_segment(first, last, [&](auto b, auto e)
+                             { init = zstl::accumulate(b, e, std::move(init), op); });
+            return init;
+        }
+        else
+        {
+            for (; first != last; ++first)
+                init = op(init, *first);
+            return init;
+        }
     }
 
     // 计算相邻元素的差，结果写入 result
@@ -0,0 +1,452 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// 字符串查找原语：basic_string 的 find / rfind / find_first_of / find_last_of 基于这些函数
+// 均在 [s, s + n) 上查找，命中返回指针，未命中返回 nullptr
+// char 走 memchr / SSE2 路径，其他字符类型走逐个比较
+namespace zstl
+{
+    inline constexpr size_t TWO_WAY_MIN_NEEDLE = 64; // 模式串不短于此长度时须保证最坏线性，必要时转入 Two-Way
+    inline constexpr size_t SIMD_SET_MAX = 8;        // find_any_of 字符集不超过此大小时逐字符 SIMD 比较
+
+    // 首个等于 ch 的位置
+    template <typename CharT>
+    const CharT *find_char(const CharT *s, size_t n, CharT ch) noexcept
+    {
+        if constexpr (sizeof(CharT) == 1)
+        {
+            // glibc 的 memchr 已按 CPU 选择 SSE2 / AVX2 实现
+            return n ? static_cast<const CharT *>(std::memchr(s, static_cast<unsigned char>(ch), n)) : nullptr;
+        }
+        else
+        {
+            for (const CharT *e = s + n; s != e; ++s)
+                if (*s == ch)
+                    return s;
+            return nullptr;
+        }
+    }
+
+    // 最后一个等于 ch 的位置
+    template <typename CharT>
+    const CharT *rfind_char(const CharT *s, size_t n, CharT ch) noexcept
+    {
+#if defined(__SSE2__)
+        if constexpr (sizeof(CharT) == 1)
+        {
+            const __m128i c = _mm_set1_epi8(static_cast<char>(ch));
+            // 从尾部按 16 字节块向前扫描，块内取最高的命中位
+            while (n >= 16)
+            {
+                n -= 16;
+                __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + n));
+                unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(b, c)));
+                if (mask)
+                    return s + n + (31 - __builtin_clz(mask));
+            }
+        }
+#endif
+        while (n)
+        {
+            if (s[--n] == ch)
+                return s + n;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Two-Way 查找（Crochemore-Perrin），最坏 O(n + m)，额外空间 O(1)
+     * @details 先求模式串在两种字符序下的最大后缀，取较靠后的作为临界分解位置 ell；
+     *          每次先从 ell + 1 向右比较，失配时按已比较长度跳跃，右半匹配后再向左核对
+     *          模式串有周期 per 时记住已核对的前缀（memory），避免重复比较
+     *          x 为按下标取模式串字符的函数，反向查找时传入倒序视图
+     */
+    template <typename Get>
+    void two_way_max_suffix(Get x, ptrdiff_t m, bool reversed, ptrdiff_t &ms, ptrdiff_t &period) noexcept
+    {
+        ms = -1;
+        ptrdiff_t j = 0, k = 1;
+        period = 1;
+        while (j + k < m)
+        {
+            auto a = x(j + k), b = x(ms + k);
+            if (reversed ? b < a : a < b)
+            {
+                j += k;
+                k = 1;
+                period = j - ms;
+            }
+            else if (a == b)
+            {
+                if (k != period)
+                    ++k;
+                else
+                {
+                    j += period;
+                    k = 1;
+                }
+            }
+            else
+            {
+                ms = j;
+                j = ms + 1;
+                k = period = 1;
+            }
+        }
+    }
+
+    // Two-Way 主循环，返回首个匹配在（Reverse 时为倒序的）文本中的偏移，未命中返回 -1
+    template <bool Reverse, typename CharT>
+    ptrdiff_t two_way_core(const CharT *hay, ptrdiff_t n, const CharT *pat, ptrdiff_t m) noexcept
+    {
+        // 倒序视图：反向查找即在倒序文本中正向查找倒序模式串
+        auto x = [pat, m](ptrdiff_t t)
+        { return Reverse ? pat[m - 1 - t] : pat[t]; };
+        auto y = [hay, n](ptrdiff_t t)
+        { return Reverse ? hay[n - 1 - t] : hay[t]; };
+        ptrdiff_t i, j, p, q;
+        two_way_max_suffix(x, m, false, i, p);
+        two_way_max_suffix(x, m, true, j, q);
+        ptrdiff_t ell = i > j ? i : j;
+        ptrdiff_t per = i > j ? p : q;
+
+        // 判断 x[0, ell] 是否与 x[per, per + ell] 相同，即模式串整体以 per 为周期
+        bool periodic = ell + per < m;
+        for (ptrdiff_t t = 0; periodic && t <= ell; ++t)
+        {
+            if (!(x(t) == x(t + per)))
+            {
+                periodic = false;
+                break;
+            }
+        }
+
+        if (periodic)
+        {
+            ptrdiff_t memory = -1;
+            for (j = 0; j <= n - m;)
+            {
+                i = (ell > memory ? ell : memory) + 1;
+                while (i < m && x(i) == y(i + j))
+                    ++i;
+                if (i >= m)
+                {
+                    i = ell;
+                    while (i > memory && x(i) == y(i + j))
+                        --i;
+                    if (i <= memory)
+                        return j;
+                    j += per;
+                    memory = m - per - 1;
+                }
+                else
+                {
+                    j += i - ell;
+                    memory = -1;
+                }
+            }
+        }
+        else
+        {
+            per = (ell + 1 > m - ell - 1 ? ell + 1 : m - ell - 1) + 1;
+            for (j = 0; j <= n - m;)
+            {
+                i = ell + 1;
+                while (i < m && x(i) == y(i + j))
+                    ++i;
+                if (i >= m)
+                {
+                    i = ell;
+                    while (i >= 0 && x(i) == y(i + j))
+                        --i;
+                    if (i < 0)
+                        return j;
+                    j += per;
+                }
+                else
+                {
+                    j += i - ell;
+                }
+            }
+        }
+        return -1;
+    }
+
+    template <typename CharT>
+    const CharT *two_way_search(const CharT *y, size_t n, const CharT *x, size_t m) noexcept
+    {
+        if (m == 0)
+            return y;
+        if (m > n)
+            return nullptr;
+        ptrdiff_t j = two_way_core<false>(y, static_cast<ptrdiff_t>(n), x, static_cast<ptrdiff_t>(m));
+        return j < 0 ? nullptr : y + j;
+    }
+
+    // 反向 Two-Way：最后一次出现的位置，最坏 O(n + m)
+    template <typename CharT>
+    const CharT *two_way_rsearch(const CharT *y, size_t n, const CharT *x, size_t m) noexcept
+    {
+        if (m == 0)
+            return y + n;
+        if (m > n)
+            return nullptr;
+        ptrdiff_t j = two_way_core<true>(y, static_cast<ptrdiff_t>(n), x, static_cast<ptrdiff_t>(m));
+        return j < 0 ? nullptr : y + (n - m - j);
+    }
+
+    // 首次出现 [nd, nd + m) 的位置；m == 0 时返回 h
+    template <typename CharT>
+    const CharT *search_substr(const CharT *h, size_t n, const CharT *nd, size_t m) noexcept
+    {
+        if (m == 0)
+            return h;
+        if (m > n)
+            return nullptr;
+        if (m == 1)
+            return find_char(h, n, nd[0]);
+        if constexpr (sizeof(CharT) == 1)
+        {
+            size_t i = 0;
+#if defined(__SSE2__)
+            // 首尾字符过滤：同一块内首字符与尾字符同时匹配的位置才比较中间部分
+            // 长模式串若误报过多（平均每 16 字节超过一次），剩余部分转入 Two-Way
+            const __m128i first = _mm_set1_epi8(static_cast<char>(nd[0]));
+            const __m128i last = _mm_set1_epi8(static_cast<char>(nd[m - 1]));
+            size_t misses = 0;
+            for (; i + m - 1 + 16 <= n; i += 16)
+            {
+                __m128i bf = _mm_loadu_si128(reinterpret_cast<const __m128i *>(h + i));
+                __m128i bl = _mm_loadu_si128(reinterpret_cast<const __m128i *>(h + i + m - 1));
+                unsigned mask = static_cast<unsigned>(
+                    _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(bf, first), _mm_cmpeq_epi8(bl, last))));
+                while (mask)
+                {
+                    size_t at = i + __builtin_ctz(mask);
+                    if (std::memcmp(h + at + 1, nd + 1, m - 2) == 0)
+                        return h + at;
+                    mask &= mask - 1;
+                    ++misses;
+                }
+                if (m >= TWO_WAY_MIN_NEEDLE && misses > (i >> 4) + 16)
+                    return two_way_search(h + i, n - i, nd, m);
+            }
+#else
+            if (m >= TWO_WAY_MIN_NEEDLE)
+                return two_way_search(h, n, nd, m);
+#endif
+            // 剩余部分：memchr 定位首字符后比较
+            while (i + m <= n)
+            {
+                const CharT *p = find_char(h + i, n - m + 1 - i, nd[0]);
+                if (!p)
+                    return nullptr;
+                if (std::memcmp(p + 1, nd + 1, m - 1) == 0)
+                    return p;
+                i = static_cast<size_t>(p - h) + 1;
+            }
+            return nullptr;
+        }
+        else
+        {
+            if (m >= TWO_WAY_MIN_NEEDLE)
+                return two_way_search(h, n, nd, m);
+            for (size_t i = 0; i + m <= n; ++i)
+            {
+                if (!(h[i] == nd[0]))
+                    continue;
+                size_t k = 1;
+                while (k < m && h[i + k] == nd[k])
+                    ++k;
+                if (k == m)
+                    return h + i;
+            }
+            return nullptr;
+        }
+    }
+
+    // 最后一次出现 [nd, nd + m) 的位置；m == 0 时返回 h + n；与 search_substr 对称，从尾部向前扫描
+    template <typename CharT>
+    const CharT *rsearch_substr(const CharT *h, size_t n, const CharT *nd, size_t m) noexcept
+    {
+        if (m == 0)
+            return h + n;
+        if (m > n)
+            return nullptr;
+        if (m == 1)
+            return rfind_char(h, n, nd[0]);
+        // 候选起点为 [0, end)
+        size_t end = n - m + 1;
+        if constexpr (sizeof(CharT) == 1)
+        {
+#if defined(__SSE2__)
+            // 首尾字符过滤，块内从高位向低位核对；误报过多时剩余部分转入反向 Two-Way
+            const __m128i first = _mm_set1_epi8(static_cast<char>(nd[0]));
+            const __m128i last = _mm_set1_epi8(static_cast<char>(nd[m - 1]));
+            size_t misses = 0;
+            while (end >= 16)
+            {
+                size_t i = end - 16;
+                __m128i bf = _mm_loadu_si128(reinterpret_cast<const __m128i *>(h + i));
+                __m128i bl = _mm_loadu_si128(reinterpret_cast<const __m128i *>(h + i + m - 1));
+                unsigned mask = static_cast<unsigned>(
+                    _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(bf, first), _mm_cmpeq_epi8(bl, last))));
+                while (mask)
+                {
+                    unsigned bit = 31 - __builtin_clz(mask);
+                    if (std::memcmp(h + i + bit + 1, nd + 1, m - 2) == 0)
+                        return h + i + bit;
+                    mask &= ~(1u << bit);
+                    ++misses;
+                }
+                end = i;
+                if (m >= TWO_WAY_MIN_NEEDLE && misses > ((n - m + 1 - end) >> 4) + 16)
+                    return two_way_rsearch(h, end + m - 1, nd, m);
+            }
+#else
+            if (m >= TWO_WAY_MIN_NEEDLE)
+                return two_way_rsearch(h, n, nd, m);
+#endif
+            // 剩余部分：反向定位首字符后比较
+            while (end)
+            {
+                const CharT *p = rfind_char(h, end, nd[0]);
+                if (!p)
+                    return nullptr;
+                if (std::memcmp(p + 1, nd + 1, m - 1) == 0)
+                    return p;
+                end = static_cast<size_t>(p - h);
+            }
+            return nullptr;
+        }
+        else
+        {
+            if (m >= TWO_WAY_MIN_NEEDLE)
+                return two_way_rsearch(h, n, nd, m);
+            while (end--)
+            {
+                if (!(h[end] == nd[0]))
+                    continue;
+                size_t k = 1;
+                while (k < m && h[end + k] == nd[k])
+                    ++k;
+                if (k == m)
+                    return h + end;
+            }
+            return nullptr;
+        }
+    }
+
+    // 单字节字符集合的 256 位位图
+    struct ByteSet
+    {
+        uint64_t bits[4] = {0, 0, 0, 0};
+
+        ByteSet(const unsigned char *set, size_t k) noexcept
+        {
+            for (size_t i = 0; i < k; ++i)
+                bits[set[i] >> 6] |= uint64_t(1) << (set[i] & 63);
+        }
+        bool contains(unsigned char c) const noexcept { return (bits[c >> 6] >> (c & 63)) & 1; }
+    };
+
+#if defined(__SSE2__)
+    // 16 字节块中属于字符集（k <= SIMD_SET_MAX）的位置掩码
+    inline unsigned any_of_mask(__m128i block, const __m128i *set, size_t k) noexcept
+    {
+        __m128i hit = _mm_cmpeq_epi8(block, set[0]);
+        for (size_t j = 1; j < k; ++j)
+            hit = _mm_or_si128(hit, _mm_cmpeq_epi8(block, set[j]));
+        return static_cast<unsigned>(_mm_movemask_epi8(hit));
+    }
+#endif
+
+    // 首个属于 [set, set + k) 的字符
+    template <typename CharT>
+    const CharT *find_any_of(const CharT *s, size_t n, const CharT *set, size_t k) noexcept
+    {
+        if (k == 0 || n == 0)
+            return nullptr;
+        if (k == 1)
+            return find_char(s, n, set[0]);
+        if constexpr (sizeof(CharT) == 1)
+        {
+            size_t i = 0;
+#if defined(__SSE2__)
+            if (k <= SIMD_SET_MAX)
+            {
+                __m128i sv[SIMD_SET_MAX];
+                for (size_t j = 0; j < k; ++j)
+                    sv[j] = _mm_set1_epi8(static_cast<char>(set[j]));
+                for (; i + 16 <= n; i += 16)
+                {
+                    unsigned mask = any_of_mask(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i)), sv, k);
+                    if (mask)
+                        return s + i + __builtin_ctz(mask);
+                }
+            }
+#endif
+            ByteSet bs(reinterpret_cast<const unsigned char *>(set), k);
+            for (; i < n; ++i)
+                if (bs.contains(static_cast<unsigned char>(s[i])))
+                    return s + i;
+            return nullptr;
+        }
+        else
+        {
+            for (size_t i = 0; i < n; ++i)
+                if (find_char(set, k, s[i]))
+                    return s + i;
+            return nullptr;
+        }
+    }
+
+    // 最后一个属于 [set, set + k) 的字符
+    template <typename CharT>
+    const CharT *rfind_any_of(const CharT *s, size_t n, const CharT *set, size_t k) noexcept
+    {
+        if (k == 0 || n == 0)
+            return nullptr;
+        if (k == 1)
+            return rfind_char(s, n, set[0]);
+        if constexpr (sizeof(CharT) == 1)
+        {
+#if defined(__SSE2__)
+            if (k <= SIMD_SET_MAX)
+            {
+                __m128i sv[SIMD_SET_MAX];
+                for (size_t j = 0; j < k; ++j)
+                    sv[j] = _mm_set1_epi8(static_cast<char>(set[j]));
+                while (n >= 16)
+                {
+                    n -= 16;
+                    unsigned mask = any_of_mask(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s + n)), sv, k);
+                    if (mask)
+                        return s + n + (31 - __builtin_clz(mask));
+                }
+            }
+#endif
+            ByteSet bs(reinterpret_cast<const unsigned char *>(set), k);
+            while (n)
+            {
+                if (bs.contains(static_cast<unsigned char>(s[--n])))
+                    return s + n;
+            }
+            return nullptr;
+        }
+        else
+        {
+            while (n)
+            {
+                if (find_char(set, k, s[--n]))
+                    return s + n;
+            }
+            return nullptr;
+        }
+    }
+}
@@ -5,6 +5,17 @@
 
 namespace zstl
 {
+    inline constexpr size_t PAGE_BYTES = 4096;     // 大块内存按页取整
+    inline constexpr size_t MALLOC_GRANULE = 16;   // 一级配置器下 malloc 的最小粒度
+
+    // allocate_at_least 的返回值：分配到的指针与实际可用的元素个数
+    template <typename Pointer, typename SizeType = std::size_t>
+    struct allocation_result
+    {
+        Pointer ptr;
+        SizeType count;
+    };
+
     template <typename T>
     class alloc
     {
@@ -73,6 +84,25 @@ namespace zstl
             return ret;
         }
 
+        /**
+         * 申请 n 个对象时实际可用的对象个数（不小于 n）
+         * 小块取整到内存池的尺寸档位，大块取整到 malloc 粒度，超过一页时取整到页；
+         * allocator_traits::allocate_at_least 据此按实际大小申请，并以同一个数释放
+         */
+        static size_type good_size(size_type n)
+        {
+            if (n == 0)
+                return 0;
+            size_type bytes = n * sizeof(T);
+            if (bytes <= MAX_BYTES)
+                bytes = MemoryPool<T>::usable_bytes(bytes);
+            else if (bytes >= PAGE_BYTES)
+                bytes = (bytes + PAGE_BYTES - 1) & ~(PAGE_BYTES - 1);
+            else
+                bytes = (bytes + MALLOC_GRANULE - 1) & ~(MALLOC_GRANULE - 1);
+            return bytes / sizeof(T);
+        }
+
         // 释放单个对象的内存
         static void deallocate(T *ptr)
         {
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include "alloc.hpp"
+namespace zstl
+{
+    /**
+     * 容器扩容策略：next_capacity(cap, required, elem_size) 返回不小于 required 的新容量
+     * cap 为当前容量，elem_size 为单个元素的字节数
+     */
+
+    // 2 倍增长（默认），首次至少 4 个元素
+    struct growth_2x
+    {
+        static size_t next_capacity(size_t cap, size_t required, size_t)
+        {
+            size_t next = cap ? cap * 2 : 4;
+            return next > required ? next : required;
+        }
+    };
+
+    // 1.5 倍增长：释放的旧块有机会被后续扩容复用
+    struct growth_1_5x
+    {
+        static size_t next_capacity(size_t cap, size_t required, size_t)
+        {
+            size_t next = cap ? cap + (cap + 1) / 2 : 4;
+            return next > required ? next : required;
+        }
+    };
+
+    // 2 倍增长，超过一页后按整页取整
+    struct growth_page
+    {
+        static size_t next_capacity(size_t cap, size_t required, size_t elem_size)
+        {
+            size_t next = growth_2x::next_capacity(cap, required, elem_size);
+            size_t bytes = next * elem_size;
+            if (bytes < PAGE_BYTES)
+                return next;
+            return ((bytes + PAGE_BYTES - 1) & ~(PAGE_BYTES - 1)) / elem_size;
+        }
+    };
+}
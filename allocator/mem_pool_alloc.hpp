@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdlib>
 #include "primary_alloc.hpp"
 namespace zstl
 {
@@ -57,6 +58,12 @@ namespace zstl
             free_list_[idx] = reinterpret_cast<Obj *>(ptr);
         }
 
+        // 申请 bytes 字节时实际拿到的块大小（所在 free_list 的尺寸）
+        static size_type usable_bytes(size_type bytes)
+        {
+            return round_up(bytes);
+        }
+
     private:
         // 向上取 ALIGN 的倍数
         static size_type round_up(size_type bytes)
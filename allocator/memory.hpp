@@ -2,7 +2,9 @@
 #include <type_traits>
 #include <new>
 #include <cstddef>
+#include <memory>
 #include "../iterator/iterator.hpp"
+#include "alloc.hpp"
 
 namespace zstl
 {
@@ -112,6 +114,30 @@ namespace zstl
     template <typename Alloc, typename U>
     constexpr bool has_member_destroy = has_member_destroy_impl<void, Alloc, U>::value;
 
+    // 检测 Alloc 是否提供 allocate_at_least(n)
+    template <typename Alloc, typename = void>
+    struct has_member_allocate_at_least : std::false_type
+    {
+    };
+
+    template <typename Alloc>
+    struct has_member_allocate_at_least<Alloc, std::void_t<decltype(std::declval<Alloc &>().allocate_at_least(size_t{}))>>
+        : std::true_type
+    {
+    };
+
+    // 检测 Alloc 是否提供 good_size(n)：申请 n 个对象时实际可用的个数
+    template <typename Alloc, typename = void>
+    struct has_member_good_size : std::false_type
+    {
+    };
+
+    template <typename Alloc>
+    struct has_member_good_size<Alloc, std::void_t<decltype(std::declval<Alloc &>().good_size(size_t{}))>>
+        : std::true_type
+    {
+    };
+
     //--------------------------------------------------------------------------------
     // allocator_traits 实现
     //   提供统一的接口，屏蔽 Alloc 细节，兼容无状态或有状态分配器
@@ -180,6 +206,29 @@ namespace zstl
             return a.allocate(n);
         }
 
+        /**
+         * allocate_at_least: 分配至少 n 个对象并返回实际可用的个数
+         * 优先委托 Alloc::allocate_at_least(n)；否则若提供 good_size(n)，按其结果调用 allocate；
+         * 都没有时退化为 allocate(n)，个数即为 n
+         */
+        static allocation_result<pointer, size_type> allocate_at_least(Alloc &a, size_type n)
+        {
+            if constexpr (has_member_allocate_at_least<Alloc>::value)
+            {
+                auto r = a.allocate_at_least(n);
+                return {r.ptr, r.count};
+            }
+            else if constexpr (has_member_good_size<Alloc>::value)
+            {
+                size_type count = a.good_size(n);
+                return {a.allocate(count), count};
+            }
+            else
+            {
+                return {a.allocate(n), n};
+            }
+        }
+
         /**
          * deallocate: 委托给 Alloc::deallocate(p, n)，并保证 noexcept
          */
@@ -256,4 +305,16 @@ namespace zstl
         }
     };
 
+    /**
+     * is_trivially_relocatable: 标记类型可通过按字节搬移完成“移动构造 + 析构源对象”
+     * 默认仅可平凡复制的类型满足；不持有自引用指针的类型可特化为 true_type
+     */
+    template <typename T>
+    struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>>
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
 } // namespace zstl
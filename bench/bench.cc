@@ -0,0 +1,25 @@
+#include "bench_rb_tree.hpp"
+#include "bench_concurrent_map.hpp"
+#include "bench_concurrent_queue.hpp"
+#include "bench_batch_lookup.hpp"
+#include "bench_vector.hpp"
+#include "bench_small_vector.hpp"
+#include "bench_deque.hpp"
+#include "bench_list.hpp"
+#include "bench_unrolled_list.hpp"
+#include "bench_intrusive.hpp"
+#include "bench_lru_cache.hpp"
+#include "bench_ring_buffer.hpp"
+#include "bench_string.hpp"
+#include "bench_string_search.hpp"
+#include "bench_rope.hpp"
+#include "bench_string_pool.hpp"
+#include "bench_charconv.hpp"
+
+// 主函数：运行所有基准，可选参数为用例名过滤子串
+int main(int argc, char **argv)
+{
+    const char *filter = argc > 1 ? argv[1] : nullptr;
+    zstl::bench::run_all(filter);
+    return 0;
+}
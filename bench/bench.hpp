@@ -0,0 +1,131 @@
+#pragma once
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace zstl
+{
+    namespace bench
+    {
+        // 阻止编译器把基准中的计算结果当作无用代码优化掉
+        template <typename T>
+        inline void do_not_optimize(const T &value)
+        {
+            asm volatile("" : : "r,m"(value) : "memory");
+        }
+
+        // 强制编译器认为内存已被修改
+        inline void clobber_memory()
+        {
+            asm volatile("" : : : "memory");
+        }
+
+        // 简单计时器：构造即开始计时
+        class Timer
+        {
+            using clock = std::chrono::steady_clock;
+
+        public:
+            Timer() : start_(clock::now()) {}
+
+            void reset() { start_ = clock::now(); }
+
+            double elapsed_ns() const
+            {
+                return std::chrono::duration<double, std::nano>(clock::now() - start_).count();
+            }
+
+        private:
+            clock::time_point start_;
+        };
+
+        // xorshift64* 伪随机数发生器，保证每次运行的输入一致
+        class Random
+        {
+        public:
+            explicit Random(uint64_t seed = 0x9E3779B97F4A7C15ull) : state_(seed ? seed : 1) {}
+
+            uint64_t next()
+            {
+                state_ ^= state_ >> 12;
+                state_ ^= state_ << 25;
+                state_ ^= state_ >> 27;
+                return state_ * 0x2545F4914F6CDD1Dull;
+            }
+
+            // 返回 [0, n) 内的整数
+            uint64_t uniform(uint64_t n) { return next() % n; }
+
+        private:
+            uint64_t state_;
+        };
+
+        // 运行 f 一次并返回平均每次操作的耗时（纳秒）
+        template <typename F>
+        double time_per_op(size_t ops, F &&f)
+        {
+            Timer t;
+            f();
+            clobber_memory();
+            return ops ? t.elapsed_ns() / static_cast<double>(ops) : t.elapsed_ns();
+        }
+
+        // 输出一行结果：用例名、实现名、每次操作耗时
+        inline void report(const char *bench, const char *variant, double ns_per_op)
+        {
+            std::printf("%-36s %-28s %12.2f ns/op\n", bench, variant, ns_per_op);
+        }
+
+        // 输出一行自定义数值结果
+        inline void report_value(const char *bench, const char *variant, double value, const char *unit)
+        {
+            std::printf("%-36s %-28s %12.2f %s\n", bench, variant, value, unit);
+        }
+
+        // 基准用例注册表
+        using BenchFunc = void (*)();
+
+        struct BenchCase
+        {
+            const char *name;
+            BenchFunc func;
+        };
+
+        inline constexpr size_t MAX_BENCH_CASES = 256;
+        inline BenchCase bench_cases[MAX_BENCH_CASES];
+        inline size_t bench_case_count = 0;
+
+        struct BenchRegistrar
+        {
+            BenchRegistrar(const char *name, BenchFunc func)
+            {
+                if (bench_case_count < MAX_BENCH_CASES)
+                    bench_cases[bench_case_count++] = {name, func};
+            }
+        };
+
+        // 运行名字包含 filter 的所有用例，filter 为空时全部运行
+        inline int run_all(const char *filter)
+        {
+            int ran = 0;
+            for (size_t i = 0; i < bench_case_count; ++i)
+            {
+                if (filter && !std::strstr(bench_cases[i].name, filter))
+                    continue;
+                std::printf("== %s\n", bench_cases[i].name);
+                bench_cases[i].func();
+                ++ran;
+            }
+            return ran;
+        }
+    } // namespace bench
+} // namespace zstl
+
+// 定义并注册一个基准用例
+#define ZSTL_BENCH(name)                                                     \
+    static void zstl_bench_##name();                                         \
+    static const ::zstl::bench::BenchRegistrar zstl_bench_registrar_##name( \
+        #name, &zstl_bench_##name);                                          \
+    static void zstl_bench_##name()
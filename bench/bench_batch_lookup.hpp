@@ -0,0 +1,91 @@
+#pragma once
+#include "bench.hpp"
+#include "../container/map.hpp"
+#include "../container/unordered_map.hpp"
+#include "../container/vector.hpp"
+
+namespace zstl
+{
+    namespace bench
+    {
+        inline constexpr size_t BATCH_TABLE_N = 1 << 20;
+        inline constexpr size_t BATCH_LOOKUPS = 1 << 20;
+
+        // 逐个 find 与 find_batch 对比，batch 为每批键数
+        template <typename Map>
+        void run_batch_lookup(const char *name, const Map &m, const vector<int> &probes, size_t batch)
+        {
+            using iterator = typename Map::iterator;
+            iterator out[512];
+            bool found[512];
+            char variant[64];
+
+            size_t hits = 0;
+            std::snprintf(variant, sizeof(variant), "find x%zu", batch);
+            report(name, variant, time_per_op(probes.size(), [&]
+                                              {
+                for (size_t i = 0; i < probes.size(); ++i)
+                {
+                    typename Map::const_iterator it = m.find(probes[i]);
+                    hits += it != m.end();
+                } }));
+
+            std::snprintf(variant, sizeof(variant), "find_batch x%zu", batch);
+            report(name, variant, time_per_op(probes.size(), [&]
+                                              {
+                for (size_t i = 0; i + batch <= probes.size(); i += batch)
+                {
+                    m.find_batch(&probes[i], batch, out);
+                    hits += typename Map::const_iterator(out[0]) != m.end();
+                } }));
+
+            std::snprintf(variant, sizeof(variant), "contains_batch x%zu", batch);
+            report(name, variant, time_per_op(probes.size(), [&]
+                                              {
+                for (size_t i = 0; i + batch <= probes.size(); i += batch)
+                {
+                    m.contains_batch(&probes[i], batch, found);
+                    hits += found[batch - 1];
+                } }));
+            do_not_optimize(hits);
+        }
+
+        // 构造随机键与命中率约 50% 的查找序列
+        inline void make_batch_workload(vector<int> &keys, vector<int> &probes)
+        {
+            Random rng(7);
+            keys.reserve(BATCH_TABLE_N);
+            for (size_t i = 0; i < BATCH_TABLE_N; ++i)
+                keys.push_back(static_cast<int>(rng.next() >> 33));
+            probes.reserve(BATCH_LOOKUPS);
+            for (size_t i = 0; i < BATCH_LOOKUPS; ++i)
+            {
+                if (rng.uniform(2))
+                    probes.push_back(keys[rng.uniform(BATCH_TABLE_N)]);
+                else
+                    probes.push_back(static_cast<int>(rng.next() >> 33));
+            }
+        }
+    } // namespace bench
+} // namespace zstl
+
+// 大表（远超缓存）上的批量查找
+ZSTL_BENCH(batch_lookup)
+{
+    using namespace zstl;
+    vector<int> keys, probes;
+    bench::make_batch_workload(keys, probes);
+
+    unordered_map<int, int> hm;
+    map<int, int> tm;
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        hm.insert({keys[i], static_cast<int>(i)});
+        tm.insert({keys[i], static_cast<int>(i)});
+    }
+    for (size_t batch : {64, 512})
+    {
+        bench::run_batch_lookup("batch_lookup/unordered_map", hm, probes, batch);
+        bench::run_batch_lookup("batch_lookup/map", tm, probes, batch);
+    }
+}
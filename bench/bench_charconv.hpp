@@ -0,0 +1,132 @@
+#pragma once
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "bench.hpp"
+#include "../algorithm/charconv.hpp"
+#include "../container/string.hpp"
+
+namespace zstl
+{
+    namespace bench
+    {
+        inline constexpr size_t CHARCONV_VALUES = 1000000; // 每轮序列化的数值个数
+
+        // 位数分布接近真实数据：小计数为主，夹杂 ID 与时间戳
+        inline std::vector<int64_t> make_integers()
+        {
+            std::vector<int64_t> v(CHARCONV_VALUES);
+            Random rng(11);
+            for (auto &x : v)
+            {
+                uint64_t r = rng.next();
+                x = static_cast<int64_t>(r >> (r % 60));
+                if (r & 1)
+                    x = -x;
+            }
+            return v;
+        }
+
+        inline std::vector<double> make_doubles()
+        {
+            std::vector<double> v(CHARCONV_VALUES);
+            Random rng(13);
+            for (auto &x : v)
+                x = static_cast<double>(rng.next() >> 11) / 9007199254740992.0 * 1e6 - 5e5; // 随机尾数的价格 / 度量值
+            return v;
+        }
+
+        // 把全部数值写入同一缓冲区，返回每个值的耗时
+        template <typename T, typename Format>
+        double format_all(const std::vector<T> &values, Format format)
+        {
+            std::vector<char> out(values.size() * 32);
+            return time_per_op(values.size(), [&]
+                               {
+                char *p = out.data();
+                for (T v : values)
+                    p = format(p, p + 32, v);
+                do_not_optimize(p); });
+        }
+
+        // 先用 zstl::to_chars 生成以空格分隔的文本，再逐个解析
+        template <typename T, typename Parse>
+        double parse_all(const std::vector<T> &values, Parse parse)
+        {
+            std::vector<char> text(values.size() * 32);
+            char *end = text.data();
+            for (T v : values)
+            {
+                end = to_chars(end, end + 32, v).ptr;
+                *end++ = ' ';
+            }
+            *end = 0;
+            return time_per_op(values.size(), [&]
+                               {
+                const char *p = text.data();
+                T sum = 0, v = 0;
+                while (p < end)
+                {
+                    p = parse(p, end, v) + 1;
+                    sum += v;
+                }
+                do_not_optimize(sum); });
+        }
+    } // namespace bench
+} // namespace zstl
+
+// 整数与浮点的序列化 / 解析吞吐：zstl 与 std::to_chars / from_chars、snprintf / strtod 对比
+ZSTL_BENCH(charconv)
+{
+    using namespace zstl::bench;
+    auto ints = make_integers();
+    auto doubles = make_doubles();
+
+    report("charconv/int64 to_chars", "zstl::to_chars", format_all(ints, [](char *p, char *e, int64_t v)
+                                                                   { return zstl::to_chars(p, e, v).ptr; }));
+    report("charconv/int64 to_chars", "std::to_chars", format_all(ints, [](char *p, char *e, int64_t v)
+                                                                  { return std::to_chars(p, e, v).ptr; }));
+    report("charconv/int64 to_chars", "snprintf", format_all(ints, [](char *p, char *e, int64_t v)
+                                                             { return p + std::snprintf(p, static_cast<size_t>(e - p), "%lld", static_cast<long long>(v)); }));
+
+    report("charconv/double to_chars", "zstl::to_chars", format_all(doubles, [](char *p, char *e, double v)
+                                                                    { return zstl::to_chars(p, e, v).ptr; }));
+    report("charconv/double to_chars", "std::to_chars", format_all(doubles, [](char *p, char *e, double v)
+                                                                   { return std::to_chars(p, e, v).ptr; }));
+    report("charconv/double to_chars", "snprintf %.17g", format_all(doubles, [](char *p, char *e, double v)
+                                                                    { return p + std::snprintf(p, static_cast<size_t>(e - p), "%.17g", v); }));
+
+    report("charconv/int64 from_chars", "zstl::from_chars", parse_all(ints, [](const char *p, const char *e, int64_t &v)
+                                                                      { return zstl::from_chars(p, e, v).ptr; }));
+    report("charconv/int64 from_chars", "std::from_chars", parse_all(ints, [](const char *p, const char *e, int64_t &v)
+                                                                     { return std::from_chars(p, e, v).ptr; }));
+    report("charconv/int64 from_chars", "strtoll", parse_all(ints, [](const char *p, const char *, int64_t &v)
+                                                             {
+        char *end;
+        v = std::strtoll(p, &end, 10);
+        return static_cast<const char *>(end); }));
+
+    report("charconv/double from_chars", "zstl::from_chars", parse_all(doubles, [](const char *p, const char *e, double &v)
+                                                                       { return zstl::from_chars(p, e, v).ptr; }));
+    report("charconv/double from_chars", "std::from_chars", parse_all(doubles, [](const char *p, const char *e, double &v)
+                                                                      { return std::from_chars(p, e, v).ptr; }));
+    report("charconv/double from_chars", "strtod", parse_all(doubles, [](const char *p, const char *, double &v)
+                                                             {
+        char *end;
+        v = std::strtod(p, &end);
+        return static_cast<const char *>(end); }));
+
+    // to_string：短串直接落在内部缓冲区
+    size_t sink = 0;
+    report("charconv/to_string int", "zstl::to_string", time_per_op(ints.size(), [&]
+                                                                    {
+        for (int64_t v : ints)
+            sink += zstl::to_string(v).size(); }));
+    report("charconv/to_string int", "std::to_string", time_per_op(ints.size(), [&]
+                                                                   {
+        for (int64_t v : ints)
+            sink += std::to_string(v).size(); }));
+    do_not_optimize(sink);
+}
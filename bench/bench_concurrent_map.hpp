@@ -0,0 +1,116 @@
+#pragma once
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+#include "bench.hpp"
+#include "../container/map.hpp"
+#include "../container/concurrent_skiplist_map.hpp"
+
+namespace zstl
+{
+    namespace bench
+    {
+        inline constexpr int CONCURRENT_KEYSPACE = 100000;
+        inline constexpr size_t CONCURRENT_OPS_PER_THREAD = 200000;
+
+        // 读写锁保护的 zstl::map，对应业务中现有的用法
+        class locked_tree_map
+        {
+        public:
+            bool contains(int key) const
+            {
+                std::shared_lock<std::shared_mutex> lock(mutex_);
+                map<int, int>::const_iterator it = map_.find(key);
+                return it != map_.end();
+            }
+            void insert(int key, int value)
+            {
+                std::unique_lock<std::shared_mutex> lock(mutex_);
+                map_.insert({key, value});
+            }
+            void erase(int key)
+            {
+                std::unique_lock<std::shared_mutex> lock(mutex_);
+                map_.erase(key);
+            }
+
+        private:
+            mutable std::shared_mutex mutex_;
+            map<int, int> map_;
+        };
+
+        // 跳表适配为同样的接口
+        class skiplist_map
+        {
+        public:
+            bool contains(int key) const { return map_.contains(key); }
+            void insert(int key, int value) { map_.emplace(key, value); }
+            void erase(int key) { map_.erase(key); }
+
+        private:
+            concurrent_skiplist_map<int, int> map_;
+        };
+
+        /**
+         * @brief 多线程混合负载：每个线程执行固定次数操作
+         * @param write_percent 写操作比例（插入与删除各占一半）
+         * @return 总吞吐（百万次操作/秒）
+         */
+        template <typename Map>
+        double run_concurrent_mix(int threads, int write_percent)
+        {
+            Map m;
+            for (int k = 0; k < CONCURRENT_KEYSPACE; k += 2)
+                m.insert(k, k);
+
+            std::vector<std::thread> workers;
+            Timer timer;
+            for (int t = 0; t < threads; ++t)
+            {
+                workers.emplace_back([&m, t, write_percent]
+                                     {
+                    Random rng(t + 1);
+                    size_t hits = 0;
+                    for (size_t i = 0; i < CONCURRENT_OPS_PER_THREAD; ++i)
+                    {
+                        int key = static_cast<int>(rng.uniform(CONCURRENT_KEYSPACE));
+                        int dice = static_cast<int>(rng.uniform(100));
+                        if (dice < write_percent / 2)
+                            m.insert(key, key);
+                        else if (dice < write_percent)
+                            m.erase(key);
+                        else
+                            hits += m.contains(key);
+                    }
+                    do_not_optimize(hits); });
+            }
+            for (auto &w : workers)
+                w.join();
+            double seconds = timer.elapsed_ns() / 1e9;
+            return threads * CONCURRENT_OPS_PER_THREAD / seconds / 1e6;
+        }
+
+        template <typename Map>
+        void report_concurrent_mix(const char *variant, int write_percent)
+        {
+            char bench_name[64];
+            for (int threads : {1, 2, 4, 8})
+            {
+                std::snprintf(bench_name, sizeof(bench_name), "concurrent_map/%d%%_write/%d_threads",
+                              write_percent, threads);
+                report_value(bench_name, variant, run_concurrent_mix<Map>(threads, write_percent), "Mops/s");
+            }
+        }
+    } // namespace bench
+} // namespace zstl
+
+// 读多写少与读写均衡两种负载，跳表 vs 读写锁 + map
+ZSTL_BENCH(concurrent_map_mixed)
+{
+    using namespace zstl::bench;
+    for (int write_percent : {10, 50})
+    {
+        report_concurrent_mix<locked_tree_map>("shared_mutex+map", write_percent);
+        report_concurrent_mix<skiplist_map>("concurrent_skiplist_map", write_percent);
+    }
+}
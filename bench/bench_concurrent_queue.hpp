@@ -0,0 +1,170 @@
+#pragma once
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "bench.hpp"
+#include "../container/queue.hpp"
+#include "../container/concurrent_queue.hpp"
+
+namespace zstl
+{
+    namespace bench
+    {
+        inline constexpr size_t QUEUE_ITEMS = 1000000;
+        inline constexpr size_t QUEUE_CAPACITY = 1024;
+        inline constexpr size_t QUEUE_BATCH = 32;
+        inline constexpr size_t PING_PONG_ROUNDS = 100000;
+
+        // 互斥量 + 条件变量包装的 zstl::queue，对应业务中现有的用法
+        class locked_queue
+        {
+        public:
+            explicit locked_queue(size_t capacity) : capacity_(capacity) {}
+
+            void push(int v)
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                while (q_.size() >= capacity_)
+                    not_full_.wait_for(lock, QUEUE_WAIT_SLICE);
+                q_.push(v);
+                not_empty_.notify_one();
+            }
+            void pop(int &v)
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                while (q_.empty())
+                    not_empty_.wait_for(lock, QUEUE_WAIT_SLICE);
+                v = q_.front();
+                q_.pop();
+                not_full_.notify_one();
+            }
+
+        private:
+            size_t capacity_;
+            std::mutex mutex_;
+            std::condition_variable not_empty_, not_full_;
+            queue<int> q_;
+        };
+
+        /**
+         * @brief producers 个线程共写入 QUEUE_ITEMS 个元素，consumers 个线程全部取出
+         * @return 吞吐（百万元素/秒）
+         */
+        template <typename Q>
+        double run_queue_throughput(int producers, int consumers)
+        {
+            Q q(QUEUE_CAPACITY);
+            size_t per_producer = QUEUE_ITEMS / producers;
+            size_t per_consumer = per_producer * producers / consumers;
+            std::vector<std::thread> threads;
+            Timer timer;
+            for (int p = 0; p < producers; ++p)
+                threads.emplace_back([&q, per_producer]
+                                     {
+                    for (size_t i = 0; i < per_producer; ++i)
+                        q.push(static_cast<int>(i)); });
+            for (int c = 0; c < consumers; ++c)
+                threads.emplace_back([&q, per_consumer]
+                                     {
+                    long long sum = 0;
+                    for (size_t i = 0; i < per_consumer; ++i)
+                    {
+                        int v;
+                        q.pop(v);
+                        sum += v;
+                    }
+                    do_not_optimize(sum); });
+            for (auto &t : threads)
+                t.join();
+            return per_consumer * consumers / (timer.elapsed_ns() / 1e9) / 1e6;
+        }
+
+        // 单生产者单消费者，按 QUEUE_BATCH 批量收发
+        inline double run_spsc_batch_throughput()
+        {
+            spsc_queue<int> q(QUEUE_CAPACITY);
+            Timer timer;
+            std::thread producer([&q]
+                                 {
+                int buf[QUEUE_BATCH];
+                for (size_t i = 0; i < QUEUE_ITEMS;)
+                {
+                    size_t n = QUEUE_ITEMS - i < QUEUE_BATCH ? QUEUE_ITEMS - i : QUEUE_BATCH;
+                    for (size_t k = 0; k < n; ++k)
+                        buf[k] = static_cast<int>(i + k);
+                    size_t done = 0;
+                    while (done < n)
+                    {
+                        size_t pushed = q.try_push_batch(buf + done, n - done);
+                        if (pushed == 0)
+                            std::this_thread::yield();
+                        done += pushed;
+                    }
+                    i += n;
+                } });
+            long long sum = 0;
+            int buf[QUEUE_BATCH];
+            for (size_t got = 0; got < QUEUE_ITEMS;)
+            {
+                size_t n = q.try_pop_batch(buf, QUEUE_BATCH);
+                if (n == 0)
+                    std::this_thread::yield();
+                for (size_t k = 0; k < n; ++k)
+                    sum += buf[k];
+                got += n;
+            }
+            producer.join();
+            do_not_optimize(sum);
+            return QUEUE_ITEMS / (timer.elapsed_ns() / 1e9) / 1e6;
+        }
+
+        // 两个线程经两条队列来回传递一个值，返回单次往返耗时（纳秒）
+        template <typename Q>
+        double run_ping_pong()
+        {
+            Q to(QUEUE_CAPACITY), back(QUEUE_CAPACITY);
+            Timer timer;
+            std::thread echo([&]
+                             {
+                for (size_t i = 0; i < PING_PONG_ROUNDS; ++i)
+                {
+                    int v;
+                    to.pop(v);
+                    back.push(v + 1);
+                } });
+            int v = 0;
+            for (size_t i = 0; i < PING_PONG_ROUNDS; ++i)
+            {
+                to.push(v);
+                back.pop(v);
+            }
+            echo.join();
+            do_not_optimize(v);
+            return timer.elapsed_ns() / PING_PONG_ROUNDS;
+        }
+    } // namespace bench
+} // namespace zstl
+
+// 不同生产者 / 消费者数量下的吞吐，以及往返延迟
+ZSTL_BENCH(concurrent_queue)
+{
+    using namespace zstl;
+    using namespace zstl::bench;
+    report_value("queue/1p1c", "mutex+cv+queue", run_queue_throughput<locked_queue>(1, 1), "Mitems/s");
+    report_value("queue/1p1c", "spsc_queue", run_queue_throughput<spsc_queue<int>>(1, 1), "Mitems/s");
+    report_value("queue/1p1c", "spsc_queue batch", run_spsc_batch_throughput(), "Mitems/s");
+    report_value("queue/1p1c", "mpmc_queue", run_queue_throughput<mpmc_queue<int>>(1, 1), "Mitems/s");
+
+    char name[64];
+    for (int threads : {2, 4})
+    {
+        std::snprintf(name, sizeof(name), "queue/%dp%dc", threads, threads);
+        report_value(name, "mutex+cv+queue", run_queue_throughput<locked_queue>(threads, threads), "Mitems/s");
+        report_value(name, "mpmc_queue", run_queue_throughput<mpmc_queue<int>>(threads, threads), "Mitems/s");
+    }
+
+    report("queue/ping_pong", "mutex+cv+queue", run_ping_pong<locked_queue>());
+    report("queue/ping_pong", "spsc_queue", run_ping_pong<spsc_queue<int>>());
+    report("queue/ping_pong", "mpmc_queue", run_ping_pong<mpmc_queue<int>>());
+}
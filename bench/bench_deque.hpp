@@ -0,0 +1,141 @@
+#pragma once
+#include <deque>
+#include <numeric>
+#include <algorithm>
+#include "bench.hpp"
+#include "../container/deque.hpp"
+#include "../algorithm/numeric.hpp"
+
+namespace zstl
+{
+    namespace bench
+    {
+        inline constexpr size_t DEQUE_N = 4000000;
+
+        // 逐元素遍历的基线：每次 ++ 都检查缓冲区边界
+        template <typename It, typename T>
+        T naive_accumulate(It first, It last, T init)
+        {
+            for (; first != last; ++first)
+                init += *first;
+            return init;
+        }
+
+        template <typename InIt, typename OutIt>
+        OutIt naive_copy(InIt first, InIt last, OutIt dest)
+        {
+            for (; first != last; ++first, ++dest)
+                *dest = *first;
+            return dest;
+        }
+
+        template <typename It, typename T>
+        void naive_fill(It first, It last, const T &value)
+        {
+            for (; first != last; ++first)
+                *first = value;
+        }
+    } // namespace bench
+} // namespace zstl
+
+// 大 deque 上的 copy / fill / accumulate：逐元素 vs 按段处理
+ZSTL_BENCH(deque_segmented_algorithms)
+{
+    using namespace zstl;
+    constexpr size_t n = bench::DEQUE_N;
+    deque<int> d;
+    std::deque<int> sd;
+    for (size_t i = 0; i < n; ++i)
+    {
+        d.push_back(static_cast<int>(i));
+        sd.push_back(static_cast<int>(i));
+    }
+    static int buf[n];
+    deque<int> dst(n, 0);
+
+    long long sum = 0;
+    bench::report("deque/accumulate<int>", "element-wise", bench::time_per_op(n, [&]
+                                                                              { sum += bench::naive_accumulate(d.begin(), d.end(), 0LL); }));
+    bench::report("deque/accumulate<int>", "zstl::accumulate", bench::time_per_op(n, [&]
+                                                                                  { sum += zstl::accumulate(d.begin(), d.end(), 0LL); }));
+    bench::report("deque/accumulate<int>", "std::deque", bench::time_per_op(n, [&]
+                                                                            { sum += std::accumulate(sd.begin(), sd.end(), 0LL); }));
+    bench::do_not_optimize(sum);
+
+    bench::report("deque/copy_to_array<int>", "element-wise", bench::time_per_op(n, [&]
+                                                                                 { bench::naive_copy(d.begin(), d.end(), buf); }));
+    bench::report("deque/copy_to_array<int>", "zstl::copy", bench::time_per_op(n, [&]
+                                                                               { zstl::copy(d.begin(), d.end(), buf); }));
+    bench::report("deque/copy_to_array<int>", "std::deque", bench::time_per_op(n, [&]
+                                                                               { std::copy(sd.begin(), sd.end(), buf); }));
+
+    bench::report("deque/copy_to_deque<int>", "element-wise", bench::time_per_op(n, [&]
+                                                                                 { bench::naive_copy(d.begin(), d.end(), dst.begin()); }));
+    bench::report("deque/copy_to_deque<int>", "zstl::copy", bench::time_per_op(n, [&]
+                                                                               { zstl::copy(d.begin(), d.end(), dst.begin()); }));
+
+    bench::report("deque/fill<int>", "element-wise", bench::time_per_op(n, [&]
+                                                                        { bench::naive_fill(dst.begin(), dst.end(), 7); }));
+    bench::report("deque/fill<int>", "zstl::fill", bench::time_per_op(n, [&]
+                                                                      { zstl::fill(dst.begin(), dst.end(), 7); }));
+    bench::report("deque/fill<int>", "std::deque", bench::time_per_op(n, [&]
+                                                                      { std::fill(sd.begin(), sd.end(), 7); }));
+    bench::do_not_optimize(dst[n / 2]);
+    bench::do_not_optimize(buf[n / 2]);
+}
+
+namespace zstl
+{
+    namespace bench
+    {
+        // 固定字节数的元素，用于比较不同元素大小下的缓冲区策略
+        template <size_t Bytes>
+        struct DequeElem
+        {
+            char bytes[Bytes];
+        };
+
+        // 队列负载：保持约 depth 个元素，交替 push_back / pop_front
+        template <typename Q>
+        double queue_ns(size_t ops, size_t depth)
+        {
+            using T = typename Q::value_type;
+            return time_per_op(ops, [&]
+                               {
+                Q q;
+                T v{};
+                for (size_t i = 0; i < depth; ++i)
+                    q.push_back(v);
+                for (size_t i = 0; i < ops; ++i)
+                {
+                    v.bytes[0] = static_cast<char>(i);
+                    q.push_back(v);
+                    do_not_optimize(q.front().bytes[0]);
+                    q.pop_front();
+                }
+                do_not_optimize(q.back().bytes[0]); });
+        }
+
+        template <size_t Bytes>
+        void queue_case(const char *name)
+        {
+            using T = DequeElem<Bytes>;
+            // 限制总字节量，避免大元素用例耗时过长
+            constexpr size_t ops = (size_t(32) << 20) / Bytes < 2000000 ? (size_t(32) << 20) / Bytes : 2000000;
+            constexpr size_t depth = 64;
+            report(name, "25 elems/buffer", queue_ns<deque<T, alloc<T>, 25 * sizeof(T)>>(ops, depth));
+            report(name, "512 B/buffer", queue_ns<deque<T>>(ops, depth));
+            report(name, "4 KiB/buffer", queue_ns<deque<T, alloc<T>, 4096>>(ops, depth));
+            report(name, "std::deque", queue_ns<std::deque<T>>(ops, depth));
+        }
+    } // namespace bench
+} // namespace zstl
+
+// push_back / pop_front 队列吞吐：旧的固定 25 元素缓冲区 vs 按字节数计算的缓冲区
+ZSTL_BENCH(deque_queue_throughput)
+{
+    zstl::bench::queue_case<1>("deque/queue<1B>");
+    zstl::bench::queue_case<8>("deque/queue<8B>");
+    zstl::bench::queue_case<64>("deque/queue<64B>");
+    zstl::bench::queue_case<256>("deque/queue<256B>");
+}
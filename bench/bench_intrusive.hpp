@@ -0,0 +1,131 @@
+#pragma once
+#include <vector>
+#include "bench.hpp"
+#include "../container/intrusive_rbtree.hpp"
+#include "../container/intrusive_hash_set.hpp"
+#include "../container/map.hpp"
+#include "../container/unordered_map.hpp"
+
+namespace zstl
+{
+    namespace bench
+    {
+        inline constexpr size_t INTRUSIVE_N = 100000;    // 池中对象个数
+        inline constexpr size_t INTRUSIVE_OPS = 1000000; // 摘下再重新插入的次数
+
+        struct BenchTimerTag;
+        struct BenchIdTag;
+
+        // 池中对象：同时挂在定时器树与 id 索引上
+        struct BenchConn : intrusive_rbtree_hook<BenchTimerTag>, intrusive_hash_hook<BenchIdTag>
+        {
+            long deadline_ = 0;
+            int id_ = 0;
+            multimap<long, BenchConn *>::iterator timer_pos_; // 非侵入式对照组使用
+        };
+
+        struct BenchByDeadline
+        {
+            bool operator()(const BenchConn &a, const BenchConn &b) const { return a.deadline_ < b.deadline_; }
+        };
+
+        struct BenchIdHash
+        {
+            size_t operator()(const BenchConn &c) const { return static_cast<size_t>(c.id_); }
+            size_t operator()(int id) const { return static_cast<size_t>(id); }
+        };
+
+        struct BenchIdEqual
+        {
+            bool operator()(const BenchConn &a, const BenchConn &b) const { return a.id_ == b.id_; }
+            bool operator()(int id, const BenchConn &b) const { return id == b.id_; }
+        };
+    } // namespace bench
+} // namespace zstl
+
+// 池化对象的重新调度：侵入式容器零分配 vs 每次插入分配一个包装节点
+ZSTL_BENCH(intrusive_reschedule)
+{
+    using namespace zstl::bench;
+    std::vector<BenchConn> pool(INTRUSIVE_N);
+    Random rng(31);
+    for (size_t i = 0; i < INTRUSIVE_N; ++i)
+    {
+        pool[i].deadline_ = static_cast<long>(rng.uniform(1u << 30));
+        pool[i].id_ = static_cast<int>(i);
+    }
+    std::vector<uint32_t> pick(INTRUSIVE_OPS);
+    for (auto &p : pick)
+        p = static_cast<uint32_t>(rng.uniform(INTRUSIVE_N));
+
+    {
+        zstl::intrusive_rbtree<BenchConn, BenchByDeadline, BenchTimerTag> timers;
+        for (auto &c : pool)
+            timers.insert_equal(c);
+        long next_deadline = 1 << 30;
+        report("intrusive/reschedule timer", "intrusive_rbtree", time_per_op(INTRUSIVE_OPS, [&]
+                                                                             {
+            for (uint32_t p : pick)
+            {
+                BenchConn &c = pool[p];
+                timers.erase(c);
+                c.deadline_ = next_deadline++;
+                timers.insert_equal(c);
+            }
+            do_not_optimize(timers.front().id_); }));
+    }
+    {
+        zstl::multimap<long, BenchConn *> timers;
+        for (auto &c : pool)
+            c.timer_pos_ = timers.emplace(c.deadline_, &c);
+        long next_deadline = 1 << 30;
+        report("intrusive/reschedule timer", "multimap<long, T*>", time_per_op(INTRUSIVE_OPS, [&]
+                                                                               {
+            for (uint32_t p : pick)
+            {
+                BenchConn &c = pool[p];
+                timers.erase(c.timer_pos_);
+                c.deadline_ = next_deadline++;
+                c.timer_pos_ = timers.emplace(c.deadline_, &c);
+            }
+            do_not_optimize(timers.begin()->second); }));
+    }
+
+    // id 索引：连接换 id 后重新登记
+    {
+        zstl::intrusive_hash_set<BenchConn, BenchIdHash, BenchIdEqual, BenchIdTag> index;
+        index.reserve(INTRUSIVE_N);
+        for (auto &c : pool)
+            index.insert_unique(c);
+        int next_id = static_cast<int>(INTRUSIVE_N);
+        report("intrusive/re-key index", "intrusive_hash_set", time_per_op(INTRUSIVE_OPS, [&]
+                                                                           {
+            for (uint32_t p : pick)
+            {
+                BenchConn &c = pool[p];
+                index.erase(c);
+                c.id_ = next_id++;
+                index.insert_unique(c);
+            }
+            do_not_optimize(index.size()); }));
+        index.clear();
+    }
+    for (size_t i = 0; i < INTRUSIVE_N; ++i)
+        pool[i].id_ = static_cast<int>(i);
+    {
+        zstl::unordered_map<int, BenchConn *> index;
+        for (auto &c : pool)
+            index.emplace(c.id_, &c);
+        int next_id = static_cast<int>(INTRUSIVE_N);
+        report("intrusive/re-key index", "unordered_map<int, T*>", time_per_op(INTRUSIVE_OPS, [&]
+                                                                               {
+            for (uint32_t p : pick)
+            {
+                BenchConn &c = pool[p];
+                index.erase(c.id_);
+                c.id_ = next_id++;
+                index.emplace(c.id_, &c);
+            }
+            do_not_optimize(index.size()); }));
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <algorithm>
+#include <list>
+#include <vector>
+#include "bench.hpp"
+#include "../container/list.hpp"
+#include "../container/forward_list.hpp"
+
+namespace zstl
+{
+    namespace bench
+    {
+        inline constexpr size_t LIST_SORT_N = 1000000; // 排序的元素个数
+        inline constexpr size_t LIST_TOUCHES = 1000000; // 移到队首的次数
+        inline constexpr size_t LIST_LRU_N = 100000;    // 移到队首时的链表长度
+
+        inline std::vector<int> make_list_keys()
+        {
+            std::vector<int> keys(LIST_SORT_N);
+            Random rng(21);
+            for (auto &k : keys)
+                k = static_cast<int>(rng.next());
+            return keys;
+        }
+
+        // 每轮先按同一随机序列重建，只计排序本身
+        template <typename L, typename Sort>
+        double time_list_sort(const std::vector<int> &keys, Sort sort)
+        {
+            double total = 0;
+            for (int round = 0; round < 3; ++round)
+            {
+                L l;
+                for (int k : keys)
+                    l.push_front(k);
+                total += time_per_op(keys.size(), [&]
+                                     { sort(l); });
+                do_not_optimize(l.front());
+            }
+            return total / 3;
+        }
+    } // namespace bench
+} // namespace zstl
+
+// 链表排序与节点搬移：原地重接指针 vs 复制到 vector 排序后重建（每个元素一次分配）
+ZSTL_BENCH(list_sort)
+{
+    using namespace zstl::bench;
+    auto keys = make_list_keys();
+
+    report("list/sort 1M", "zstl::list::sort", time_list_sort<zstl::list<int>>(keys, [](zstl::list<int> &l)
+                                                                                { l.sort(); }));
+    report("list/sort 1M", "std::list::sort", time_list_sort<std::list<int>>(keys, [](std::list<int> &l)
+                                                                              { l.sort(); }));
+    report("list/sort 1M", "zstl::forward_list::sort", time_list_sort<zstl::forward_list<int>>(keys, [](zstl::forward_list<int> &l)
+                                                                                                { l.sort(); }));
+    report("list/sort 1M", "copy+vector sort+rebuild", time_list_sort<zstl::list<int>>(keys, [](zstl::list<int> &l)
+                                                                                        {
+        std::vector<int> v;
+        v.reserve(l.size());
+        for (int x : l)
+            v.push_back(x);
+        std::sort(v.begin(), v.end());
+        zstl::list<int> rebuilt;
+        for (int x : v)
+            rebuilt.push_back(x);
+        l.swap(rebuilt); }));
+
+    // LRU 式访问：把随机节点移到队首
+    zstl::list<int> lru;
+    std::vector<zstl::list<int>::iterator> where;
+    for (size_t i = 0; i < LIST_LRU_N; ++i)
+    {
+        lru.push_back(static_cast<int>(i));
+        where.push_back(--lru.end());
+    }
+    Random rng(23);
+    std::vector<uint32_t> touch(LIST_TOUCHES);
+    for (auto &t : touch)
+        t = static_cast<uint32_t>(rng.uniform(LIST_LRU_N));
+    report("list/move to front", "splice", time_per_op(LIST_TOUCHES, [&]
+                                                       {
+        for (uint32_t t : touch)
+            lru.splice(lru.begin(), lru, where[t]);
+        do_not_optimize(lru.front()); }));
+    report("list/move to front", "erase+push_front", time_per_op(LIST_TOUCHES, [&]
+                                                                 {
+        for (uint32_t t : touch)
+        {
+            int v = *where[t];
+            lru.erase(where[t]);
+            lru.push_front(v);
+            where[t] = lru.begin();
+        }
+        do_not_optimize(lru.front()); }));
+}
@@ -0,0 +1,119 @@
+#pragma once
+#include <cmath>
+#include <vector>
+#include "bench.hpp"
+#include "../container/lru_cache.hpp"
+#include "../container/list.hpp"
+#include "../container/unordered_map.hpp"
+
+namespace zstl
+{
+    namespace bench
+    {
+        inline constexpr size_t CACHE_KEYS = 1000000;    // 不同键的个数
+        inline constexpr size_t CACHE_OPS = 2000000;     // 访问次数
+        inline constexpr size_t CACHE_CAPACITY = 10000;  // 缓存容量（条目数）
+        inline constexpr double CACHE_ZIPF_S = 0.99;     // Zipf 偏斜参数
+
+        // 按 Zipf 分布抽取键：预先算好累积分布，再二分查找
+        inline std::vector<int> make_zipf_keys()
+        {
+            std::vector<double> cdf(CACHE_KEYS);
+            double sum = 0;
+            for (size_t i = 0; i < CACHE_KEYS; ++i)
+                cdf[i] = sum += 1.0 / std::pow(static_cast<double>(i + 1), CACHE_ZIPF_S);
+            Random rng(41);
+            std::vector<int> keys(CACHE_OPS);
+            for (auto &k : keys)
+            {
+                double u = static_cast<double>(rng.next() >> 11) / (1ull << 53) * sum;
+                size_t lo = 0, hi = CACHE_KEYS - 1;
+                while (lo < hi)
+                {
+                    size_t mid = (lo + hi) / 2;
+                    if (cdf[mid] < u)
+                        lo = mid + 1;
+                    else
+                        hi = mid;
+                }
+                // 打散热点键，避免热度与键值大小相关
+                k = static_cast<int>((lo * 2654435761u) % CACHE_KEYS);
+            }
+            return keys;
+        }
+
+        // 手工拼装的 LRU：list 保存次序与值，unordered_map 保存键到链表位置
+        class ListMapLru
+        {
+        public:
+            explicit ListMapLru(size_t capacity) : capacity_(capacity) {}
+
+            int *get(int key)
+            {
+                auto it = where_.find(key);
+                if (it == where_.end())
+                    return nullptr;
+                order_.splice(order_.begin(), order_, it->second);
+                return &it->second->second;
+            }
+
+            void put(int key, int value)
+            {
+                order_.push_front(std::pair<int, int>(key, value));
+                where_.emplace(key, order_.begin());
+                if (where_.size() > capacity_)
+                {
+                    where_.erase(order_.back().first);
+                    order_.pop_back();
+                }
+            }
+
+        private:
+            list<std::pair<int, int>> order_;
+            unordered_map<int, list<std::pair<int, int>>::iterator> where_;
+            size_t capacity_;
+        };
+
+        // 读穿式访问：未命中时写入；返回每次访问的耗时并报告命中率
+        template <typename Cache>
+        double time_cache(Cache &cache, const std::vector<int> &keys, size_t &hits)
+        {
+            hits = 0;
+            return time_per_op(keys.size(), [&]
+                               {
+                for (int k : keys)
+                {
+                    if (int *v = cache.get(k))
+                    {
+                        ++hits;
+                        do_not_optimize(*v);
+                    }
+                    else
+                        cache.put(k, k);
+                } });
+        }
+    } // namespace bench
+} // namespace zstl
+
+// Zipf(0.99) 读穿负载：单节点侵入式缓存 vs list + unordered_map 拼装，另比较 LRU 与 W-TinyLFU 的命中率
+ZSTL_BENCH(lru_cache_zipf)
+{
+    using namespace zstl::bench;
+    auto keys = make_zipf_keys();
+    size_t hits = 0;
+    {
+        zstl::lru_cache<int, int> cache(CACHE_CAPACITY);
+        report("cache/zipf 1M keys, 10k cap", "lru_cache", time_cache(cache, keys, hits));
+        report_value("cache/zipf hit rate", "lru_cache", 100.0 * hits / keys.size(), "%");
+    }
+    {
+        zstl::tinylfu_cache<int, int> cache(CACHE_CAPACITY);
+        report("cache/zipf 1M keys, 10k cap", "tinylfu_cache", time_cache(cache, keys, hits));
+        report_value("cache/zipf hit rate", "tinylfu_cache", 100.0 * hits / keys.size(), "%");
+    }
+    {
+        ListMapLru cache(CACHE_CAPACITY);
+        report("cache/zipf 1M keys, 10k cap", "list + unordered_map", time_cache(cache, keys, hits));
+        report_value("cache/zipf hit rate", "list + unordered_map", 100.0 * hits / keys.size(), "%");
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "bench.hpp"
+#include "../container/map.hpp"
+
+namespace zstl
+{
+    namespace bench
+    {
+        inline constexpr size_t RB_TREE_N = 1000000;
+
+        // 构造 n 个随机键
+        inline void make_tree_keys(int *keys, size_t n)
+        {
+            Random rng(42);
+            for (size_t i = 0; i < n; ++i)
+                keys[i] = static_cast<int>(rng.next() >> 33);
+        }
+
+        template <typename Map>
+        void run_tree_lookup(const char *variant, const int *keys, size_t n)
+        {
+            Map m;
+            report("rb_tree/insert_random", variant, time_per_op(n, [&]
+                                                                 {
+                for (size_t i = 0; i < n; ++i)
+                    m.insert({keys[i], static_cast<int>(i)}); }));
+
+            size_t hits = 0;
+            report("rb_tree/find_random", variant, time_per_op(n, [&]
+                                                               {
+                for (size_t i = n; i-- > 0;)
+                    hits += m.find(keys[i]) != m.end(); }));
+            do_not_optimize(hits);
+
+            long long sum = 0;
+            report("rb_tree/iterate", variant, time_per_op(m.size(), [&]
+                                                           {
+                for (auto &kv : m)
+                    sum += kv.second; }));
+            do_not_optimize(sum);
+        }
+    } // namespace bench
+} // namespace zstl
+
+// 节点大小：普通布局 vs 颜色压入父指针的紧凑布局
+ZSTL_BENCH(rb_tree_node_memory)
+{
+    using namespace zstl;
+    using value = std::pair<const int, int>;
+    constexpr double nodes = 50e6;
+    bench::report_value("rb_tree/node_bytes<int,int>", "RBNode", sizeof(RBNode<value>), "bytes");
+    bench::report_value("rb_tree/node_bytes<int,int>", "RBCompactNode", sizeof(RBCompactNode<value>), "bytes");
+    bench::report_value("rb_tree/50M_nodes<int,int>", "RBNode", sizeof(RBNode<value>) * nodes / (1 << 20), "MiB");
+    bench::report_value("rb_tree/50M_nodes<int,int>", "RBCompactNode", sizeof(RBCompactNode<value>) * nodes / (1 << 20), "MiB");
+}
+
+// 查找/插入/遍历速度：map vs compact_map
+ZSTL_BENCH(rb_tree_compact_lookup)
+{
+    using namespace zstl;
+    static int keys[bench::RB_TREE_N];
+    bench::make_tree_keys(keys, bench::RB_TREE_N);
+    bench::run_tree_lookup<map<int, int>>("map", keys, bench::RB_TREE_N);
+    bench::run_tree_lookup<compact_map<int, int>>("compact_map", keys, bench::RB_TREE_N);
+}
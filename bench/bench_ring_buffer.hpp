@@ -0,0 +1,51 @@
+#pragma once
+#include <deque>
+#include "bench.hpp"
+#include "../container/ring_buffer.hpp"
+#include "../container/deque.hpp"
+#include "../container/queue.hpp"
+
+namespace zstl
+{
+    namespace bench
+    {
+        inline constexpr size_t RING_OPS = 4000000;
+
+        // 有界队列负载：深度在 [0, depth) 间往复，push 与 pop 交错
+        template <typename Q>
+        double bounded_queue_ns(size_t depth)
+        {
+            return time_per_op(RING_OPS, [&]
+                               {
+                Q q;
+                long long sum = 0;
+                for (size_t i = 0; i < RING_OPS; ++i)
+                {
+                    q.push(static_cast<int>(i));
+                    if (q.size() == depth)
+                    {
+                        while (!q.empty())
+                        {
+                            sum += q.front();
+                            q.pop();
+                        }
+                    }
+                }
+                do_not_optimize(sum); });
+        }
+    } // namespace bench
+} // namespace zstl
+
+// queue 底层容器：ring_buffer vs deque vs std::deque
+ZSTL_BENCH(ring_buffer_queue)
+{
+    using namespace zstl;
+    for (size_t depth : {16, 256, 4096})
+    {
+        char name[64];
+        std::snprintf(name, sizeof(name), "queue<int>/depth=%zu", depth);
+        bench::report(name, "ring_buffer", bench::bounded_queue_ns<queue<int, ring_buffer<int>>>(depth));
+        bench::report(name, "deque", bench::bounded_queue_ns<queue<int>>(depth));
+        bench::report(name, "std::deque", bench::bounded_queue_ns<queue<int, std::deque<int>>>(depth));
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include <string>
+#include "bench.hpp"
+#include "../container/string.hpp"
+#include "../container/rope.hpp"
+
+namespace zstl
+{
+    namespace bench
+    {
+        inline constexpr size_t ROPE_BUILD_BYTES = 8 << 20; // 拼接生成的响应大小
+        inline constexpr size_t ROPE_BASE_BYTES = 4 << 20;  // 中间插入 / 删除的初始文本大小
+        inline constexpr size_t ROPE_PIECE = 64;           // 每次拼接 / 插入的片段长度
+        inline constexpr size_t ROPE_EDITS = 2000;         // 中间编辑次数
+
+        // 反复追加短片段
+        template <typename S>
+        double rope_build(const std::string &piece)
+        {
+            size_t ops = ROPE_BUILD_BYTES / piece.size();
+            return time_per_op(ops, [&]
+                               {
+                S s;
+                for (size_t i = 0; i < ops; ++i)
+                    s.append(piece.data(), piece.size());
+                do_not_optimize(s.size()); });
+        }
+
+        // 在随机位置插入片段再删除等长的一段，文本长度保持不变
+        template <typename S>
+        double rope_edit(const std::string &base, const std::string &piece)
+        {
+            S s(base.data(), base.size());
+            Random rng(3);
+            return time_per_op(ROPE_EDITS, [&]
+                               {
+                for (size_t i = 0; i < ROPE_EDITS; ++i)
+                {
+                    size_t pos = rng.uniform(s.size() - piece.size());
+                    s.insert(pos, piece.data(), piece.size());
+                    s.erase(rng.uniform(s.size() - piece.size()), piece.size());
+                }
+                do_not_optimize(s.size()); });
+        }
+    } // namespace bench
+} // namespace zstl
+
+// 大响应的构造与中间编辑：zstl::string / std::string 搬移整段尾部，rope 只新建 O(log n) 个节点
+ZSTL_BENCH(rope_edit)
+{
+    using namespace zstl::bench;
+    std::string piece(ROPE_PIECE, 'r');
+    std::string base(ROPE_BASE_BYTES, 'b');
+
+    report("rope/append 64B", "zstl::string", rope_build<zstl::string>(piece));
+    report("rope/append 64B", "std::string", rope_build<std::string>(piece));
+    report("rope/append 64B", "zstl::rope", rope_build<zstl::rope>(piece));
+
+    report("rope/insert+erase middle 4MB", "zstl::string", rope_edit<zstl::string>(base, piece));
+    report("rope/insert+erase middle 4MB", "std::string", rope_edit<std::string>(base, piece));
+    report("rope/insert+erase middle 4MB", "zstl::rope", rope_edit<zstl::rope>(base, piece));
+
+    // 取 1 MB 子串：字符串复制，rope 引用原叶子
+    zstl::string s(base.c_str());
+    zstl::rope r(base.data(), base.size());
+    size_t sink = 0;
+    report("rope/substr 1MB", "zstl::string", time_per_op(100, [&]
+                                                          {
+        for (size_t i = 0; i < 100; ++i)
+            sink += s.substr(i * 1000, 1 << 20).size(); }));
+    report("rope/substr 1MB", "zstl::rope", time_per_op(100, [&]
+                                                        {
+        for (size_t i = 0; i < 100; ++i)
+            sink += r.substr(i * 1000, 1 << 20).size(); }));
+
+    // 编辑后的整体输出：逐块遍历（writev）与拷贝成连续字符串
+    zstl::rope edited(base.data(), base.size());
+    Random rng(5);
+    for (size_t i = 0; i < ROPE_EDITS; ++i)
+        edited.insert(rng.uniform(edited.size()), piece.data(), piece.size());
+    size_t chunks = 0;
+    report_value("rope/chunks after edits", "zstl::rope", time_per_op(1, [&]
+                                                                      {
+        for (auto it = edited.chunk_begin(); it != edited.chunk_end(); ++it)
+            ++chunks; }), "ns");
+    report_value("rope/to_string 4MB", "zstl::rope", time_per_op(1, [&]
+                                                                 { sink += edited.to_string().size(); }) / 1e3, "us");
+    do_not_optimize(sink + chunks);
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "bench.hpp"
+#include "../container/small_vector.hpp"
+
+namespace zstl
+{
+    namespace bench
+    {
+        inline constexpr size_t SMALL_VECTOR_ROUNDS = 1000000;
+
+        // 统计分配次数的分配器
+        template <typename T>
+        struct CountingAlloc : alloc<T>
+        {
+            static inline size_t allocations = 0;
+
+            template <typename U>
+            struct rebind
+            {
+                using other = CountingAlloc<U>;
+            };
+
+            static T *allocate(size_t n)
+            {
+                ++allocations;
+                return alloc<T>::allocate(n);
+            }
+        };
+
+        // 反复构造短生命周期的容器，每个容器放入 1..max_len 个元素
+        template <typename Vec>
+        void run_short_lived(const char *variant, size_t max_len)
+        {
+            using A = CountingAlloc<int>;
+            A::allocations = 0;
+            Random rng(7);
+            long long sum = 0;
+            double ns = time_per_op(SMALL_VECTOR_ROUNDS, [&]
+                                    {
+                for (size_t r = 0; r < SMALL_VECTOR_ROUNDS; ++r)
+                {
+                    Vec v;
+                    size_t len = 1 + rng.uniform(max_len);
+                    for (size_t i = 0; i < len; ++i)
+                        v.push_back(static_cast<int>(i));
+                    sum += v.back();
+                } });
+            do_not_optimize(sum);
+            report("small_vector/short_lived<int>", variant, ns);
+            report_value("small_vector/allocs_per_container", variant,
+                         static_cast<double>(A::allocations) / SMALL_VECTOR_ROUNDS, "allocs");
+        }
+    } // namespace bench
+} // namespace zstl
+
+// 短生命周期小容器：vector 每次都要分配，small_vector 只在溢出时分配
+ZSTL_BENCH(small_vector_short_lived)
+{
+    using namespace zstl;
+    using A = bench::CountingAlloc<int>;
+    bench::run_short_lived<vector<int, A>>("vector len<=8", 8);
+    bench::run_short_lived<small_vector<int, 8, A>>("small_vector<8> len<=8", 8);
+    bench::run_short_lived<vector<int, A>>("vector len<=16", 16);
+    bench::run_short_lived<small_vector<int, 8, A>>("small_vector<8> len<=16", 16);
+}
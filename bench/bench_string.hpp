@@ -0,0 +1,125 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "bench.hpp"
+#include "../container/string.hpp"
+#include "../container/map.hpp"
+#include "../container/unordered_map.hpp"
+#include "../functor/functional.hpp"
+
+namespace zstl
+{
+    namespace bench
+    {
+        inline constexpr size_t STRING_KEYS = 100000;
+
+        // 生成 n 个长度为 len 的不同键：前缀 + 十进制编号，编号补零到固定长度
+        inline std::vector<std::string> make_keys(size_t n, size_t len)
+        {
+            std::vector<std::string> keys;
+            keys.reserve(n);
+            Random rng(len);
+            for (size_t i = 0; i < n; ++i)
+            {
+                std::string k(len, 'k');
+                size_t v = rng.uniform(1000000000);
+                for (size_t p = len; p > 0 && v; --p, v /= 10)
+                    k[p - 1] = static_cast<char>('0' + v % 10);
+                k[0] = static_cast<char>('a' + i % 26);
+                keys.push_back(std::move(k));
+            }
+            return keys;
+        }
+
+        template <typename S>
+        void string_suite(const char *variant, const std::vector<std::string> &src, const char *len_tag)
+        {
+            size_t n = src.size();
+            char name[64];
+            std::vector<S> keys;
+            keys.reserve(n);
+
+            std::snprintf(name, sizeof(name), "string/construct/%s", len_tag);
+            report(name, variant, time_per_op(n, [&]
+                                              {
+                for (size_t i = 0; i < n; ++i)
+                    keys.emplace_back(src[i].c_str()); }));
+
+            std::vector<S> copies;
+            copies.reserve(n);
+            std::snprintf(name, sizeof(name), "string/copy/%s", len_tag);
+            report(name, variant, time_per_op(n, [&]
+                                              {
+                for (size_t i = 0; i < n; ++i)
+                    copies.push_back(keys[i]); }));
+
+            std::snprintf(name, sizeof(name), "string/compare/%s", len_tag);
+            size_t less = 0;
+            report(name, variant, time_per_op(n, [&]
+                                              {
+                for (size_t i = 0; i + 1 < n; ++i)
+                    less += keys[i] < keys[i + 1]; }));
+            do_not_optimize(less);
+
+            std::snprintf(name, sizeof(name), "string/map_key/%s", len_tag);
+            report(name, variant, time_per_op(2 * n, [&]
+                                              {
+                map<S, int> m;
+                for (size_t i = 0; i < n; ++i)
+                    m.insert({keys[i], static_cast<int>(i)});
+                size_t hits = 0;
+                for (size_t i = 0; i < n; ++i)
+                    hits += m.find(copies[i]) != m.end();
+                do_not_optimize(hits); }));
+        }
+
+        // unordered_map 需要 zstl::hash 特化，只对 zstl::string 运行；std::string 用同一散列函数对照
+        struct std_string_hash
+        {
+            size_t operator()(const std::string &s) const noexcept
+            {
+                size_t h = 0;
+                for (auto c : s)
+                    h = h * 131 + c;
+                return h;
+            }
+        };
+
+        template <typename S, typename Hash>
+        void string_hash_key(const char *variant, const std::vector<std::string> &src, const char *len_tag)
+        {
+            size_t n = src.size();
+            std::vector<S> keys;
+            keys.reserve(n);
+            for (size_t i = 0; i < n; ++i)
+                keys.emplace_back(src[i].c_str());
+            char name[64];
+            std::snprintf(name, sizeof(name), "string/unordered_map_key/%s", len_tag);
+            report(name, variant, time_per_op(2 * n, [&]
+                                              {
+                unordered_map<S, int, Hash> m;
+                for (size_t i = 0; i < n; ++i)
+                    m.insert({keys[i], static_cast<int>(i)});
+                size_t hits = 0;
+                for (size_t i = 0; i < n; ++i)
+                    hits += m.find(keys[i]) != m.end();
+                do_not_optimize(hits); }));
+        }
+    } // namespace bench
+} // namespace zstl
+
+// 短键（落在内部缓冲区）与长键（必须分配）下的构造、拷贝、比较与作为键使用
+ZSTL_BENCH(string_sso)
+{
+    using namespace zstl::bench;
+    for (size_t len : {8, 15, 32})
+    {
+        char tag[16];
+        std::snprintf(tag, sizeof(tag), "len=%zu", len);
+        auto src = make_keys(STRING_KEYS, len);
+        string_suite<zstl::string>("zstl::string", src, tag);
+        string_suite<std::string>("std::string", src, tag);
+        string_hash_key<zstl::string, zstl::hash<zstl::string>>("zstl::string", src, tag);
+        string_hash_key<std::string, std_string_hash>("std::string", src, tag);
+    }
+}
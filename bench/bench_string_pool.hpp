@@ -0,0 +1,87 @@
+#pragma once
+#include <vector>
+#include "bench.hpp"
+#include "../container/string.hpp"
+#include "../container/string_pool.hpp"
+#include "../container/unordered_map.hpp"
+#include "../container/map.hpp"
+#include "../functor/functional.hpp"
+
+namespace zstl
+{
+    namespace bench
+    {
+        inline constexpr size_t POOL_RECORDS = 1000000; // 遥测记录数
+        inline constexpr size_t POOL_TAGS = 4000;       // 不同标签值个数
+
+        // 形如 "region=..,service=..,host=.." 的标签，长度超过短串缓冲区
+        inline std::vector<zstl::string> make_tags()
+        {
+            std::vector<zstl::string> tags;
+            char buf[96];
+            for (size_t i = 0; i < POOL_TAGS; ++i)
+            {
+                std::snprintf(buf, sizeof(buf), "region=eu-%zu,service=svc-%zu,host=node-%05zu", i % 7, i % 113, i);
+                tags.emplace_back(buf);
+            }
+            return tags;
+        }
+    } // namespace bench
+} // namespace zstl
+
+// 百万条记录取自几千个标签：保存副本 vs 驻留句柄，以及按标签计数
+ZSTL_BENCH(string_pool)
+{
+    using namespace zstl::bench;
+    auto tags = make_tags();
+    Random rng(9);
+    std::vector<uint32_t> pick(POOL_RECORDS);
+    for (auto &p : pick)
+        p = static_cast<uint32_t>(rng.uniform(POOL_TAGS));
+
+    std::vector<zstl::string> copies;
+    copies.reserve(POOL_RECORDS);
+    report("string_pool/store record", "zstl::string copy", time_per_op(POOL_RECORDS, [&]
+                                                                           {
+        for (uint32_t p : pick)
+            copies.push_back(tags[p]); }));
+
+    zstl::string_pool pool;
+    std::vector<zstl::interned_string> handles;
+    handles.reserve(POOL_RECORDS);
+    report("string_pool/store record", "interned_string", time_per_op(POOL_RECORDS, [&]
+                                                                         {
+        for (uint32_t p : pick)
+            handles.push_back(pool.intern(tags[p])); }));
+
+    size_t copy_bytes = 0;
+    for (auto &s : copies)
+        copy_bytes += s.capacity() + 1;
+    report_value("string_pool/char bytes", "zstl::string copy", copy_bytes / 1048576.0, "MiB");
+    report_value("string_pool/char bytes", "interned_string", pool.arena_bytes() / 1048576.0, "MiB");
+
+    report("string_pool/count by tag", "unordered_map<string>", time_per_op(POOL_RECORDS, [&]
+                                                                               {
+        zstl::unordered_map<zstl::string, int> m;
+        for (auto &s : copies)
+            ++m[s];
+        do_not_optimize(m.size()); }));
+    report("string_pool/count by tag", "unordered_map<interned>", time_per_op(POOL_RECORDS, [&]
+                                                                                 {
+        zstl::unordered_map<zstl::interned_string, int> m;
+        for (auto h : handles)
+            ++m[h];
+        do_not_optimize(m.size()); }));
+    report("string_pool/count by tag", "map<string>", time_per_op(POOL_RECORDS, [&]
+                                                                     {
+        zstl::map<zstl::string, int> m;
+        for (auto &s : copies)
+            ++m[s];
+        do_not_optimize(m.size()); }));
+    report("string_pool/count by tag", "map<interned>", time_per_op(POOL_RECORDS, [&]
+                                                                       {
+        zstl::map<zstl::interned_string, int> m;
+        for (auto h : handles)
+            ++m[h];
+        do_not_optimize(m.size()); }));
+}
@@ -0,0 +1,195 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include "bench.hpp"
+#include "../container/string.hpp"
+
+namespace zstl
+{
+    namespace bench
+    {
+        inline constexpr size_t LOG_BYTES = 4 << 20;
+
+        // 生成类似服务日志的文本：时间戳、级别、键值对与消息
+        inline std::string make_log_text(size_t bytes)
+        {
+            static const char *levels[] = {"INFO", "INFO", "INFO", "DEBUG", "WARN"};
+            static const char *words[] = {"request", "served", "user", "cache", "miss", "hit", "upstream",
+                                          "latency", "bytes", "session", "token", "refresh", "db", "query"};
+            Random rng(42);
+            std::string text;
+            text.reserve(bytes + 256);
+            char buf[64];
+            while (text.size() < bytes)
+            {
+                std::snprintf(buf, sizeof(buf), "2024-05-%02u 12:%02u:%02u.%03u ",
+                              unsigned(rng.uniform(28) + 1), unsigned(rng.uniform(60)),
+                              unsigned(rng.uniform(60)), unsigned(rng.uniform(1000)));
+                text += buf;
+                text += levels[rng.uniform(5)];
+                std::snprintf(buf, sizeof(buf), " req_id=%08x user=%u ", unsigned(rng.next()), unsigned(rng.uniform(100000)));
+                text += buf;
+                for (size_t w = 0, nw = 3 + rng.uniform(8); w < nw; ++w)
+                {
+                    text += words[rng.uniform(14)];
+                    text += ' ';
+                }
+                text += "status=200\n";
+            }
+            return text;
+        }
+
+        // 旧实现：逐位置比较
+        inline size_t naive_find(const char *h, size_t n, const char *s, size_t m)
+        {
+            for (size_t pos = 0; pos + m <= n; ++pos)
+                if (std::memcmp(h + pos, s, m) == 0)
+                    return pos;
+            return std::string::npos;
+        }
+
+        inline size_t naive_rfind(const char *h, size_t n, const char *s, size_t m)
+        {
+            for (size_t pos = n - m + 1; pos-- > 0;)
+                if (std::memcmp(h + pos, s, m) == 0)
+                    return pos;
+            return std::string::npos;
+        }
+
+        inline size_t naive_find_char(const char *h, size_t n, char c)
+        {
+            for (size_t pos = 0; pos < n; ++pos)
+                if (h[pos] == c)
+                    return pos;
+            return std::string::npos;
+        }
+
+        // 在整段文本上反复调用 f，返回扫描吞吐（GB/s）
+        template <typename F>
+        double scan_gbps(size_t bytes, F &&f)
+        {
+            Timer t;
+            f();
+            clobber_memory();
+            return bytes / t.elapsed_ns();
+        }
+    } // namespace bench
+} // namespace zstl
+
+// 4 MB 日志文本上的各类查找：旧的逐位置实现 vs zstl::string vs std::string
+ZSTL_BENCH(string_search)
+{
+    using namespace zstl::bench;
+    std::string ref = make_log_text(LOG_BYTES);
+    ref += "FATAL disk full\n"; // 只在末尾出现一次
+    zstl::string s(ref.c_str());
+    size_t n = ref.size();
+    size_t sink = 0;
+    // 预热：两份文本各完整扫描一次，避免首个用例承担缺页与缓存冷启动
+    for (int r = 0; r < 2; ++r)
+        sink += s.find('!') + ref.find('!');
+
+    report_value("string/find(char) rare", "naive", scan_gbps(n, [&]
+                                                               { sink += naive_find_char(ref.data(), n, '!'); }), "GB/s");
+    report_value("string/find(char) rare", "zstl::string", scan_gbps(n, [&]
+                                                                      { sink += s.find('!'); }), "GB/s");
+    report_value("string/find(char) rare", "std::string", scan_gbps(n, [&]
+                                                                     { sink += ref.find('!'); }), "GB/s");
+
+    // 逐行切分：反复查找换行符
+    report_value("string/find(char) per line", "zstl::string", scan_gbps(n, [&]
+                                                                          { for (size_t p = s.find('\n'); p != zstl::string::npos; p = s.find('\n', p + 1)) ++sink; }), "GB/s");
+    report_value("string/find(char) per line", "std::string", scan_gbps(n, [&]
+                                                                         { for (size_t p = ref.find('\n'); p != std::string::npos; p = ref.find('\n', p + 1)) ++sink; }), "GB/s");
+
+    const char *shortn = "FATAL disk";
+    report_value("string/find(short needle)", "naive", scan_gbps(n, [&]
+                                                                 { sink += naive_find(ref.data(), n, shortn, std::strlen(shortn)); }), "GB/s");
+    report_value("string/find(short needle)", "zstl::string", scan_gbps(n, [&]
+                                                                        { sink += s.find(shortn); }), "GB/s");
+    report_value("string/find(short needle)", "std::string", scan_gbps(n, [&]
+                                                                       { sink += ref.find(shortn); }), "GB/s");
+
+    // 与文本高度相似的长模式串：大量部分匹配
+    std::string longn = ref.substr(0, 120);
+    longn[110] = '#';
+    report_value("string/find(long needle)", "naive", scan_gbps(n, [&]
+                                                                { sink += naive_find(ref.data(), n, longn.c_str(), longn.size()); }), "GB/s");
+    report_value("string/find(long needle)", "zstl::string", scan_gbps(n, [&]
+                                                                       { sink += s.find(longn.c_str()); }), "GB/s");
+    report_value("string/find(long needle)", "std::string", scan_gbps(n, [&]
+                                                                      { sink += ref.find(longn); }), "GB/s");
+
+    report_value("string/rfind(char) rare", "zstl::string", scan_gbps(n, [&]
+                                                                       { sink += s.rfind('!'); }), "GB/s");
+    report_value("string/rfind(char) rare", "std::string", scan_gbps(n, [&]
+                                                                      { sink += ref.rfind('!'); }), "GB/s");
+    report_value("string/rfind(short needle)", "zstl::string", scan_gbps(n, [&]
+                                                                         { sink += s.rfind("2024-13"); }), "GB/s");
+    report_value("string/rfind(short needle)", "std::string", scan_gbps(n, [&]
+                                                                        { sink += ref.rfind("2024-13"); }), "GB/s");
+
+    report_value("string/rfind(long needle)", "naive", scan_gbps(n, [&]
+                                                                 { sink += naive_rfind(ref.data(), n, longn.c_str(), longn.size()); }), "GB/s");
+    report_value("string/rfind(long needle)", "zstl::string", scan_gbps(n, [&]
+                                                                        { sink += s.rfind(longn.c_str()); }), "GB/s");
+    report_value("string/rfind(long needle)", "std::string", scan_gbps(n, [&]
+                                                                       { sink += ref.rfind(longn); }), "GB/s");
+
+    // 全为 'a' 的文本中查找中间有一个 'b' 的模式串：每个位置首尾字符都匹配，逐位置比较要比到中间
+    std::string flat(1 << 20, 'a');
+    zstl::string zflat(flat.c_str());
+    std::string hard(200, 'a');
+    hard[100] = 'b';
+    report_value("string/rfind(a..b..a) 1MB of a", "naive", scan_gbps(flat.size(), [&]
+                                                                      { sink += naive_rfind(flat.data(), flat.size(), hard.c_str(), hard.size()); }), "GB/s");
+    report_value("string/rfind(a..b..a) 1MB of a", "zstl::string", scan_gbps(flat.size(), [&]
+                                                                             { sink += zflat.rfind(hard.c_str()); }), "GB/s");
+    report_value("string/rfind(a..b..a) 1MB of a", "std::string", scan_gbps(flat.size(), [&]
+                                                                            { sink += flat.rfind(hard); }), "GB/s");
+
+    report_value("string/find_first_of(3)", "zstl::string", scan_gbps(n, [&]
+                                                                      { sink += s.find_first_of("\"\t!"); }), "GB/s");
+    report_value("string/find_first_of(3)", "std::string", scan_gbps(n, [&]
+                                                                     { sink += ref.find_first_of("\"\t!"); }), "GB/s");
+    report_value("string/find_first_of(12)", "zstl::string", scan_gbps(n, [&]
+                                                                       { sink += s.find_first_of("\"\t!#$%&*+;<>"); }), "GB/s");
+    report_value("string/find_first_of(12)", "std::string", scan_gbps(n, [&]
+                                                                      { sink += ref.find_first_of("\"\t!#$%&*+;<>"); }), "GB/s");
+    report_value("string/find_last_of(3)", "zstl::string", scan_gbps(n, [&]
+                                                                     { sink += s.find_last_of("\"\t!"); }), "GB/s");
+    report_value("string/find_last_of(3)", "std::string", scan_gbps(n, [&]
+                                                                    { sink += ref.find_last_of("\"\t!"); }), "GB/s");
+
+    // 按空格切分整段文本：substr 每个字段都分配并拷贝，视图只记录指针与长度
+    report_value("string/tokenise", "zstl::string substr", scan_gbps(n, [&]
+                                                                      {
+        for (size_t b = 0, e; b < n; b = e + 1)
+        {
+            e = s.find(' ', b);
+            if (e == zstl::string::npos)
+                e = n;
+            sink += s.substr(b, e - b).size();
+        } }), "GB/s");
+    report_value("string/tokenise", "zstl::string_view", scan_gbps(n, [&]
+                                                                    {
+        zstl::string_view v = s;
+        for (size_t b = 0, e; b < n; b = e + 1)
+        {
+            e = v.find(' ', b);
+            if (e == zstl::string_view::npos)
+                e = n;
+            sink += v.substr(b, e - b).size();
+        } }), "GB/s");
+    report_value("string/tokenise", "std::string_view", scan_gbps(n, [&]
+                                                                   {
+        std::string_view v = ref;
+        for (size_t b = 0, e; b < n; b = e + 1)
+        {
+            e = v.find(' ', b);
+            if (e == std::string_view::npos)
+                e = n;
+            sink += v.substr(b, e - b).size();
+        } }), "GB/s");
+    do_not_optimize(sink);
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <vector>
+#include "bench.hpp"
+#include "../container/unrolled_list.hpp"
+#include "../container/list.hpp"
+#include "../container/deque.hpp"
+
+namespace zstl
+{
+    namespace bench
+    {
+        inline constexpr size_t UNROLLED_N = 1000000;     // 元素个数
+        inline constexpr size_t UNROLLED_CHURN = 1000000; // 删除后再插入的次数
+
+        template <typename C>
+        double time_sum(const C &c)
+        {
+            double best = 1e300;
+            for (int round = 0; round < 5; ++round)
+            {
+                double t = time_per_op(c.size(), [&]
+                                       {
+                    long sum = 0;
+                    for (int x : c)
+                        sum += x;
+                    do_not_optimize(sum); });
+                best = t < best ? t : best;
+            }
+            return best;
+        }
+
+        template <typename C, typename Insert>
+        double time_build(Insert insert)
+        {
+            return time_per_op(UNROLLED_N, [&]
+                               {
+                C c;
+                for (size_t i = 0; i < UNROLLED_N; ++i)
+                    insert(c, static_cast<int>(i));
+                do_not_optimize(c.size()); });
+        }
+
+        // 随机删除并插入新元素，迭代器 where 始终保存每个元素的位置
+        template <typename C, typename Insert>
+        double time_churn(C &c, std::vector<typename C::iterator> &where, const std::vector<uint32_t> &pick, Insert insert)
+        {
+            return time_per_op(pick.size(), [&]
+                               {
+                int v = 0;
+                for (uint32_t p : pick)
+                {
+                    c.erase(where[p]);
+                    where[p] = insert(c, v++);
+                }
+                do_not_optimize(c.size()); });
+        }
+    } // namespace bench
+} // namespace zstl
+
+// 分块链表：构建、遍历求和（新建 / 随机增删之后）与 O(1) 增删，对照 list 与 deque
+ZSTL_BENCH(unrolled_list)
+{
+    using namespace zstl::bench;
+    Random rng(51);
+    std::vector<uint32_t> pick(UNROLLED_CHURN);
+    for (auto &p : pick)
+        p = static_cast<uint32_t>(rng.uniform(UNROLLED_N));
+
+    report("unrolled/insert 1M", "unrolled_list", time_build<zstl::unrolled_list<int>>([](zstl::unrolled_list<int> &c, int v)
+                                                                                       { c.insert(v); }));
+    report("unrolled/insert 1M", "list", time_build<zstl::list<int>>([](zstl::list<int> &c, int v)
+                                                                     { c.push_back(v); }));
+    report("unrolled/insert 1M", "deque", time_build<zstl::deque<int>>([](zstl::deque<int> &c, int v)
+                                                                       { c.push_back(v); }));
+
+    zstl::unrolled_list<int> ul;
+    zstl::list<int> l;
+    zstl::deque<int> dq;
+    std::vector<zstl::unrolled_list<int>::iterator> ul_where;
+    std::vector<zstl::list<int>::iterator> l_where;
+    for (size_t i = 0; i < UNROLLED_N; ++i)
+    {
+        ul_where.push_back(ul.insert(static_cast<int>(i)));
+        l.push_back(static_cast<int>(i));
+        l_where.push_back(--l.end());
+        dq.push_back(static_cast<int>(i));
+    }
+
+    report("unrolled/iterate 1M fresh", "unrolled_list", time_sum(ul));
+    report("unrolled/iterate 1M fresh", "list", time_sum(l));
+    report("unrolled/iterate 1M fresh", "deque", time_sum(dq));
+
+    report("unrolled/erase+insert 1M", "unrolled_list", time_churn(ul, ul_where, pick, [](zstl::unrolled_list<int> &c, int v)
+                                                                   { return c.insert(v); }));
+    report("unrolled/erase+insert 1M", "list", time_churn(l, l_where, pick, [](zstl::list<int> &c, int v)
+                                                          { c.push_back(v); return --c.end(); }));
+
+    report("unrolled/iterate 1M after churn", "unrolled_list", time_sum(ul));
+    report("unrolled/iterate 1M after churn", "list", time_sum(l));
+}
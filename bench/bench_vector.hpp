@@ -0,0 +1,158 @@
+#pragma once
+#include <vector>
+#include "bench.hpp"
+#include "../container/vector.hpp"
+#include "../container/string.hpp"
+
+namespace zstl
+{
+    namespace bench
+    {
+        inline constexpr size_t VECTOR_GROW_N = 1000000;
+        inline constexpr size_t VECTOR_MID_N = 20000;
+
+        // 64 字节的 POD 记录
+        struct PodRecord
+        {
+            long long fields[8];
+        };
+
+        // 从空容器开始 push_back n 个元素，包含全部扩容开销
+        template <typename Vec, typename Make>
+        void run_vector_growth(const char *bench, const char *variant, size_t n, Make make)
+        {
+            report(bench, variant, time_per_op(n, [&]
+                                               {
+                Vec v;
+                for (size_t i = 0; i < n; ++i)
+                    v.push_back(make(i));
+                do_not_optimize(v.back()); }));
+        }
+
+        // 在中间位置反复插入再删除
+        template <typename Vec>
+        void run_vector_middle(const char *variant, size_t n)
+        {
+            Vec v;
+            for (size_t i = 0; i < n; ++i)
+                v.push_back(static_cast<int>(i));
+            report("vector/insert_middle<int>", variant, time_per_op(n, [&]
+                                                                    {
+                for (size_t i = 0; i < n; ++i)
+                    v.insert(v.begin() + v.size() / 2, static_cast<int>(i)); }));
+            report("vector/erase_middle<int>", variant, time_per_op(n, [&]
+                                                                   {
+                for (size_t i = 0; i < n; ++i)
+                    v.erase(v.begin() + v.size() / 2); }));
+            do_not_optimize(v.size());
+        }
+    } // namespace bench
+} // namespace zstl
+
+// push_back 增长：平凡类型走 memcpy 重定位
+ZSTL_BENCH(vector_growth)
+{
+    using namespace zstl;
+    using bench::PodRecord;
+    constexpr size_t n = bench::VECTOR_GROW_N;
+    auto make_int = [](size_t i)
+    { return static_cast<int>(i); };
+    auto make_pod = [](size_t i)
+    { PodRecord r{}; r.fields[0] = static_cast<long long>(i); return r; };
+    auto make_str = [](size_t i)
+    { return string(std::to_string(i).c_str()); };
+    bench::run_vector_growth<vector<int>>("vector/push_back<int>", "zstl::vector", n, make_int);
+    bench::run_vector_growth<std::vector<int>>("vector/push_back<int>", "std::vector", n, make_int);
+    bench::run_vector_growth<vector<PodRecord>>("vector/push_back<pod64>", "zstl::vector", n, make_pod);
+    bench::run_vector_growth<std::vector<PodRecord>>("vector/push_back<pod64>", "std::vector", n, make_pod);
+    bench::run_vector_growth<vector<string>>("vector/push_back<string>", "zstl::vector", n, make_str);
+    bench::run_vector_growth<std::vector<string>>("vector/push_back<string>", "std::vector", n, make_str);
+}
+
+// 中间插入/删除：平凡类型走 memmove 整段搬移
+ZSTL_BENCH(vector_middle)
+{
+    using namespace zstl;
+    bench::run_vector_middle<vector<int>>("zstl::vector", bench::VECTOR_MID_N);
+    bench::run_vector_middle<std::vector<int>>("std::vector", bench::VECTOR_MID_N);
+}
+
+// 批量构建：逐个 push_back vs 一次 append_range
+ZSTL_BENCH(vector_bulk_append)
+{
+    using namespace zstl;
+    constexpr size_t n = bench::VECTOR_GROW_N;
+    static int batch[n];
+    for (size_t i = 0; i < n; ++i)
+        batch[i] = static_cast<int>(i);
+    bench::report("vector/build_from_batch<int>", "push_back loop", bench::time_per_op(n, [&]
+                                                                                      {
+        vector<int> v;
+        for (size_t i = 0; i < n; ++i)
+            v.push_back(batch[i]);
+        bench::do_not_optimize(v.back()); }));
+    bench::report("vector/build_from_batch<int>", "append_range", bench::time_per_op(n, [&]
+                                                                                    {
+        vector<int> v;
+        v.append_range(batch);
+        bench::do_not_optimize(v.back()); }));
+}
+
+// I/O 缓冲区：resize 先清零再覆写 vs 不初始化直接覆写
+ZSTL_BENCH(vector_resize_uninitialized)
+{
+    using namespace zstl;
+    constexpr size_t n = 1 << 24;
+    static char src[n];
+    std::memset(src, 'x', n);
+    bench::report("buffer/grow_and_fill<16MiB>", "vector::resize", bench::time_per_op(n, [&]
+                                                                                   {
+        vector<char> v;
+        v.resize(n);
+        std::memcpy(v.data(), src, n);
+        bench::do_not_optimize(v.back()); }));
+    bench::report("buffer/grow_and_fill<16MiB>", "vector::resize_uninitialized", bench::time_per_op(n, [&]
+                                                                                                {
+        vector<char> v;
+        v.resize_uninitialized(n);
+        std::memcpy(v.data(), src, n);
+        bench::do_not_optimize(v.back()); }));
+    bench::report("buffer/grow_and_fill<16MiB>", "string::resize", bench::time_per_op(n, [&]
+                                                                                   {
+        string s;
+        s.resize(n);
+        std::memcpy(s.data(), src, n);
+        bench::do_not_optimize(s.back()); }));
+    bench::report("buffer/grow_and_fill<16MiB>", "string::resize_and_overwrite", bench::time_per_op(n, [&]
+                                                                                                {
+        string s;
+        s.resize_and_overwrite(n, [&](char *p, size_t len)
+                               { std::memcpy(p, src, len); return len; });
+        bench::do_not_optimize(s.back()); }));
+}
+
+// 扩容策略：连续追加时各策略的耗时
+ZSTL_BENCH(growth_policy)
+{
+    using namespace zstl;
+    constexpr size_t n = bench::VECTOR_GROW_N;
+    auto make_int = [](size_t i)
+    { return static_cast<int>(i); };
+    bench::run_vector_growth<vector<int, alloc<int>, 0, growth_2x>>("growth/vector_push_back<int>", "growth_2x", n, make_int);
+    bench::run_vector_growth<vector<int, alloc<int>, 0, growth_1_5x>>("growth/vector_push_back<int>", "growth_1_5x", n, make_int);
+    bench::run_vector_growth<vector<int, alloc<int>, 0, growth_page>>("growth/vector_push_back<int>", "growth_page", n, make_int);
+
+    auto run_append = [&](auto tag, const char *variant)
+    {
+        using Str = decltype(tag);
+        bench::report("growth/string_append<3 chars>", variant, bench::time_per_op(n, [&]
+                                                                                   {
+            Str s;
+            for (size_t i = 0; i < n; ++i)
+                s.append("abc");
+            bench::do_not_optimize(s.size()); }));
+    };
+    run_append(basic_string<char, char_traits<char>, alloc<char>, growth_2x>(), "growth_2x");
+    run_append(basic_string<char, char_traits<char>, alloc<char>, growth_1_5x>(), "growth_1_5x");
+    run_append(basic_string<char, char_traits<char>, alloc<char>, growth_page>(), "growth_page");
+}
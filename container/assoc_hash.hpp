@@ -95,6 +95,24 @@ namespace zstl
             return hash_.equal_range(k);
         }
 
+        /**
+         * @brief 批量查找一组键，隐藏各次查找之间的内存延迟
+         * @param keys 待查找的键数组
+         * @param n    键的个数
+         * @param out  输出数组，out[i] 为 keys[i] 对应的迭代器，未找到时为 end()
+         * @note 多键容器中返回的是任意一个匹配元素
+         */
+        void find_batch(const key_type *keys, size_t n, iterator *out) const
+        {
+            hash_.find_batch(keys, n, out);
+        }
+
+        // 批量判断键是否存在，out[i] 对应 keys[i]
+        void contains_batch(const key_type *keys, size_t n, bool *out) const
+        {
+            hash_.contains_batch(keys, n, out);
+        }
+
         /**
          * @brief 统计键出现的次数
          * @param key 要统计的键值
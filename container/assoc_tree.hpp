@@ -15,8 +15,11 @@ namespace zstl
      * @tparam mapped_type     映射值类型。设为null_type时表示set容器
      * @tparam Compare    键比较函数对象类型
      * @tparam Unique     是否强制键唯一。true为类似std::set/map，false为类似multiset/map
+     * @tparam Augment    节点增强策略。RBSizeAugment 时额外提供 O(log n) 的顺序统计接口
+     * @tparam Compact    是否使用紧凑节点布局（颜色压入父指针最低位）
      */
-    template <typename Key, typename Mapped, typename Compare, typename Alloc, bool Unique>
+    template <typename Key, typename Mapped, typename Compare, typename Alloc, bool Unique,
+              typename Augment = RBNullAugment, bool Compact = false>
     class assoc_tree
     {
     public:
@@ -35,7 +38,10 @@ namespace zstl
             std::pair<const key_type, mapped_type>>;
 
         // 底层红黑树类型
-        using tree_type = RBTree<key_type, value_type, Compare, Alloc>;
+        using node_type = std::conditional_t<Compact,
+                                             RBCompactNode<value_type, Augment>,
+                                             RBNode<value_type, Augment>>;
+        using tree_type = RBTree<key_type, value_type, Compare, Alloc, node_type>;
 
         // set容器使用const_iterator禁止修改键值，map使用普通iterator允许修改value部分
         using const_iterator = typename tree_type::const_iterator;
@@ -110,6 +116,24 @@ namespace zstl
             return {lower_bound(k), upper_bound(k)};
         }
 
+        /**
+         * @brief 批量查找一组键，隐藏各次查找之间的内存延迟
+         * @param keys 待查找的键数组
+         * @param n    键的个数
+         * @param out  输出数组，out[i] 为 keys[i] 对应的迭代器，未找到时为 end()
+         * @note 多键容器中返回的是任意一个匹配元素
+         */
+        void find_batch(const key_type *keys, size_t n, iterator *out) const
+        {
+            tree_.find_batch(keys, n, out);
+        }
+
+        // 批量判断键是否存在，out[i] 对应 keys[i]
+        void contains_batch(const key_type *keys, size_t n, bool *out) const
+        {
+            tree_.contains_batch(keys, n, out);
+        }
+
         /**
          * @brief 统计键出现的次数
          * @param key 要统计的键值
@@ -118,11 +142,19 @@ namespace zstl
          */
         size_t count(const key_type &key) const
         {
-            auto p = equal_range(key);
-            size_t cnt = 0;
-            for (auto it = p.first; it != p.second; ++it)
-                ++cnt;
-            return cnt;
+            if constexpr (std::is_same_v<Augment, RBSizeAugment>)
+            {
+                // 借助子树大小，两次下降即可得到个数
+                return tree_.upper_rank(key) - tree_.lower_rank(key);
+            }
+            else
+            {
+                auto p = equal_range(key);
+                size_t cnt = 0;
+                for (auto it = p.first; it != p.second; ++it)
+                    ++cnt;
+                return cnt;
+            }
         }
 
         /* 删除操作 */
@@ -201,6 +233,50 @@ namespace zstl
             return it->second;
         }
 
+        /* 顺序统计（仅适用于 Augment 为 RBSizeAugment 的情况） */
+
+        /**
+         * @brief 按序访问第 k 小的元素
+         * @param k 从 0 开始的下标
+         * @return 指向该元素的迭代器，k >= size() 时返回 end()
+         */
+        template <typename A = Augment>
+        std::enable_if_t<std::is_same_v<A, RBSizeAugment>, iterator>
+        nth_element_at(size_t k)
+        {
+            return tree_.select(k);
+        }
+        template <typename A = Augment>
+        std::enable_if_t<std::is_same_v<A, RBSizeAugment>, const_iterator>
+        nth_element_at(size_t k) const
+        {
+            return const_iterator(tree_.select(k));
+        }
+
+        /**
+         * @brief 返回严格小于 key 的元素个数
+         * @note 对于存在的键即为其在有序序列中的下标
+         */
+        template <typename A = Augment>
+        std::enable_if_t<std::is_same_v<A, RBSizeAugment>, size_t>
+        rank(const key_type &key) const
+        {
+            return tree_.lower_rank(key);
+        }
+
+        /**
+         * @brief 统计键落在左闭右开区间 [lo, hi) 内的元素个数
+         * @return lo 不小于 hi 时返回 0
+         */
+        template <typename A = Augment>
+        std::enable_if_t<std::is_same_v<A, RBSizeAugment>, size_t>
+        count_range(const key_type &lo, const key_type &hi) const
+        {
+            size_t l = tree_.lower_rank(lo);
+            size_t r = tree_.lower_rank(hi);
+            return r > l ? r - l : 0;
+        }
+
         /* 其他操作 */
         void clear() noexcept { tree_.clear(); }
         void swap(assoc_tree &o) noexcept { tree_.swap(o.tree_); }
@@ -0,0 +1,89 @@
+#pragma once
+#include <cassert>
+#include <cstring>
+#include <cstddef>
+namespace zstl
+{
+    // 通用字符特性模板，提供字符类型的基本操作
+    template <class CharType>
+    struct char_traits
+    {
+        using char_type = CharType; // 字符类型别名
+
+        // 计算以终止符结尾的字符串长度
+        static size_t length(const char_type *str) noexcept
+        {
+            size_t len = 0;
+            for (; *str != char_type(0); ++str)
+                ++len;
+            return len;
+        }
+
+        // 按字典序比较两个字符串的前n个字符
+        static int compare(const char_type *s1, const char_type *s2, size_t n) noexcept
+        {
+            for (; n; --n, ++s1, ++s2)
+            {
+                if (*s1 < *s2)
+                    return -1;
+                if (*s2 < *s1)
+                    return 1;
+            }
+            return 0;
+        }
+
+        // 安全拷贝n个字符（要求源和目标内存不重叠）
+        static char_type *copy(char_type *dst, const char_type *src, size_t n) noexcept
+        {
+            assert(src + n <= dst || dst + n <= src);
+            char_type *r = dst;
+            for (; n; --n, ++dst, ++src)
+                *dst = *src;
+            return r;
+        }
+
+        // 安全移动n个字符（支持内存重叠情况）
+        static char_type *move(char_type *dst, const char_type *src, size_t n) noexcept
+        {
+            char_type *r = dst;
+            if (dst < src)
+            {
+                for (; n; --n, ++dst, ++src)
+                    *dst = *src;
+            }
+            else if (src < dst)
+            {
+                dst += n;
+                src += n;
+                for (; n; --n)
+                    *--dst = *--src;
+            }
+            return r;
+        }
+
+        // 用指定字符填充内存区域
+        static char_type *fill(char_type *dst, char_type ch, size_t count) noexcept
+        {
+            char_type *r = dst;
+            for (; count; --count, ++dst)
+                *dst = ch;
+            return r;
+        }
+    };
+
+    // char类型特化版本，使用标准库函数优化性能
+    template <>
+    struct char_traits<char>
+    {
+        using char_type = char;
+        static size_t length(const char_type *str) noexcept { return strlen(str); }
+        static int compare(const char_type *s1, const char_type *s2, size_t n) noexcept { return memcmp(s1, s2, n); }
+        static char_type *copy(char_type *dst, const char_type *src, size_t n) noexcept
+        {
+            assert(src + n <= dst || dst + n <= src);
+            return reinterpret_cast<char_type *>(memcpy(dst, src, n));
+        }
+        static char_type *move(char_type *dst, const char_type *src, size_t n) noexcept { return reinterpret_cast<char_type *>(memmove(dst, src, n)); }
+        static char_type *fill(char_type *dst, char_type ch, size_t count) noexcept { return reinterpret_cast<char_type *>(memset(dst, ch, count)); }
+    };
+} // namespace zstl
@@ -0,0 +1,443 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <thread>
+#include <cstdint>
+#include <utility>
+#include "../allocator/alloc.hpp"
+#include "../allocator/memory.hpp"
+#include "ring_buffer.hpp"
+
+namespace zstl
+{
+    inline constexpr size_t CACHE_LINE_SIZE = 64; // 按缓存行隔离生产者与消费者各自写的字段
+    inline constexpr int QUEUE_SPIN_LIMIT = 128;  // 阻塞等待前的自旋次数
+    inline constexpr std::chrono::milliseconds QUEUE_WAIT_SLICE{10}; // 单次睡眠上限，醒来后重新检查
+
+    /**
+     * @brief 阻塞等待辅助：先自旋，仍不满足再挂到条件变量上
+     * @details 等待方登记 waiters_ 后在锁内检查 ready，通知方发布数据后检查 waiters_，
+     *          两侧各有一道 seq_cst 栅栏，保证至少一方看到另一方，不会丢失唤醒；
+     *          无人等待时通知只有一次栅栏和一次读
+     *          ready 只读原子变量；操作本身在锁外执行，因为它会通知另一个 QueueWaiter，
+     *          在锁内执行会与另一侧的等待方互相持锁死锁
+     */
+    class QueueWaiter
+    {
+    public:
+        // try_op 尝试完成操作并返回是否成功；ready 判断操作是否可能成功
+        template <typename TryOp, typename Ready>
+        void wait(TryOp try_op, Ready ready)
+        {
+            for (;;)
+            {
+                for (int i = 0; i < QUEUE_SPIN_LIMIT; ++i)
+                {
+                    if (try_op())
+                        return;
+                    std::this_thread::yield();
+                }
+                std::unique_lock<std::mutex> lock(mutex_);
+                waiters_.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                while (!ready())
+                    cv_.wait_for(lock, QUEUE_WAIT_SLICE);
+                waiters_.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        void notify()
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiters_.load(std::memory_order_relaxed) != 0)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                cv_.notify_all();
+            }
+        }
+
+    private:
+        std::atomic<int> waiters_{0};
+        std::mutex mutex_;
+        std::condition_variable cv_;
+    };
+
+    /**
+     * @brief 有界单生产者单消费者队列
+     * @details 容量取 2 的幂，读写下标单调递增、取模定位槽位；
+     *          head_ / tail_ 各占一个缓存行，另一方的下标在本地缓存，
+     *          只有看起来满（空）时才重新读取对方的原子变量
+     *          只允许一个线程调用 push 系列，一个线程调用 pop 系列
+     */
+    template <typename T, typename Alloc = alloc<T>>
+    class spsc_queue
+    {
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+        using traits_allocator = allocator_traits<allocator_type>;
+        using pointer = typename traits_allocator::pointer;
+        using size_type = size_t;
+
+    public:
+        explicit spsc_queue(size_type capacity, const allocator_type &alloc = allocator_type())
+            : alloc_(alloc), mask_(ring_capacity_for(capacity) - 1)
+        {
+            buf_ = traits_allocator::allocate(alloc_, mask_ + 1);
+        }
+
+        spsc_queue(const spsc_queue &) = delete;
+        spsc_queue &operator=(const spsc_queue &) = delete;
+
+        ~spsc_queue()
+        {
+            size_type tail = tail_.load(std::memory_order_relaxed);
+            for (size_type h = head_.load(std::memory_order_relaxed); h != tail; ++h)
+                traits_allocator::destroy(alloc_, buf_ + (h & mask_));
+            traits_allocator::deallocate(alloc_, buf_, mask_ + 1);
+        }
+
+        // 生产者：满时返回 false
+        template <typename... Args>
+        bool try_emplace(Args &&...args)
+        {
+            size_type tail = tail_.load(std::memory_order_relaxed);
+            if (tail - head_cache_ > mask_)
+            {
+                head_cache_ = head_.load(std::memory_order_acquire);
+                if (tail - head_cache_ > mask_)
+                    return false;
+            }
+            traits_allocator::construct(alloc_, buf_ + (tail & mask_), std::forward<Args>(args)...);
+            tail_.store(tail + 1, std::memory_order_release);
+            not_empty_.notify();
+            return true;
+        }
+
+        bool try_push(const T &val) { return try_emplace(val); }
+        bool try_push(T &&val) { return try_emplace(std::move(val)); }
+
+        // 生产者：满时等待
+        void push(const T &val)
+        {
+            not_full_.wait([&]
+                           { return try_emplace(val); },
+                           [&]
+                           { return !full_approx(); });
+        }
+        void push(T &&val)
+        {
+            not_full_.wait([&]
+                           { return try_emplace(std::move(val)); },
+                           [&]
+                           { return !full_approx(); });
+        }
+
+        // 消费者：空时返回 false
+        bool try_pop(T &out)
+        {
+            size_type head = head_.load(std::memory_order_relaxed);
+            if (head == tail_cache_)
+            {
+                tail_cache_ = tail_.load(std::memory_order_acquire);
+                if (head == tail_cache_)
+                    return false;
+            }
+            pointer p = buf_ + (head & mask_);
+            out = std::move(*p);
+            traits_allocator::destroy(alloc_, p);
+            head_.store(head + 1, std::memory_order_release);
+            not_full_.notify();
+            return true;
+        }
+
+        // 消费者：空时等待
+        void pop(T &out)
+        {
+            not_empty_.wait([&]
+                            { return try_pop(out); },
+                            [&]
+                            { return !empty(); });
+        }
+
+        /**
+         * @brief 批量入队 [first, first + n) 中能放下的前若干个
+         * @return 实际入队个数；整批只发布一次 tail_、只通知一次
+         */
+        template <typename InputIt>
+        size_type try_push_batch(InputIt first, size_type n)
+        {
+            size_type tail = tail_.load(std::memory_order_relaxed);
+            size_type free = mask_ + 1 - (tail - head_cache_);
+            if (free < n)
+            {
+                head_cache_ = head_.load(std::memory_order_acquire);
+                free = mask_ + 1 - (tail - head_cache_);
+            }
+            size_type k = free < n ? free : n;
+            for (size_type i = 0; i < k; ++i, ++first)
+                traits_allocator::construct(alloc_, buf_ + ((tail + i) & mask_), *first);
+            if (k)
+            {
+                tail_.store(tail + k, std::memory_order_release);
+                not_empty_.notify();
+            }
+            return k;
+        }
+
+        /**
+         * @brief 批量出队至多 n 个到 out
+         * @return 实际出队个数；整批只发布一次 head_、只通知一次
+         */
+        template <typename OutputIt>
+        size_type try_pop_batch(OutputIt out, size_type n)
+        {
+            size_type head = head_.load(std::memory_order_relaxed);
+            size_type avail = tail_cache_ - head;
+            if (avail < n)
+            {
+                tail_cache_ = tail_.load(std::memory_order_acquire);
+                avail = tail_cache_ - head;
+            }
+            size_type k = avail < n ? avail : n;
+            for (size_type i = 0; i < k; ++i, ++out)
+            {
+                pointer p = buf_ + ((head + i) & mask_);
+                *out = std::move(*p);
+                traits_allocator::destroy(alloc_, p);
+            }
+            if (k)
+            {
+                head_.store(head + k, std::memory_order_release);
+                not_full_.notify();
+            }
+            return k;
+        }
+
+        // 近似大小：并发修改时仅供参考
+        [[nodiscard]] size_type size_approx() const noexcept
+        {
+            size_type head = head_.load(std::memory_order_acquire); // 先读 head_，保证差值不为负
+            return tail_.load(std::memory_order_acquire) - head;
+        }
+        [[nodiscard]] bool empty() const noexcept { return size_approx() == 0; }
+        [[nodiscard]] bool full_approx() const noexcept { return size_approx() > mask_; }
+        [[nodiscard]] size_type capacity() const noexcept { return mask_ + 1; }
+
+    private:
+        // 消费者写的字段
+        alignas(CACHE_LINE_SIZE) std::atomic<size_type> head_{0};
+        size_type tail_cache_ = 0; // 消费者看到的 tail_
+        // 生产者写的字段
+        alignas(CACHE_LINE_SIZE) std::atomic<size_type> tail_{0};
+        size_type head_cache_ = 0; // 生产者看到的 head_
+        // 只读字段
+        alignas(CACHE_LINE_SIZE) allocator_type alloc_;
+        pointer buf_;
+        size_type mask_;
+        QueueWaiter not_empty_; // 消费者在此等待
+        QueueWaiter not_full_;  // 生产者在此等待
+    };
+
+    // mpmc_queue 的槽位：seq 表示该槽位当前可供哪一轮的生产者 / 消费者使用
+    template <typename T>
+    struct MPMCCell
+    {
+        std::atomic<size_t> seq;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T *value() { return reinterpret_cast<T *>(storage); }
+    };
+
+    /**
+     * @brief 有界多生产者多消费者队列（每个槽位带序号的环形数组）
+     * @details 生产者 CAS 推进 tail_ 认领槽位，写入后把槽位序号置为 pos + 1；
+     *          消费者 CAS 推进 head_，读出后把序号置为 pos + 容量，供下一轮生产者使用
+     *          批量接口逐个认领槽位，省去的是调用方循环与唤醒次数
+     */
+    template <typename T, typename Alloc = alloc<T>>
+    class mpmc_queue
+    {
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+        using size_type = size_t;
+
+    private:
+        using cell_type = MPMCCell<T>;
+        using cell_allocator_type = typename allocator_traits<allocator_type>::template rebind_alloc<cell_type>;
+        using cell_traits = allocator_traits<cell_allocator_type>;
+
+    public:
+        explicit mpmc_queue(size_type capacity, const allocator_type &alloc = allocator_type())
+            : alloc_(alloc), mask_(ring_capacity_for(capacity < 2 ? 2 : capacity) - 1)
+        {
+            cells_ = cell_traits::allocate(alloc_, mask_ + 1);
+            for (size_type i = 0; i <= mask_; ++i)
+                ::new (static_cast<void *>(&cells_[i].seq)) std::atomic<size_type>(i);
+        }
+
+        mpmc_queue(const mpmc_queue &) = delete;
+        mpmc_queue &operator=(const mpmc_queue &) = delete;
+
+        ~mpmc_queue()
+        {
+            size_type tail = tail_.load(std::memory_order_relaxed);
+            for (size_type h = head_.load(std::memory_order_relaxed); h != tail; ++h)
+                cells_[h & mask_].value()->~T();
+            for (size_type i = 0; i <= mask_; ++i)
+                cells_[i].seq.~atomic();
+            cell_traits::deallocate(alloc_, cells_, mask_ + 1);
+        }
+
+        // 满时返回 false
+        template <typename... Args>
+        bool try_emplace(Args &&...args)
+        {
+            if (!emplace_one(std::forward<Args>(args)...))
+                return false;
+            not_empty_.notify();
+            return true;
+        }
+
+        bool try_push(const T &val) { return try_emplace(val); }
+        bool try_push(T &&val) { return try_emplace(std::move(val)); }
+
+        void push(const T &val)
+        {
+            not_full_.wait([&]
+                           { return try_emplace(val); },
+                           [&]
+                           { return !full_approx(); });
+        }
+        void push(T &&val)
+        {
+            not_full_.wait([&]
+                           { return try_emplace(std::move(val)); },
+                           [&]
+                           { return !full_approx(); });
+        }
+
+        // 空时返回 false
+        bool try_pop(T &out)
+        {
+            if (!pop_one(out))
+                return false;
+            not_full_.notify();
+            return true;
+        }
+
+        void pop(T &out)
+        {
+            not_empty_.wait([&]
+                            { return try_pop(out); },
+                            [&]
+                            { return !empty(); });
+        }
+
+        // 批量入队，返回实际个数，只通知一次
+        template <typename InputIt>
+        size_type try_push_batch(InputIt first, size_type n)
+        {
+            size_type k = 0;
+            for (; k < n; ++k, ++first)
+            {
+                if (!emplace_one(*first))
+                    break;
+            }
+            if (k)
+                not_empty_.notify();
+            return k;
+        }
+
+        // 批量出队，返回实际个数，只通知一次
+        template <typename OutputIt>
+        size_type try_pop_batch(OutputIt out, size_type n)
+        {
+            size_type k = 0;
+            for (; k < n; ++k, ++out)
+            {
+                if (!pop_one(*out))
+                    break;
+            }
+            if (k)
+                not_full_.notify();
+            return k;
+        }
+
+        [[nodiscard]] size_type size_approx() const noexcept
+        {
+            size_type tail = tail_.load(std::memory_order_acquire);
+            size_type head = head_.load(std::memory_order_acquire);
+            return tail > head ? tail - head : 0;
+        }
+        [[nodiscard]] bool empty() const noexcept { return size_approx() == 0; }
+        [[nodiscard]] bool full_approx() const noexcept { return size_approx() > mask_; }
+        [[nodiscard]] size_type capacity() const noexcept { return mask_ + 1; }
+
+    private:
+        // 不通知的单个入队
+        template <typename... Args>
+        bool emplace_one(Args &&...args)
+        {
+            size_type pos = tail_.load(std::memory_order_relaxed);
+            cell_type *cell;
+            for (;;)
+            {
+                cell = &cells_[pos & mask_];
+                size_type seq = cell->seq.load(std::memory_order_acquire);
+                auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+                if (diff == 0)
+                {
+                    if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                    return false; // 上一轮的消费者还没取走
+                else
+                    pos = tail_.load(std::memory_order_relaxed);
+            }
+            ::new (static_cast<void *>(cell->storage)) T(std::forward<Args>(args)...);
+            cell->seq.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // 不通知的单个出队
+        bool pop_one(T &out)
+        {
+            size_type pos = head_.load(std::memory_order_relaxed);
+            cell_type *cell;
+            for (;;)
+            {
+                cell = &cells_[pos & mask_];
+                size_type seq = cell->seq.load(std::memory_order_acquire);
+                auto diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+                if (diff == 0)
+                {
+                    if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                    return false; // 本轮生产者还没写入
+                else
+                    pos = head_.load(std::memory_order_relaxed);
+            }
+            T *p = cell->value();
+            out = std::move(*p);
+            p->~T();
+            cell->seq.store(pos + mask_ + 1, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        alignas(CACHE_LINE_SIZE) std::atomic<size_type> head_{0}; // 消费者竞争
+        alignas(CACHE_LINE_SIZE) std::atomic<size_type> tail_{0}; // 生产者竞争
+        alignas(CACHE_LINE_SIZE) cell_allocator_type alloc_;
+        cell_type *cells_;
+        size_type mask_;
+        QueueWaiter not_empty_;
+        QueueWaiter not_full_;
+    };
+}
@@ -0,0 +1,686 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include "../iterator/iterator.hpp"
+#include "../allocator/alloc.hpp"
+#include "../allocator/memory.hpp"
+
+namespace zstl
+{
+    // 自旋锁：临界区只有几次指针读写时比互斥量更轻量，满足 BasicLockable
+    class SpinLock
+    {
+    public:
+        void lock() noexcept
+        {
+            while (flag_.exchange(true, std::memory_order_acquire))
+            {
+                // 只读等待，避免反复写同一缓存行
+                while (flag_.load(std::memory_order_relaxed))
+                    std::this_thread::yield();
+            }
+        }
+
+        bool try_lock() noexcept
+        {
+            return !flag_.load(std::memory_order_relaxed) &&
+                   !flag_.exchange(true, std::memory_order_acquire);
+        }
+
+        void unlock() noexcept
+        {
+            flag_.store(false, std::memory_order_release);
+        }
+
+    private:
+        std::atomic<bool> flag_{false};
+    };
+
+    /**
+     * @brief 并发跳表节点
+     * @details 各层后继指针紧跟在节点之后一并分配，层数由 height_ 记录；
+     *          键值存放在未初始化的存储中，头节点不构造键值
+     */
+    template <typename T>
+    struct SkipListNode
+    {
+        using link_type = std::atomic<SkipListNode *>;
+
+        explicit SkipListNode(int height)
+            : height_(height), next_(reinterpret_cast<link_type *>(this + 1))
+        {
+            for (int i = 0; i < height_; ++i)
+                ::new (static_cast<void *>(next_ + i)) link_type(nullptr);
+        }
+
+        T &data() { return *reinterpret_cast<T *>(storage_); }
+        const T &data() const { return *reinterpret_cast<const T *>(storage_); }
+
+        // 既未被逻辑删除、又已在所有层链接完毕的节点才对读者可见
+        bool is_live() const
+        {
+            return fully_linked_.load(std::memory_order_acquire) &&
+                   !marked_.load(std::memory_order_acquire);
+        }
+
+        int height_;                                 // 层数
+        std::atomic<bool> marked_{false};            // 逻辑删除标记
+        std::atomic<bool> fully_linked_{false};      // 所有层均已链接
+        SpinLock lock_;                              // 写者修改本节点的后继时持有
+        SkipListNode *retired_next_ = nullptr;       // 待回收链表
+        link_type *next_;                            // 各层后继
+        alignas(T) unsigned char storage_[sizeof(T)]; // 键值
+    };
+
+    /**
+     * @brief 并发有序映射，基于惰性跳表（Herlihy 等人的 lazy skip list）
+     * @details 读操作（find/contains/lower_bound/遍历）不加锁；
+     *          写操作只锁住待修改节点的前驱，不同位置的写者互不阻塞。
+     *          被删除的节点先摘除再挂入待回收链表，当没有任何操作或迭代器
+     *          持有引用时才真正释放，因此读者始终不会访问已释放内存。
+     *          迭代器为弱一致：遍历期间并发插入/删除的元素可能可见也可能不可见。
+     *
+     * @tparam K       键类型
+     * @tparam V       映射值类型
+     * @tparam Compare 键比较函数对象类型
+     * @tparam Alloc   分配器类型，节点内存通过其重绑定分配；
+     *                 zstl::alloc 的内存池非线程安全，分配与释放由类内自旋锁串行化
+     */
+    template <typename K, typename V, typename Compare = std::less<K>,
+              typename Alloc = alloc<std::pair<const K, V>>>
+    class concurrent_skiplist_map
+    {
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = std::pair<const K, V>;
+        using key_compare = Compare;
+        using allocator_type = Alloc;
+        using traits_allocator = allocator_traits<allocator_type>;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+        // 最大层数：每层以 1/4 概率上升，16 层足以支撑 4^16 个元素
+        static constexpr int MAX_LEVEL = 16;
+
+    private:
+        using Node = SkipListNode<value_type>;
+        using link_type = typename Node::link_type;
+
+        // 以私有块类型重绑定分配器，使内存池的空闲链表为本类型独享
+        struct alignas(alignof(Node)) Block
+        {
+            unsigned char bytes_[alignof(Node)];
+        };
+        using block_allocator_type = typename traits_allocator::template rebind_alloc<Block>;
+        using block_traits_alloc = allocator_traits<block_allocator_type>;
+
+        static_assert(alignof(Node) <= ALIGN, "node alignment exceeds memory pool alignment");
+
+    public:
+        // 前向迭代器：持有引用计数，存活期间指向的节点不会被释放
+        class iterator
+        {
+            friend class concurrent_skiplist_map;
+
+        public:
+            using iterator_category = forward_iterator_tag;
+            using value_type = typename concurrent_skiplist_map::value_type;
+            using difference_type = ptrdiff_t;
+            using pointer = const value_type *;
+            using reference = const value_type &;
+
+            iterator() = default;
+
+            iterator(const iterator &it)
+                : node_(it.node_), map_(it.map_)
+            {
+                if (map_)
+                    map_->acquire_ref();
+            }
+
+            iterator(iterator &&it) noexcept
+                : node_(it.node_), map_(it.map_)
+            {
+                it.node_ = nullptr;
+                it.map_ = nullptr;
+            }
+
+            iterator &operator=(const iterator &it)
+            {
+                if (this != &it)
+                {
+                    if (it.map_)
+                        it.map_->acquire_ref();
+                    if (map_)
+                        map_->release_ref();
+                    node_ = it.node_;
+                    map_ = it.map_;
+                }
+                return *this;
+            }
+
+            iterator &operator=(iterator &&it) noexcept
+            {
+                if (this != &it)
+                {
+                    if (map_)
+                        map_->release_ref();
+                    node_ = it.node_;
+                    map_ = it.map_;
+                    it.node_ = nullptr;
+                    it.map_ = nullptr;
+                }
+                return *this;
+            }
+
+            ~iterator()
+            {
+                if (map_)
+                    map_->release_ref();
+            }
+
+            reference operator*() const { return node_->data(); }
+            pointer operator->() const { return &node_->data(); }
+
+            // 前置++：沿第 0 层跳过已删除/未链接完毕的节点
+            iterator &operator++()
+            {
+                node_ = next_live(node_);
+                return *this;
+            }
+
+            iterator operator++(int)
+            {
+                iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+
+            bool operator==(const iterator &it) const { return node_ == it.node_; }
+            bool operator!=(const iterator &it) const { return node_ != it.node_; }
+
+        private:
+            // end() 不持有引用，避免循环比较时反复修改计数
+            iterator(Node *node, const concurrent_skiplist_map *map)
+                : node_(node), map_(node ? map : nullptr)
+            {
+                if (map_)
+                    map_->acquire_ref();
+            }
+
+            Node *node_ = nullptr;
+            const concurrent_skiplist_map *map_ = nullptr;
+        };
+
+        using const_iterator = iterator;
+
+    public:
+        explicit concurrent_skiplist_map(const allocator_type &alloc = allocator_type())
+            : alloc_(alloc), block_alloc_(alloc_)
+        {
+            head_ = allocate_node(MAX_LEVEL);
+            head_->fully_linked_.store(true, std::memory_order_relaxed);
+        }
+
+        // 并发容器不支持拷贝与移动
+        concurrent_skiplist_map(const concurrent_skiplist_map &) = delete;
+        concurrent_skiplist_map &operator=(const concurrent_skiplist_map &) = delete;
+
+        // 析构时不得有其他线程访问本容器
+        ~concurrent_skiplist_map()
+        {
+            Node *cur = head_->next_[0].load(std::memory_order_relaxed);
+            while (cur)
+            {
+                Node *next = cur->next_[0].load(std::memory_order_relaxed);
+                destroy_node(cur);
+                cur = next;
+            }
+            free_retired(retired_);
+            deallocate_node(head_);
+        }
+
+        /* 迭代器访问 */
+        iterator begin() const
+        {
+            return iterator(next_live(head_), this);
+        }
+        iterator end() const { return iterator(); }
+
+        /* 容量查询：并发修改时仅为近似值 */
+        [[nodiscard]] size_type size() const noexcept { return size_.load(std::memory_order_relaxed); }
+        [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+        /* 查找操作（无锁） */
+        iterator find(const key_type &key) const
+        {
+            ref_guard guard(this);
+            return iterator(find_node(key), this);
+        }
+
+        bool contains(const key_type &key) const
+        {
+            ref_guard guard(this);
+            return find_node(key) != nullptr;
+        }
+
+        // 第一个键不小于 key 的元素
+        iterator lower_bound(const key_type &key) const
+        {
+            ref_guard guard(this);
+            return iterator(lower_bound_node(key), this);
+        }
+
+        /**
+         * @brief 范围扫描：按键升序对 [lo, hi) 内的每个元素调用 f
+         * @return 访问到的元素个数
+         * @note 与迭代器相同为弱一致，但整个扫描只修改一次引用计数
+         */
+        template <typename F>
+        size_type for_each_range(const key_type &lo, const key_type &hi, F f) const
+        {
+            ref_guard guard(this);
+            size_type n = 0;
+            for (Node *cur = lower_bound_node(lo); cur && com_(cur->data().first, hi); cur = next_live(cur))
+            {
+                f(cur->data());
+                ++n;
+            }
+            return n;
+        }
+
+        /* 插入操作（细粒度加锁） */
+
+        /**
+         * @brief 原位构造元素，键已存在时不插入
+         * @return pair<iterator, bool>，插入失败时指向已存在的元素
+         */
+        template <typename... Args>
+        std::pair<iterator, bool> emplace(Args &&...args)
+        {
+            ref_guard guard(this);
+            const int top = random_level();
+            Node *node = create_node(top + 1, std::forward<Args>(args)...);
+            const key_type &key = node->data().first;
+            Node *preds[MAX_LEVEL];
+            Node *succs[MAX_LEVEL];
+
+            while (true)
+            {
+                int found = find_impl(key, preds, succs);
+                if (found != -1)
+                {
+                    Node *exist = succs[found];
+                    if (!exist->marked_.load(std::memory_order_acquire))
+                    {
+                        // 等待并发插入者链接完毕后再返回
+                        while (!exist->fully_linked_.load(std::memory_order_acquire))
+                            std::this_thread::yield();
+                        destroy_node(node);
+                        return {iterator(exist, this), false};
+                    }
+                    // 已存在的节点正在被删除，重试
+                    continue;
+                }
+
+                // 自底向上锁住各层前驱并校验其仍然有效
+                int highest_locked = -1;
+                Node *prev_pred = nullptr;
+                bool valid = true;
+                for (int level = 0; valid && level <= top; ++level)
+                {
+                    Node *pred = preds[level];
+                    Node *succ = succs[level];
+                    if (pred != prev_pred)
+                    {
+                        pred->lock_.lock();
+                        highest_locked = level;
+                        prev_pred = pred;
+                    }
+                    valid = !pred->marked_.load(std::memory_order_acquire) &&
+                            (succ == nullptr || !succ->marked_.load(std::memory_order_acquire)) &&
+                            pred->next_[level].load(std::memory_order_acquire) == succ;
+                }
+                if (!valid)
+                {
+                    unlock_preds(preds, highest_locked);
+                    continue;
+                }
+
+                // 先设置新节点的后继，再自底向上发布
+                for (int level = 0; level <= top; ++level)
+                    node->next_[level].store(succs[level], std::memory_order_relaxed);
+                for (int level = 0; level <= top; ++level)
+                    preds[level]->next_[level].store(node, std::memory_order_release);
+                node->fully_linked_.store(true, std::memory_order_release);
+                unlock_preds(preds, highest_locked);
+                size_.fetch_add(1, std::memory_order_relaxed);
+                return {iterator(node, this), true};
+            }
+        }
+
+        std::pair<iterator, bool> insert(const value_type &v)
+        {
+            return emplace(v);
+        }
+
+        template <typename P,
+                  typename = std::enable_if_t<std::is_constructible_v<value_type, P &&>>>
+        std::pair<iterator, bool> insert(P &&x)
+        {
+            return emplace(std::forward<P>(x));
+        }
+
+        /* 删除操作（细粒度加锁） */
+
+        /**
+         * @brief 删除键为 key 的元素
+         * @return 删除的元素个数（0 或 1）
+         * @details 先加锁并打上删除标记（线性化点），再锁住各层前驱摘除节点
+         */
+        size_type erase(const key_type &key)
+        {
+            ref_guard guard(this);
+            Node *victim = nullptr;
+            bool is_marked = false;
+            int top = -1;
+            Node *preds[MAX_LEVEL];
+            Node *succs[MAX_LEVEL];
+
+            while (true)
+            {
+                int found = find_impl(key, preds, succs);
+                if (found != -1)
+                    victim = succs[found];
+                if (!is_marked &&
+                    !(found != -1 &&
+                      victim->fully_linked_.load(std::memory_order_acquire) &&
+                      victim->height_ - 1 == found &&
+                      !victim->marked_.load(std::memory_order_acquire)))
+                {
+                    return 0;
+                }
+
+                if (!is_marked)
+                {
+                    top = victim->height_ - 1;
+                    victim->lock_.lock();
+                    if (victim->marked_.load(std::memory_order_acquire))
+                    {
+                        // 已被其他线程删除
+                        victim->lock_.unlock();
+                        return 0;
+                    }
+                    victim->marked_.store(true, std::memory_order_release);
+                    is_marked = true;
+                }
+
+                int highest_locked = -1;
+                Node *prev_pred = nullptr;
+                bool valid = true;
+                for (int level = 0; valid && level <= top; ++level)
+                {
+                    Node *pred = preds[level];
+                    if (pred != prev_pred)
+                    {
+                        pred->lock_.lock();
+                        highest_locked = level;
+                        prev_pred = pred;
+                    }
+                    valid = !pred->marked_.load(std::memory_order_acquire) &&
+                            pred->next_[level].load(std::memory_order_acquire) == victim;
+                }
+                if (!valid)
+                {
+                    unlock_preds(preds, highest_locked);
+                    continue;
+                }
+
+                // 自顶向下摘除，victim 自身的后继保持不变，正在其上的读者可继续前进
+                for (int level = top; level >= 0; --level)
+                    preds[level]->next_[level].store(victim->next_[level].load(std::memory_order_acquire),
+                                                     std::memory_order_release);
+                victim->lock_.unlock();
+                unlock_preds(preds, highest_locked);
+                size_.fetch_sub(1, std::memory_order_relaxed);
+                retire(victim);
+                return 1;
+            }
+        }
+
+    private:
+        // 作用域引用：存在期间已摘除的节点不会被回收
+        class ref_guard
+        {
+        public:
+            explicit ref_guard(const concurrent_skiplist_map *map) : map_(map) { map_->acquire_ref(); }
+            ~ref_guard() { map_->release_ref(); }
+            ref_guard(const ref_guard &) = delete;
+            ref_guard &operator=(const ref_guard &) = delete;
+
+        private:
+            const concurrent_skiplist_map *map_;
+        };
+
+        /**
+         * @brief 自顶向下查找 key，记录每层的前驱与后继
+         * @return 找到 key 的最高层号，未找到返回 -1
+         */
+        int find_impl(const key_type &key, Node **preds, Node **succs) const
+        {
+            int found = -1;
+            Node *pred = head_;
+            for (int level = MAX_LEVEL - 1; level >= 0; --level)
+            {
+                Node *cur = pred->next_[level].load(std::memory_order_acquire);
+                while (cur && com_(cur->data().first, key))
+                {
+                    pred = cur;
+                    cur = pred->next_[level].load(std::memory_order_acquire);
+                }
+                if (found == -1 && cur && !com_(key, cur->data().first))
+                    found = level;
+                preds[level] = pred;
+                succs[level] = cur;
+            }
+            return found;
+        }
+
+        // 只读查找，命中即返回，无需记录前驱
+        Node *find_node(const key_type &key) const
+        {
+            Node *pred = head_;
+            for (int level = MAX_LEVEL - 1; level >= 0; --level)
+            {
+                Node *cur = pred->next_[level].load(std::memory_order_acquire);
+                while (cur && com_(cur->data().first, key))
+                {
+                    pred = cur;
+                    cur = pred->next_[level].load(std::memory_order_acquire);
+                }
+                if (cur && !com_(key, cur->data().first))
+                    return cur->is_live() ? cur : nullptr;
+            }
+            return nullptr;
+        }
+
+        // 第一个键不小于 key 的可见节点
+        Node *lower_bound_node(const key_type &key) const
+        {
+            Node *pred = head_;
+            Node *cur = nullptr;
+            for (int level = MAX_LEVEL - 1; level >= 0; --level)
+            {
+                cur = pred->next_[level].load(std::memory_order_acquire);
+                while (cur && com_(cur->data().first, key))
+                {
+                    pred = cur;
+                    cur = pred->next_[level].load(std::memory_order_acquire);
+                }
+            }
+            return (cur == nullptr || cur->is_live()) ? cur : next_live(cur);
+        }
+
+        // node 之后第一个可见节点
+        static Node *next_live(Node *node)
+        {
+            Node *cur = node->next_[0].load(std::memory_order_acquire);
+            while (cur && !cur->is_live())
+                cur = cur->next_[0].load(std::memory_order_acquire);
+            return cur;
+        }
+
+        // 解锁 [0, highest] 层中互不相同的前驱（相同前驱只会出现在相邻层）
+        static void unlock_preds(Node **preds, int highest)
+        {
+            Node *prev = nullptr;
+            for (int level = 0; level <= highest; ++level)
+            {
+                if (preds[level] != prev)
+                {
+                    preds[level]->lock_.unlock();
+                    prev = preds[level];
+                }
+            }
+        }
+
+        // 随机层号：每层以 1/4 概率继续上升
+        static int random_level()
+        {
+            thread_local uint64_t state = 0x9E3779B97F4A7C15ull ^ reinterpret_cast<uintptr_t>(&state);
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            uint64_t bits = state;
+            int level = 0;
+            while (level < MAX_LEVEL - 1 && (bits & 3) == 0)
+            {
+                ++level;
+                bits >>= 2;
+            }
+            return level;
+        }
+
+        /* 节点回收：引用计数归零时才释放待回收链表 */
+
+        void acquire_ref() const
+        {
+            refs_.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        void release_ref() const
+        {
+            if (refs_.load(std::memory_order_acquire) > 1 || !dirty_.load(std::memory_order_acquire))
+            {
+                refs_.fetch_sub(1, std::memory_order_acq_rel);
+                return;
+            }
+
+            // 在锁内取走待回收链表并释放自身引用：若此刻已无其他引用，
+            // 这些节点早已摘除，之后开始的操作不可能再访问到它们
+            Node *retired = nullptr;
+            size_t prev_refs = 0;
+            {
+                std::lock_guard<SpinLock> lock(retire_lock_);
+                retired = retired_;
+                retired_ = nullptr;
+                dirty_.store(false, std::memory_order_release);
+                prev_refs = refs_.fetch_sub(1, std::memory_order_acq_rel);
+            }
+            if (prev_refs == 1)
+            {
+                const_cast<concurrent_skiplist_map *>(this)->free_retired(retired);
+            }
+            else if (retired)
+            {
+                // 仍有其他引用，放回链表留给最后一个离开者
+                std::lock_guard<SpinLock> lock(retire_lock_);
+                Node *tail = retired;
+                while (tail->retired_next_)
+                    tail = tail->retired_next_;
+                tail->retired_next_ = retired_;
+                retired_ = retired;
+                dirty_.store(true, std::memory_order_release);
+            }
+        }
+
+        void retire(Node *node)
+        {
+            std::lock_guard<SpinLock> lock(retire_lock_);
+            node->retired_next_ = retired_;
+            retired_ = node;
+            dirty_.store(true, std::memory_order_release);
+        }
+
+        void free_retired(Node *node)
+        {
+            while (node)
+            {
+                Node *next = node->retired_next_;
+                destroy_node(node);
+                node = next;
+            }
+        }
+
+        /* 节点内存管理 */
+
+        static size_type node_blocks(int height)
+        {
+            size_type bytes = sizeof(Node) + height * sizeof(link_type);
+            return (bytes + sizeof(Block) - 1) / sizeof(Block);
+        }
+
+        // 分配并初始化链接部分，不构造键值
+        Node *allocate_node(int height)
+        {
+            Block *mem = nullptr;
+            {
+                std::lock_guard<SpinLock> lock(alloc_lock_);
+                mem = block_traits_alloc::allocate(block_alloc_, node_blocks(height));
+            }
+            return ::new (static_cast<void *>(mem)) Node(height);
+        }
+
+        void deallocate_node(Node *node)
+        {
+            size_type blocks = node_blocks(node->height_);
+            node->~Node();
+            std::lock_guard<SpinLock> lock(alloc_lock_);
+            block_traits_alloc::deallocate(block_alloc_, reinterpret_cast<Block *>(node), blocks);
+        }
+
+        template <typename... Args>
+        Node *create_node(int height, Args &&...args)
+        {
+            Node *node = allocate_node(height);
+            traits_allocator::construct(alloc_, &node->data(), std::forward<Args>(args)...);
+            return node;
+        }
+
+        void destroy_node(Node *node)
+        {
+            traits_allocator::destroy(alloc_, &node->data());
+            deallocate_node(node);
+        }
+
+    private:
+        allocator_type alloc_;                // 用于构造/析构键值
+        block_allocator_type block_alloc_;    // 用于分配节点内存
+        Node *head_ = nullptr;                // 头节点，拥有全部层
+        std::atomic<size_type> size_{0};      // 元素个数
+        Compare com_;                         // 比较函数
+
+        mutable std::atomic<size_t> refs_{0};   // 当前持有引用的操作/迭代器数
+        mutable std::atomic<bool> dirty_{false}; // 待回收链表是否非空
+        mutable SpinLock retire_lock_;          // 保护待回收链表
+        mutable Node *retired_ = nullptr;       // 已摘除、待释放的节点
+
+        // 内存池按类型共享状态，同类型的所有实例共用一把分配锁
+        inline static SpinLock alloc_lock_;
+    };
+} // namespace zstl
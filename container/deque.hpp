@@ -1,25 +1,34 @@
 #pragma once
 #include <initializer_list>
 #include <cassert>
+#include <cstring>
 #include "../iterator/reverse_iterator.hpp"
 #include "../allocator/alloc.hpp"
 #include "../allocator/memory.hpp"
 #include "../algorithm/algo.hpp"
 namespace zstl
 {
-    inline constexpr size_t BufferSize = 25;
+    inline constexpr size_t DEQUE_BUFFER_BYTES = 512; // 默认每个缓冲区的目标字节数
+    inline constexpr size_t DEQUE_SPARE_BUFFERS = 2;  // 缓存的空闲缓冲区个数上限
+
+    // 每个缓冲区容纳的元素个数：按目标字节数折算，元素本身超过目标字节数时每个缓冲区 1 个
+    constexpr size_t deque_buffer_size(size_t elem_size, size_t bytes)
+    {
+        return elem_size < bytes ? bytes / elem_size : 1;
+    }
+
     //--------------------------------------------------------------------------------
     // deque 迭代器模板
-    // T: 元素类型；Ptr: 指针类型；Ref: 引用类型
+    // T: 元素类型；Ptr: 指针类型；Ref: 引用类型；BufSize: 每个缓冲区的元素个数
     // 支持随机访问，包括跨缓冲区跳转
     //--------------------------------------------------------------------------------
-    template <typename T, typename Ptr, typename Ref>
+    template <typename T, typename Ptr, typename Ref, size_t BufSize>
     struct DequeIterator
     {
     private:
         using value_pointer = T *; // 元素指针类型
         using map_pointer = T **;  // 指向缓冲区指针的指针类型
-        using Self = DequeIterator<T, Ptr, Ref>;
+        using Self = DequeIterator<T, Ptr, Ref, BufSize>;
 
     public:
         // 迭代器萃取必需的五种类型
@@ -36,6 +45,13 @@ namespace zstl
         {
         }
 
+        // 普通迭代器构造 const 迭代器
+        template <typename P, typename R, typename = std::enable_if_t<std::is_convertible_v<P, Ptr>>>
+        DequeIterator(const DequeIterator<T, P, R, BufSize> &o)
+            : first_(o.first_), last_(o.last_), cur_(o.cur_), node_(o.node_)
+        {
+        }
+
         // 构造函数：传入新的缓冲区节点指针
         explicit DequeIterator(map_pointer newnode)
         {
@@ -48,7 +64,7 @@ namespace zstl
         {
             node_ = newnode;             // 保存中控数组中的节点位置
             first_ = *node_;             // 缓冲区首地址
-            last_ = first_ + BufferSize; // 缓冲区尾后地址
+            last_ = first_ + BufSize; // 缓冲区尾后地址
         }
 
         // 解引用运算符，返回当前元素的引用
@@ -62,7 +78,7 @@ namespace zstl
         {
             if (node_ == x.node_)
                 return cur_ - x.cur_;
-            return BufferSize * (node_ - x.node_ - 1) + (cur_ - first_) + (x.last_ - x.cur_);
+            return BufSize * (node_ - x.node_ - 1) + (cur_ - first_) + (x.last_ - x.cur_);
         }
 
         // 前置++：移动到下一个元素，若到达缓冲区末尾则跳到下一个缓冲区
@@ -112,17 +128,17 @@ namespace zstl
         Self &operator+=(difference_type n)
         {
             difference_type offset = n + (cur_ - first_);
-            if (offset >= 0 && offset < difference_type(BufferSize))
+            if (offset >= 0 && offset < difference_type(BufSize))
             {
                 cur_ += n;
             }
             else
             {
                 difference_type node_offset =
-                    offset > 0 ? offset / BufferSize
-                               : (offset + 1) / BufferSize - 1;
+                    offset > 0 ? offset / BufSize
+                               : (offset + 1) / BufSize - 1;
                 set_node(node_ + node_offset);
-                cur_ = first_ + (offset - node_offset * BufferSize);
+                cur_ = first_ + (offset - node_offset * BufSize);
             }
             return *this;
         }
@@ -170,11 +186,27 @@ namespace zstl
         map_pointer node_;    // 指向中控数组中缓冲区指针的位置
     };
 
+    // deque 迭代器按缓冲区分段：每个缓冲区是一段连续内存
+    template <typename T, typename Ptr, typename Ref, size_t BufSize>
+    struct segmented_iterator_traits<DequeIterator<T, Ptr, Ref, BufSize>>
+    {
+        using iterator = DequeIterator<T, Ptr, Ref, BufSize>;
+        using segment_iterator = T **;
+        using local_iterator = Ptr;
+
+        static constexpr bool is_segmented = true;
+
+        static segment_iterator segment(const iterator &it) { return it.node_; }
+        static local_iterator local(const iterator &it) { return it.cur_; }
+        static local_iterator begin(segment_iterator seg) { return *seg; }
+        static local_iterator end(segment_iterator seg) { return *seg + BufSize; }
+    };
+
     //--------------------------------------------------------------------------------
     // deque 容器，实现双端队列，支持随机访问
-    // 包含自定义分配器支持
+    // 包含自定义分配器支持；BufBytes 为每个缓冲区的目标字节数
     //--------------------------------------------------------------------------------
-    template <typename T, typename Alloc = alloc<T>>
+    template <typename T, typename Alloc = alloc<T>, size_t BufBytes = DEQUE_BUFFER_BYTES>
     class deque
     {
     private:
@@ -194,9 +226,12 @@ namespace zstl
         using map_allocator_type = typename traits_allocator::template rebind_alloc<buffer_type>;
         using map_traits_alloc = allocator_traits<map_allocator_type>;
 
+        // 每个缓冲区的元素个数
+        static constexpr size_type buffer_size = deque_buffer_size(sizeof(T), BufBytes);
+
     public:
-        using iterator = DequeIterator<T, pointer, reference>;
-        using const_iterator = DequeIterator<T, const_pointer, const_reference>;
+        using iterator = DequeIterator<T, pointer, reference, buffer_size>;
+        using const_iterator = DequeIterator<T, const_pointer, const_reference, buffer_size>;
         using reverse_iterator = basic_reverse_iterator<iterator>;
         using const_reverse_iterator = basic_reverse_iterator<const_iterator>;
         using difference_type = typename iterator_traits<iterator>::difference_type;
@@ -214,14 +249,14 @@ namespace zstl
     public:
         // 默认构造：创建至少一个缓冲区
         deque(const allocator_type &alloc = allocator_type())
-            : alloc_(alloc), map_alloc_(alloc_), map_(nullptr), map_size_(0)
+            : alloc_(alloc), map_alloc_(alloc_), map_(nullptr), map_size_(0), spare_count_(0)
         {
             create_map(0);
         }
 
         // 列表初始化
         deque(std::initializer_list<T> il, const allocator_type &alloc = allocator_type())
-            : alloc_(alloc), map_alloc_(alloc_),map_size_(0)
+            : alloc_(alloc), map_alloc_(alloc_), map_size_(0), spare_count_(0)
         {
             create_map(il.size());
             iterator tmp = start_;
@@ -234,7 +269,7 @@ namespace zstl
 
         // 指定大小和初始值
         deque(size_type n, const value_type &val, const allocator_type &alloc = allocator_type())
-            : alloc_(alloc), map_alloc_(alloc_),map_size_(0)
+            : alloc_(alloc), map_alloc_(alloc_), map_size_(0), spare_count_(0)
         {
             create_map(n);
             for (auto it = start_; it != finish_; ++it)
@@ -245,20 +280,26 @@ namespace zstl
 
         // 拷贝构造：允许有状态分配器策略
         deque(const deque &other)
-            : alloc_(other.alloc_), map_alloc_(alloc_),map_size_(0)
+            : alloc_(other.alloc_), map_alloc_(alloc_), map_size_(0), spare_count_(0)
         {
             create_map(other.size());
-            zstl::copy(other.begin(), other.end(), start_);
+            iterator tmp = start_;
+            for (auto it = other.begin(); it != other.end(); ++it, ++tmp)
+                traits_allocator::construct(alloc_, tmp.cur_, *it);
         }
 
         // 移动构造：noexcept
         deque(deque &&other) noexcept
             : alloc_(std::move(other.alloc_)), map_alloc_(alloc_),
-              start_(other.start_), finish_(other.finish_), map_(other.map_), map_size_(other.map_size_)
+              start_(other.start_), finish_(other.finish_), map_(other.map_), map_size_(other.map_size_),
+              spare_count_(other.spare_count_)
         {
+            for (size_type i = 0; i < spare_count_; ++i)
+                spare_[i] = other.spare_[i];
             other.map_ = nullptr;
             other.start_ = other.finish_ = iterator();
             other.map_size_ = 0;
+            other.spare_count_ = 0;
         }
 
         // 赋值运算符：拷贝-交换与移动赋值(noexcept)
@@ -275,17 +316,20 @@ namespace zstl
         {
             if (this != &other)
             {
-                clear();
-                map_traits_alloc::deallocate(map_alloc_, map_, map_size_);
+                destroy_storage();
                 alloc_ = std::move(other.alloc_);
                 map_alloc_ = map_allocator_type(alloc_);
                 start_ = other.start_;
                 finish_ = other.finish_;
                 map_ = other.map_;
                 map_size_ = other.map_size_;
+                spare_count_ = other.spare_count_;
+                for (size_type i = 0; i < spare_count_; ++i)
+                    spare_[i] = other.spare_[i];
                 other.map_ = nullptr;
                 other.start_ = other.finish_ = iterator();
                 other.map_size_ = 0;
+                other.spare_count_ = 0;
             }
             return *this;
         }
@@ -293,11 +337,7 @@ namespace zstl
         // 析构：释放缓冲区与 map
         ~deque()
         {
-            if (map_)
-            {
-                clear();
-                map_traits_alloc::deallocate(map_alloc_, map_, map_size_);
-            }
+            destroy_storage();
         }
 
         // 容量与访问
@@ -344,7 +384,7 @@ namespace zstl
             if (start_.cur_ == start_.first_)
             {
                 // 扩展后分配新缓冲区
-                *(start_.node_ - 1) = traits_allocator::allocate(alloc_, BufferSize);
+                *(start_.node_ - 1) = get_buffer();
             }
             --start_;
             traits_allocator::construct(alloc_, start_.cur_, std::forward<Args>(args)...);
@@ -360,7 +400,7 @@ namespace zstl
             if (finish_.cur_ == finish_.last_ - 1)
             {
                 // 扩展后分配新缓冲区
-                *(finish_.node_ + 1) = traits_allocator::allocate(alloc_, BufferSize);
+                *(finish_.node_ + 1) = get_buffer();
             }
 
             ++finish_;
@@ -369,8 +409,43 @@ namespace zstl
         // push_back / push_front / pop_back / pop_front
         void push_back(const value_type &val) { emplace_back(val); }
         void push_front(const value_type &val) { emplace_front(val); }
-        void pop_back() { erase(end() - 1); }
-        void pop_front() { erase(begin()); }
+
+        // 尾部弹出：析构元素，缓冲区腾空时归还
+        void pop_back()
+        {
+            assert(!empty());
+            if (finish_.cur_ == finish_.first_)
+            {
+                put_buffer(*finish_.node_);
+                *finish_.node_ = nullptr;
+                finish_.set_node(finish_.node_ - 1);
+                finish_.cur_ = finish_.last_ - 1;
+            }
+            else
+            {
+                --finish_.cur_;
+            }
+            traits_allocator::destroy(alloc_, finish_.cur_);
+        }
+
+        // 头部弹出：析构元素，缓冲区腾空时归还
+        void pop_front()
+        {
+            assert(!empty());
+            traits_allocator::destroy(alloc_, start_.cur_);
+            if (start_.cur_ == start_.last_ - 1)
+            {
+                // finish_ 不会停在缓冲区尾后，此时必然位于后面的节点
+                put_buffer(*start_.node_);
+                *start_.node_ = nullptr;
+                start_.set_node(start_.node_ + 1);
+                start_.cur_ = start_.first_;
+            }
+            else
+            {
+                ++start_.cur_;
+            }
+        }
 
         // 在 pos 插入左值，逻辑同上，仅拷贝而非移动
         iterator insert(iterator pos, const value_type &val)
@@ -382,7 +457,7 @@ namespace zstl
             if (index < sz / 2)
             {
                 if (start_.cur_ == start_.first_)
-                    *(start_.node_ - 1) = traits_allocator::allocate(alloc_, BufferSize);
+                    *(start_.node_ - 1) = get_buffer();
                 iter = start_ - 1;
                 while (iter + 1 != pos)
                 {
@@ -394,7 +469,7 @@ namespace zstl
             else
             {
                 if (finish_.cur_ == finish_.last_ - 1)
-                    *(finish_.node_ + 1) = traits_allocator::allocate(alloc_, BufferSize);
+                    *(finish_.node_ + 1) = get_buffer();
 
                 iter = finish_;
                 while (iter != pos)
@@ -421,20 +496,20 @@ namespace zstl
                 iter = pos;
                 while (iter != start_)
                 {
-                    *iter = *(iter - 1);
+                    *iter = std::move(*(iter - 1));
                     --iter;
                 }
-                ++start_;
+                pop_front();
             }
             else // 后半段，向后覆盖
             {
                 iter = pos + 1;
                 while (iter != finish_)
                 {
-                    *(iter - 1) = *iter;
+                    *(iter - 1) = std::move(*iter);
                     ++iter;
                 }
-                --finish_;
+                pop_back();
             }
             return start_ + index;
         }
@@ -453,15 +528,19 @@ namespace zstl
             }
         }
 
+        // 清空：保留一个缓冲区放回 map 中央，其余归还
         void clear()
         {
             traits_allocator::destroy_range(alloc_, start_, finish_);
-            for (map_pointer p = start_.node_; p <= finish_.node_; ++p)
+            buffer_type keep = *start_.node_;
+            *start_.node_ = nullptr;
+            for (map_pointer p = start_.node_ + 1; p <= finish_.node_; ++p)
             {
-                traits_allocator::deallocate(alloc_, *p, BufferSize);
+                put_buffer(*p);
+                *p = nullptr;
             }
             map_pointer center = map_ + map_size_ / 2;
-            *center = traits_allocator::allocate(alloc_, BufferSize); // 新建单个缓冲区
+            *center = keep;
             start_.set_node(center);
             start_.cur_ = start_.first_;
             finish_ = start_;
@@ -473,53 +552,100 @@ namespace zstl
             zstl::swap(finish_, d.finish_);
             zstl::swap(map_, d.map_);
             zstl::swap(map_size_, d.map_size_);
+            for (size_type i = 0; i < DEQUE_SPARE_BUFFERS; ++i)
+                zstl::swap(spare_[i], d.spare_[i]);
+            zstl::swap(spare_count_, d.spare_count_);
             zstl::swap(alloc_, d.alloc_);
             zstl::swap(map_alloc_, d.map_alloc_);
         }
 
     private:
+        // 取一个缓冲区：优先复用缓存
+        buffer_type get_buffer()
+        {
+            if (spare_count_ > 0)
+                return spare_[--spare_count_];
+            return traits_allocator::allocate(alloc_, buffer_size);
+        }
+
+        // 归还一个缓冲区：缓存未满时留作复用，否则释放
+        void put_buffer(buffer_type buf)
+        {
+            if (spare_count_ < DEQUE_SPARE_BUFFERS)
+                spare_[spare_count_++] = buf;
+            else
+                traits_allocator::deallocate(alloc_, buf, buffer_size);
+        }
+
+        // 析构全部元素并释放缓冲区、缓存与 map
+        void destroy_storage()
+        {
+            if (!map_)
+                return;
+            traits_allocator::destroy_range(alloc_, start_, finish_);
+            for (map_pointer p = start_.node_; p <= finish_.node_; ++p)
+                traits_allocator::deallocate(alloc_, *p, buffer_size);
+            while (spare_count_ > 0)
+                traits_allocator::deallocate(alloc_, spare_[--spare_count_], buffer_size);
+            map_traits_alloc::deallocate(map_alloc_, map_, map_size_);
+            map_ = nullptr;
+        }
+
         // 创建中控数组及缓冲区
         void create_map(size_type n)
         {
             // 计算需要的节点数与中控数组大小
-            size_type nodes = n / BufferSize + 1;
+            size_type nodes = n / buffer_size + 1;
             map_size_ = nodes < 8 ? 8 : nodes + 2;
             map_ = map_traits_alloc::allocate(map_alloc_, map_size_);
+            zstl::fill(map_, map_ + map_size_, nullptr); // 未挂缓冲区的槽位置空
 
             // 居中分配节点区间
             map_pointer nstart = map_ + (map_size_ - nodes) / 2;
             map_pointer nfinish = nstart + nodes - 1;
             for (map_pointer p = nstart; p <= nfinish; ++p)
             {
-                *p = traits_allocator::allocate(alloc_, BufferSize); // 为每个节点分配缓冲区数组
+                *p = get_buffer(); // 为每个节点分配缓冲区数组
             }
 
             // 设置 start_ / finish_
             start_.set_node(nstart);
             finish_.set_node(nfinish);
             start_.cur_ = start_.first_;
-            finish_.cur_ = finish_.first_ + (n % BufferSize);
+            finish_.cur_ = finish_.first_ + (n % buffer_size);
         }
 
         // 检查中控数组边界，触发扩容返回 true
         bool check_map_size()
         {
             // 如果 start_ 或 finish_ 已经达到 map 边缘，则需要扩容
-            if (start_.cur_ == *map_ || finish_.cur_ == (*(map_ + map_size_ - 1) + BufferSize - 1))
+            if (start_.cur_ == *map_ || finish_.cur_ == (*(map_ + map_size_ - 1) + buffer_size - 1))
             {
-                expanse_capacity(map_size_);
+                expanse_capacity(1);
                 return true;
             }
             return false;
         }
 
-        // 扩展中控数组及其缓冲区容量
+        // 为两端再腾出 add_num 个节点：map 足够宽时原地居中，否则扩大 map
         void expanse_capacity(size_type add_num)
         {
-            size_type old_nodes = finish_.node_ - start_.node_ + 1;                   // 旧节点数
-            size_type new_nodes = old_nodes + add_num;                                // 扩展后节点数
+            size_type old_nodes = finish_.node_ - start_.node_ + 1; // 旧节点数
+            size_type new_nodes = old_nodes + add_num;              // 扩展后节点数
+            if (map_size_ > 2 * new_nodes)
+            {
+                // 队列式使用时节点整体向一端漂移，居中即可复用 map 槽位
+                map_pointer new_start = map_ + (map_size_ - old_nodes) / 2;
+                std::memmove(new_start, start_.node_, old_nodes * sizeof(buffer_type));
+                zstl::fill(map_, new_start, nullptr);
+                zstl::fill(new_start + old_nodes, map_ + map_size_, nullptr);
+                start_.set_node(new_start);
+                finish_.set_node(new_start + old_nodes - 1);
+                return;
+            }
             size_type new_map_sz = map_size_ + std::max(map_size_, add_num) + 2;      // 新 map 大小
             map_pointer new_map = map_traits_alloc::allocate(map_alloc_, new_map_sz); // 分配新中控数组
+            zstl::fill(new_map, new_map + new_map_sz, nullptr);
             map_pointer new_start = new_map + (new_map_sz - new_nodes) / 2;
             map_pointer new_finish = new_start + old_nodes - 1;
 
@@ -543,5 +669,7 @@ namespace zstl
         iterator finish_;              // 结束迭代器
         map_pointer map_;              // 中控数组指针
         size_type map_size_;           // 中控数组大小
+        buffer_type spare_[DEQUE_SPARE_BUFFERS]; // 空闲缓冲区缓存
+        size_type spare_count_;        // 缓存中的缓冲区个数
     };
 }
\ No newline at end of file
@@ -1,7 +1,9 @@
 #pragma once
+#include <cassert>
 #include "../iterator/reverse_iterator.hpp"
 #include "../allocator/alloc.hpp"
 #include "../allocator/memory.hpp"
+#include "node_chain.hpp"
 namespace zstl
 {
     // 单向链表节点定义
@@ -259,7 +261,172 @@ namespace zstl
         // 判断是否为空（仅检查首节点是否存在）
         [[nodiscard]] bool empty() const { return header_->next_ == nullptr; }
 
+        // --------------- 链表操作：只重接 next_ 指针，不分配、不移动元素 ---------------
+
+        // 把 other 的全部节点接到 pos 之后；需要找到 other 的尾节点，O(other 长度)
+        void splice_after(iterator pos, forward_list &other)
+        {
+            assert(&other != this && alloc_ == other.alloc_);
+            Node *first = other.header_->next_;
+            if (!first)
+                return;
+            Node *last = first;
+            while (last->next_)
+                last = last->next_;
+            last->next_ = pos.node_->next_;
+            pos.node_->next_ = first;
+            other.header_->next_ = nullptr;
+        }
+        void splice_after(iterator pos, forward_list &&other) { splice_after(pos, other); }
+
+        // 把 other 中 it 之后的一个节点移到 pos 之后，O(1)；other 可以是 *this
+        void splice_after(iterator pos, forward_list &other, iterator it)
+        {
+            assert(alloc_ == other.alloc_);
+            Node *node = it.node_->next_;
+            if (pos.node_ == it.node_ || pos.node_ == node)
+                return;
+            it.node_->next_ = node->next_;
+            node->next_ = pos.node_->next_;
+            pos.node_->next_ = node;
+        }
+        void splice_after(iterator pos, forward_list &&other, iterator it) { splice_after(pos, other, it); }
+
+        // 把 other 的开区间 (first, last) 移到 pos 之后，O(区间长度)
+        void splice_after(iterator pos, forward_list &other, iterator first, iterator last)
+        {
+            assert(alloc_ == other.alloc_);
+            Node *head = first.node_->next_;
+            if (head == last.node_)
+                return;
+            Node *tail = head;
+            while (tail->next_ != last.node_)
+                tail = tail->next_;
+            first.node_->next_ = last.node_;
+            tail->next_ = pos.node_->next_;
+            pos.node_->next_ = head;
+        }
+        void splice_after(iterator pos, forward_list &&other, iterator first, iterator last) { splice_after(pos, other, first, last); }
+
+        // 合并两个有序链表，相等时本链表的元素在前，other 变为空
+        template <typename Compare>
+        void merge(forward_list &other, Compare comp)
+        {
+            if (&other == this)
+                return;
+            assert(alloc_ == other.alloc_);
+            auto less = [&comp](Node *x, Node *y)
+            { return comp(x->data_, y->data_); };
+            header_->next_ = merge_node_chains(header_->next_, other.header_->next_, less);
+            other.header_->next_ = nullptr;
+        }
+        template <typename Compare>
+        void merge(forward_list &&other, Compare comp) { merge(other, comp); }
+        void merge(forward_list &other) { merge(other, default_less()); }
+        void merge(forward_list &&other) { merge(other, default_less()); }
+
+        // 稳定排序：自底向上归并，无分配
+        template <typename Compare>
+        void sort(Compare comp)
+        {
+            header_->next_ = sort_node_chain(header_->next_, [&comp](Node *x, Node *y)
+                                             { return comp(x->data_, y->data_); });
+        }
+        void sort() { sort(default_less()); }
+
+        // 逆序：逐个节点反转 next_
+        void reverse() noexcept
+        {
+            Node *prev = nullptr;
+            Node *cur = header_->next_;
+            while (cur)
+            {
+                Node *next = cur->next_;
+                cur->next_ = prev;
+                prev = cur;
+                cur = next;
+            }
+            header_->next_ = prev;
+        }
+
+        // 删除满足 pred 的元素，返回删除个数；节点在遍历结束后才销毁，因此 pred 可以引用被删元素
+        template <typename Predicate>
+        size_type remove_if(Predicate pred)
+        {
+            Node *dead = nullptr;
+            size_type removed = 0;
+            for (Node *prev = header_; prev->next_;)
+            {
+                Node *p = prev->next_;
+                if (pred(p->data_))
+                {
+                    prev->next_ = p->next_;
+                    p->next_ = dead;
+                    dead = p;
+                    ++removed;
+                }
+                else
+                    prev = p;
+            }
+            destroy_chain(dead);
+            return removed;
+        }
+
+        size_type remove(const T &val)
+        {
+            return remove_if([&val](const T &x)
+                             { return x == val; });
+        }
+
+        // 删除连续重复元素中除第一个以外的元素，返回删除个数
+        template <typename BinaryPredicate>
+        size_type unique(BinaryPredicate pred)
+        {
+            Node *kept = header_->next_;
+            if (!kept)
+                return 0;
+            Node *dead = nullptr;
+            size_type removed = 0;
+            while (Node *p = kept->next_)
+            {
+                if (pred(kept->data_, p->data_))
+                {
+                    kept->next_ = p->next_;
+                    p->next_ = dead;
+                    dead = p;
+                    ++removed;
+                }
+                else
+                    kept = p;
+            }
+            destroy_chain(dead);
+            return removed;
+        }
+
+        size_type unique()
+        {
+            return unique([](const T &a, const T &b)
+                          { return a == b; });
+        }
+
     private:
+        static auto default_less()
+        {
+            return [](const T &a, const T &b)
+            { return a < b; };
+        }
+
+        // 销毁以 next_ 串起的已摘下节点
+        void destroy_chain(Node *p)
+        {
+            while (p)
+            {
+                Node *next = p->next_;
+                destroy_node(p);
+                p = next;
+            }
+        }
+
         // 创建节点：分配内存并调用构造
         template <typename... Args>
         Node *create_node(Args &&...args)
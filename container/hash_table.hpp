@@ -59,11 +59,15 @@ namespace zstl
         Node *node_;   // 当前节点
         const HT *ht_; // 所属哈希表
 
+        HashTableIterator()
+            : node_(nullptr), ht_(nullptr) {}
+
         HashTableIterator(Node *node, const HT *ht)
             : node_(node), ht_(ht) {}
 
-        // 允许不同类型的迭代器转换
-         HashTableIterator(const HashTableIterator<Key, Value, Value &, Value *, HashFunc, CompareFunc, Allocator> &it)
+        // 允许不同类型的迭代器转换（模板形式，不顶替隐式拷贝构造）
+        template <typename R, typename P, typename = std::enable_if_t<std::is_convertible_v<P, Ptr>>>
+        HashTableIterator(const HashTableIterator<Key, Value, R, P, HashFunc, CompareFunc, Allocator> &it)
             : node_(it.node_), ht_(it.ht_) {}
 
         // 获取节点数据
@@ -244,6 +248,24 @@ namespace zstl
             return iterator(nullptr, this);
         }
 
+        /**
+         * @brief 批量查找：out[i] 为 keys[i] 对应的迭代器，未找到时为 end()
+         * @tparam It iterator 或 const_iterator
+         */
+        template <typename It>
+        void find_batch(const K *keys, size_t n, It *out) const
+        {
+            find_batch_impl(keys, n, [this, out](size_t i, Node *node)
+                            { out[i] = It(node, this); });
+        }
+
+        // 批量判断键是否存在
+        void contains_batch(const K *keys, size_t n, bool *out) const
+        {
+            find_batch_impl(keys, n, [out](size_t i, Node *node)
+                            { out[i] = node != nullptr; });
+        }
+
         // emplace 接口（唯一插入）
         template <typename... Args>
         std::pair<iterator, bool> emplace_unique(Args &&...args)
@@ -475,6 +497,57 @@ namespace zstl
             return primeList[PRIMECOUNT - 1];
         }
 
+        // 批量查找时一组同时处理的键数
+        static constexpr size_t BATCH_GROUP = 16;
+
+        /**
+         * @brief 批量查找的三段流水线，每组 BATCH_GROUP 个键
+         * @details 1. 计算整组哈希并预取桶槽；2. 读取桶头并预取首节点；
+         *          3. 逐个比较链表。前两段发出的预取彼此重叠，
+         *          第三段访问时数据大多已在缓存中
+         * @param emit 以 (下标, 节点) 回调结果，未找到时节点为 nullptr
+         */
+        template <typename Emit>
+        void find_batch_impl(const K *keys, size_t n, Emit emit) const
+        {
+            if (tables_.empty())
+            {
+                for (size_t i = 0; i < n; ++i)
+                    emit(i, nullptr);
+                return;
+            }
+
+            const size_t bucket_num = tables_.size();
+            Node *const *buckets = tables_.begin();
+            size_t index[BATCH_GROUP];
+            Node *head[BATCH_GROUP];
+            for (size_t base = 0; base < n; base += BATCH_GROUP)
+            {
+                size_t group = n - base < BATCH_GROUP ? n - base : BATCH_GROUP;
+                // 1. 哈希并预取桶槽
+                for (size_t i = 0; i < group; ++i)
+                {
+                    index[i] = hash_(keys[base + i]) % bucket_num;
+                    __builtin_prefetch(buckets + index[i]);
+                }
+                // 2. 读取桶头并预取首节点
+                for (size_t i = 0; i < group; ++i)
+                {
+                    head[i] = buckets[index[i]];
+                    if (head[i])
+                        __builtin_prefetch(head[i]);
+                }
+                // 3. 在链表中比较
+                for (size_t i = 0; i < group; ++i)
+                {
+                    Node *cur = head[i];
+                    while (cur && !com_(kov_(cur->data_), keys[base + i]))
+                        cur = cur->next_;
+                    emit(base + i, cur);
+                }
+            }
+        }
+
         // 创建节点
         template <typename... Args>
         Node *create_node(Args &&...args)
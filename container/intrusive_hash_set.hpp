@@ -0,0 +1,370 @@
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include "vector.hpp"
+#include "../functor/functional.hpp"
+namespace zstl
+{
+    inline constexpr size_t INTRUSIVE_HASH_MIN_BUCKETS = 16; // 首次插入时的桶数
+
+    /**
+     * @brief 侵入式散列集合的钩子：桶内单链的后继与缓存的散列值
+     * @details 缓存散列值使扩容与比较都不必重新调用散列函数；
+     *          未链入时 next_ 指向自身（桶尾以 nullptr 结束，二者可以区分）
+     */
+    template <typename Tag = void>
+    struct intrusive_hash_hook
+    {
+        intrusive_hash_hook() noexcept : next_(this), hash_(0) {}
+        // 钩子表示链接关系，不随对象复制
+        intrusive_hash_hook(const intrusive_hash_hook &) noexcept : next_(this), hash_(0) {}
+        intrusive_hash_hook &operator=(const intrusive_hash_hook &) noexcept { return *this; }
+
+        [[nodiscard]] bool is_linked() const noexcept { return next_ != this; }
+
+        intrusive_hash_hook *next_; // 桶内后继
+        size_t hash_;               // 插入时计算的散列值
+    };
+
+    template <typename T, typename Hash, typename Equal, typename Tag>
+    class intrusive_hash_set;
+
+    // 侵入式散列集合的迭代器：桶内沿链表前进，桶尾时按缓存的散列值找到下一个非空桶
+    template <typename T, typename Hash, typename Equal, typename Tag, typename Ref, typename Ptr>
+    struct IntrusiveHashIterator
+    {
+        using hook_type = intrusive_hash_hook<Tag>;
+        using set_type = intrusive_hash_set<T, Hash, Equal, Tag>;
+        using Self = IntrusiveHashIterator<T, Hash, Equal, Tag, Ref, Ptr>;
+
+        // 迭代器萃取必需的五种类型
+        using iterator_category = forward_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = Ptr;
+        using reference = Ref;
+
+        IntrusiveHashIterator() : hook_(nullptr), set_(nullptr) {}
+        IntrusiveHashIterator(hook_type *hook, const set_type *set) : hook_(hook), set_(set) {}
+
+        // 普通迭代器构造 const 迭代器；写成模板，不顶替隐式拷贝构造
+        template <typename R, typename P, typename = std::enable_if_t<std::is_convertible_v<P, Ptr>>>
+        IntrusiveHashIterator(const IntrusiveHashIterator<T, Hash, Equal, Tag, R, P> &it)
+            : hook_(it.hook_), set_(it.set_) {}
+
+        Ref operator*() const { return static_cast<Ref>(*hook_); }
+        Ptr operator->() const { return &**this; }
+
+        Self &operator++()
+        {
+            if (hook_->next_)
+                hook_ = hook_->next_;
+            else
+                hook_ = set_->first_after(set_->bucket_index(hook_->hash_));
+            return *this;
+        }
+        Self operator++(int)
+        {
+            Self tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const Self &rhs) const { return hook_ == rhs.hook_; }
+        bool operator!=(const Self &rhs) const { return hook_ != rhs.hook_; }
+
+        hook_type *hook_;     // 当前钩子，end() 为 nullptr
+        const set_type *set_; // 所属集合
+    };
+
+    /**
+     * @brief 侵入式散列集合：元素由用户分配与持有，桶中串起元素内嵌的钩子
+     * @details 分离链接，桶数为 2 的幂，以 Fibonacci 乘法取散列值高位定位桶，
+     *          对恒等散列的整数键也能均匀分布。插入 / 删除不分配内存；
+     *          桶数组只在负载因子超过 1 时倍增（均摊），可先 reserve 避免运行期分配。
+     *          Hash / Equal 可额外提供键类型的重载，以便 find 直接按键查找（调用 equal(key, value)）
+     * @tparam T 派生自 intrusive_hash_hook<Tag> 的用户类型
+     */
+    template <typename T, typename Hash = hash<T>, typename Equal = equal_to<T>, typename Tag = void>
+    class intrusive_hash_set
+    {
+        template <typename, typename, typename, typename, typename, typename>
+        friend struct IntrusiveHashIterator;
+        using Node = intrusive_hash_hook<Tag>;
+
+    public:
+        using hook_type = Node;
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using pointer = T *;
+        using const_pointer = const T *;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using hasher = Hash;
+        using key_equal = Equal;
+
+        using iterator = IntrusiveHashIterator<T, Hash, Equal, Tag, T &, T *>;
+        using const_iterator = IntrusiveHashIterator<T, Hash, Equal, Tag, const T &, const T *>;
+
+        iterator begin() noexcept { return iterator(first_after(0, true), this); }
+        iterator end() noexcept { return iterator(nullptr, this); }
+        const_iterator begin() const noexcept { return const_iterator(first_after(0, true), this); }
+        const_iterator end() const noexcept { return const_iterator(nullptr, this); }
+
+        // 由元素得到其迭代器，O(1)
+        iterator iterator_to(T &value) noexcept
+        {
+            assert(as_hook(value).is_linked());
+            return iterator(&as_hook(value), this);
+        }
+
+    public:
+        explicit intrusive_hash_set(const Hash &hash = Hash(), const Equal &equal = Equal())
+            : hash_(hash), equal_(equal), shift_(0), size_(0) {}
+
+        intrusive_hash_set(const intrusive_hash_set &) = delete;
+        intrusive_hash_set &operator=(const intrusive_hash_set &) = delete;
+
+        // 移动：桶数组整体转移，钩子中不含指向集合的指针
+        intrusive_hash_set(intrusive_hash_set &&other) noexcept
+            : hash_(other.hash_), equal_(other.equal_), buckets_(std::move(other.buckets_)),
+              shift_(other.shift_), size_(other.size_)
+        {
+            other.shift_ = 0;
+            other.size_ = 0;
+        }
+        intrusive_hash_set &operator=(intrusive_hash_set &&other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        ~intrusive_hash_set() { clear(); }
+
+        // --------------- 容量 ---------------
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+        [[nodiscard]] size_type size() const noexcept { return size_; }
+        size_type bucket_count() const noexcept { return buckets_.size(); }
+        float load_factor() const noexcept { return buckets_.empty() ? 0.0f : static_cast<float>(size_) / buckets_.size(); }
+
+        // 预留至少能容纳 n 个元素而不扩容的桶
+        void reserve(size_type n)
+        {
+            size_type buckets = buckets_.empty() ? INTRUSIVE_HASH_MIN_BUCKETS : buckets_.size();
+            while (buckets < n)
+                buckets *= 2;
+            if (buckets > buckets_.size())
+                rehash(buckets);
+        }
+
+        // --------------- 插入：不分配内存（扩容除外） ---------------
+
+        // 键唯一插入：已有相等元素时不插入，返回该元素
+        std::pair<iterator, bool> insert_unique(T &value)
+        {
+            size_t h = hash_(value);
+            if (Node *found = find_node(value, h))
+                return {iterator(found, this), false};
+            return {iterator(link(value, h, nullptr), this), true};
+        }
+
+        // 允许重复插入：紧接在第一个相等元素之后，使相等元素在遍历中相邻
+        iterator insert_equal(T &value)
+        {
+            size_t h = hash_(value);
+            return iterator(link(value, h, find_node(value, h)), this);
+        }
+
+        // --------------- 删除：只摘下钩子，不销毁元素 ---------------
+
+        // 摘下 pos 指向的元素，返回其后继
+        iterator erase(const_iterator pos)
+        {
+            Node *node = pos.hook_;
+            assert(node && node->is_linked());
+            iterator next(node, this);
+            ++next;
+            unlink(node);
+            return next;
+        }
+
+        // 摘下 value，不必寻找后继
+        void erase(T &value)
+        {
+            assert(as_hook(value).is_linked());
+            unlink(&as_hook(value));
+        }
+
+        // 摘下所有与 key 相等的元素，返回个数
+        template <typename K>
+        size_type erase_key(const K &key)
+        {
+            if (buckets_.empty())
+                return 0;
+            size_t h = hash_(key);
+            size_type n = 0;
+            for (Node **slot = &buckets_[bucket_index(h)]; *slot;)
+            {
+                Node *node = *slot;
+                if (node->hash_ == h && equal_(key, value_of(node)))
+                {
+                    *slot = node->next_;
+                    node->next_ = node;
+                    ++n;
+                }
+                else
+                    slot = &node->next_;
+            }
+            size_ -= n;
+            return n;
+        }
+
+        // 摘下全部元素，只复位钩子；桶数组保留
+        void clear() noexcept
+        {
+            clear_and_dispose([](T *) {});
+        }
+
+        template <typename Disposer>
+        void clear_and_dispose(Disposer disposer)
+        {
+            for (Node *&head : buckets_)
+            {
+                while (head)
+                {
+                    Node *node = head;
+                    head = node->next_;
+                    node->next_ = node;
+                    disposer(static_cast<T *>(node));
+                }
+            }
+            size_ = 0;
+        }
+
+        // --------------- 查找 ---------------
+        template <typename K>
+        iterator find(const K &key)
+        {
+            return iterator(find_node(key, hash_(key)), this);
+        }
+        template <typename K>
+        const_iterator find(const K &key) const
+        {
+            return const_iterator(find_node(key, hash_(key)), this);
+        }
+
+        template <typename K>
+        bool contains(const K &key) const { return find_node(key, hash_(key)) != nullptr; }
+
+        template <typename K>
+        size_type count(const K &key) const
+        {
+            if (buckets_.empty())
+                return 0;
+            size_t h = hash_(key);
+            size_type n = 0;
+            for (Node *node = buckets_[bucket_index(h)]; node; node = node->next_)
+                n += node->hash_ == h && equal_(key, value_of(node));
+            return n;
+        }
+
+        void swap(intrusive_hash_set &other) noexcept
+        {
+            zstl::swap(hash_, other.hash_);
+            zstl::swap(equal_, other.equal_);
+            buckets_.swap(other.buckets_);
+            zstl::swap(shift_, other.shift_);
+            zstl::swap(size_, other.size_);
+        }
+
+    private:
+        static Node &as_hook(T &value) noexcept { return static_cast<Node &>(value); }
+        static const T &value_of(const Node *node) noexcept { return static_cast<const T &>(*node); }
+
+        // Fibonacci 散列：乘以 2^64 / φ 后取高位
+        size_t bucket_index(size_t h) const noexcept
+        {
+            return static_cast<size_t>((static_cast<uint64_t>(h) * 0x9E3779B97F4A7C15ull) >> shift_);
+        }
+
+        // 从桶 index（inclusive 为假时从其下一个桶）起第一个非空桶的首元素
+        Node *first_after(size_t index, bool inclusive = false) const noexcept
+        {
+            for (size_t i = inclusive ? index : index + 1; i < buckets_.size(); ++i)
+                if (buckets_[i])
+                    return buckets_[i];
+            return nullptr;
+        }
+
+        template <typename K>
+        Node *find_node(const K &key, size_t h) const
+        {
+            if (buckets_.empty())
+                return nullptr;
+            for (Node *node = buckets_[bucket_index(h)]; node; node = node->next_)
+                if (node->hash_ == h && equal_(key, value_of(node)))
+                    return node;
+            return nullptr;
+        }
+
+        // 在所在桶中找到指向 node 的槽位并摘下
+        void unlink(Node *node) noexcept
+        {
+            Node **slot = &buckets_[bucket_index(node->hash_)];
+            while (*slot != node)
+                slot = &(*slot)->next_;
+            *slot = node->next_;
+            node->next_ = node;
+            --size_;
+        }
+
+        // 链入 value：after 非空时接在其后，否则放在桶头
+        Node *link(T &value, size_t h, Node *after)
+        {
+            Node *node = &as_hook(value);
+            assert(!node->is_linked());
+            node->hash_ = h;
+            if (size_ + 1 > buckets_.size())
+                rehash(buckets_.empty() ? INTRUSIVE_HASH_MIN_BUCKETS : 2 * buckets_.size());
+            Node *&slot = after ? after->next_ : buckets_[bucket_index(h)];
+            node->next_ = slot;
+            slot = node;
+            ++size_;
+            return node;
+        }
+
+        // 按缓存的散列值把所有钩子移入 buckets 个新桶
+        void rehash(size_type buckets)
+        {
+            int bits = 0;
+            while ((size_type(1) << bits) < buckets)
+                ++bits;
+            vector<Node *> fresh(size_type(1) << bits, nullptr);
+            shift_ = 64 - bits;
+            for (Node *head : buckets_)
+            {
+                while (head)
+                {
+                    Node *next = head->next_;
+                    Node *&slot = fresh[bucket_index(head->hash_)];
+                    head->next_ = slot;
+                    slot = head;
+                    head = next;
+                }
+            }
+            buckets_.swap(fresh);
+        }
+
+        Hash hash_;             // 散列函数
+        Equal equal_;           // 相等比较
+        vector<Node *> buckets_; // 桶数组，长度为 2 的幂
+        int shift_;             // 64 - log2(桶数)
+        size_type size_;        // 元素个数
+    };
+} // namespace zstl
@@ -0,0 +1,299 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include "../iterator/reverse_iterator.hpp"
+#include "../algorithm/algo.hpp"
+namespace zstl
+{
+    /**
+     * @brief 侵入式双向链表的钩子，用户类型以公有基类的方式嵌入
+     * @details 同一对象需要同时位于多条链表时，为每条链表使用不同的 Tag：
+     *          struct Conn : intrusive_list_hook<by_idle>, intrusive_list_hook<by_owner> { ... };
+     *          未链入任何链表时 next_ 为空
+     */
+    template <typename Tag = void>
+    struct intrusive_list_hook
+    {
+        intrusive_list_hook() noexcept = default;
+        // 钩子表示链接关系，不随对象复制
+        intrusive_list_hook(const intrusive_list_hook &) noexcept {}
+        intrusive_list_hook &operator=(const intrusive_list_hook &) noexcept { return *this; }
+
+        [[nodiscard]] bool is_linked() const noexcept { return next_ != nullptr; }
+
+        intrusive_list_hook *prev_ = nullptr; // 前驱
+        intrusive_list_hook *next_ = nullptr; // 后继
+    };
+
+    // 侵入式链表迭代器：在钩子之间移动，解引用时下转为用户类型
+    template <typename T, typename Tag, typename Ref, typename Ptr>
+    struct IntrusiveListIterator
+    {
+        using hook_type = intrusive_list_hook<Tag>;
+        using Self = IntrusiveListIterator<T, Tag, Ref, Ptr>;
+
+        // 迭代器萃取必需的五个类型
+        using iterator_category = bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = Ptr;
+        using reference = Ref;
+
+        IntrusiveListIterator() : hook_(nullptr) {}
+        explicit IntrusiveListIterator(hook_type *hook) : hook_(hook) {}
+
+        // 普通迭代器构造 const 迭代器；写成模板，不顶替隐式拷贝构造
+        template <typename R, typename P, typename = std::enable_if_t<std::is_convertible_v<P, Ptr>>>
+        IntrusiveListIterator(const IntrusiveListIterator<T, Tag, R, P> &it) : hook_(it.hook_) {}
+
+        Ref operator*() const { return static_cast<Ref>(*hook_); }
+        Ptr operator->() const { return &**this; }
+
+        Self &operator++()
+        {
+            hook_ = hook_->next_;
+            return *this;
+        }
+        Self operator++(int)
+        {
+            Self tmp(*this);
+            hook_ = hook_->next_;
+            return tmp;
+        }
+        Self &operator--()
+        {
+            hook_ = hook_->prev_;
+            return *this;
+        }
+        Self operator--(int)
+        {
+            Self tmp(*this);
+            hook_ = hook_->prev_;
+            return tmp;
+        }
+
+        bool operator==(const Self &rhs) const { return hook_ == rhs.hook_; }
+        bool operator!=(const Self &rhs) const { return hook_ != rhs.hook_; }
+
+        hook_type *hook_; // 当前钩子，end() 为链表的哨兵
+    };
+
+    /**
+     * @brief 侵入式双向链表：元素由用户分配与持有，链表只串起其中的钩子
+     * @details 插入 / 删除 / splice 均为 O(1) 且不分配内存；链表不拥有元素，
+     *          析构或 clear() 时只把钩子复位，需要回收时使用 clear_and_dispose
+     *          哨兵钩子存放在链表对象内，因此链表可移动、不可复制
+     * @tparam T 派生自 intrusive_list_hook<Tag> 的用户类型
+     */
+    template <typename T, typename Tag = void>
+    class intrusive_list
+    {
+    public:
+        using hook_type = intrusive_list_hook<Tag>;
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using pointer = T *;
+        using const_pointer = const T *;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+        using iterator = IntrusiveListIterator<T, Tag, T &, T *>;
+        using const_iterator = IntrusiveListIterator<T, Tag, const T &, const T *>;
+        using reverse_iterator = basic_reverse_iterator<iterator>;
+        using const_reverse_iterator = basic_reverse_iterator<const_iterator>;
+
+        // --------------- 迭代器接口 ---------------
+        iterator begin() noexcept { return iterator(head_.next_); }
+        iterator end() noexcept { return iterator(&head_); }
+        const_iterator begin() const noexcept { return const_iterator(const_cast<hook_type *>(head_.next_)); }
+        const_iterator end() const noexcept { return const_iterator(const_cast<hook_type *>(&head_)); }
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+        // 由元素得到其迭代器，O(1)
+        iterator iterator_to(T &value) noexcept
+        {
+            assert(as_hook(value).is_linked());
+            return iterator(&as_hook(value));
+        }
+        const_iterator iterator_to(const T &value) const noexcept
+        {
+            return const_iterator(const_cast<hook_type *>(&as_hook(value)));
+        }
+
+    public:
+        intrusive_list() noexcept : size_(0) { head_.prev_ = head_.next_ = &head_; }
+
+        intrusive_list(const intrusive_list &) = delete;
+        intrusive_list &operator=(const intrusive_list &) = delete;
+
+        // 移动：接管全部钩子并修正首尾钩子指向哨兵的指针
+        intrusive_list(intrusive_list &&other) noexcept : intrusive_list() { swap(other); }
+        intrusive_list &operator=(intrusive_list &&other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        ~intrusive_list() { clear(); }
+
+        // --------------- 容量与访问 ---------------
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+        [[nodiscard]] size_type size() const noexcept { return size_; }
+
+        reference front() { return *begin(); }
+        const_reference front() const { return *begin(); }
+        reference back() { return *--end(); }
+        const_reference back() const { return *--end(); }
+
+        // --------------- 修改操作：均不分配内存 ---------------
+        void push_front(T &value) noexcept { insert(begin(), value); }
+        void push_back(T &value) noexcept { insert(end(), value); }
+        void pop_front() noexcept { erase(begin()); }
+        void pop_back() noexcept { erase(--end()); }
+
+        // 把 value 链到 pos 之前；value 不能已在某条同 Tag 的链表中
+        iterator insert(const_iterator pos, T &value) noexcept
+        {
+            hook_type *h = &as_hook(value);
+            assert(!h->is_linked());
+            hook_type *next = pos.hook_;
+            h->prev_ = next->prev_;
+            h->next_ = next;
+            next->prev_->next_ = h;
+            next->prev_ = h;
+            ++size_;
+            return iterator(h);
+        }
+
+        // 摘下 pos 指向的元素（不销毁），返回其后继
+        iterator erase(const_iterator pos) noexcept
+        {
+            hook_type *h = pos.hook_;
+            assert(h != &head_);
+            hook_type *next = h->next_;
+            unlink(h);
+            --size_;
+            return iterator(next);
+        }
+
+        // 摘下 value
+        void erase(T &value) noexcept { erase(iterator_to(value)); }
+
+        // 摘下 pos 并以 disposer(T*) 回收（如归还对象池）
+        template <typename Disposer>
+        iterator erase_and_dispose(const_iterator pos, Disposer disposer)
+        {
+            T *value = const_cast<T *>(&*pos);
+            iterator next = erase(pos);
+            disposer(value);
+            return next;
+        }
+
+        // 摘下全部元素，只复位钩子
+        void clear() noexcept
+        {
+            clear_and_dispose([](T *) {});
+        }
+
+        template <typename Disposer>
+        void clear_and_dispose(Disposer disposer)
+        {
+            hook_type *h = head_.next_;
+            while (h != &head_)
+            {
+                hook_type *next = h->next_;
+                h->prev_ = h->next_ = nullptr;
+                disposer(static_cast<T *>(h));
+                h = next;
+            }
+            head_.prev_ = head_.next_ = &head_;
+            size_ = 0;
+        }
+
+        // 把 other 的全部元素移到 pos 之前，O(1)
+        void splice(const_iterator pos, intrusive_list &other) noexcept
+        {
+            if (other.empty() || &other == this)
+                return;
+            transfer(pos.hook_, other.head_.next_, &other.head_);
+            size_ += other.size_;
+            other.size_ = 0;
+        }
+
+        // 把 other 中 it 指向的元素移到 pos 之前，O(1)；other 可以是 *this
+        void splice(const_iterator pos, intrusive_list &other, const_iterator it) noexcept
+        {
+            hook_type *h = it.hook_;
+            if (pos.hook_ == h || pos.hook_ == h->next_)
+                return;
+            transfer(pos.hook_, h, h->next_);
+            if (&other != this)
+            {
+                --other.size_;
+                ++size_;
+            }
+        }
+
+        void swap(intrusive_list &other) noexcept
+        {
+            if (this == &other)
+                return;
+            hook_type *first = head_.next_, *last = head_.prev_;
+            hook_type *ofirst = other.head_.next_, *olast = other.head_.prev_;
+            bool was_empty = empty(), other_empty = other.empty();
+            head_.prev_ = head_.next_ = &head_;
+            other.head_.prev_ = other.head_.next_ = &other.head_;
+            if (!other_empty)
+                relink_ends(head_, ofirst, olast);
+            if (!was_empty)
+                relink_ends(other.head_, first, last);
+            zstl::swap(size_, other.size_);
+        }
+
+    private:
+        static hook_type &as_hook(T &value) noexcept { return static_cast<hook_type &>(value); }
+        static const hook_type &as_hook(const T &value) noexcept { return static_cast<const hook_type &>(value); }
+
+        static void unlink(hook_type *h) noexcept
+        {
+            h->prev_->next_ = h->next_;
+            h->next_->prev_ = h->prev_;
+            h->prev_ = h->next_ = nullptr;
+        }
+
+        // 把 [first, last) 从所在链表摘下并接到 pos 之前
+        static void transfer(hook_type *pos, hook_type *first, hook_type *last) noexcept
+        {
+            if (first == last || pos == last)
+                return;
+            hook_type *tail = last->prev_;
+            first->prev_->next_ = last;
+            last->prev_ = first->prev_;
+            hook_type *prev = pos->prev_;
+            prev->next_ = first;
+            first->prev_ = prev;
+            tail->next_ = pos;
+            pos->prev_ = tail;
+        }
+
+        // 让哨兵 head 串起 first ... last
+        static void relink_ends(hook_type &head, hook_type *first, hook_type *last) noexcept
+        {
+            head.next_ = first;
+            head.prev_ = last;
+            first->prev_ = &head;
+            last->next_ = &head;
+        }
+
+        hook_type head_; // 哨兵，不属于任何元素
+        size_type size_; // 元素个数
+    };
+} // namespace zstl
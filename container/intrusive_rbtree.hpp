@@ -0,0 +1,420 @@
+#pragma once
+#include <cassert>
+#include <utility>
+#include "rb_tree.hpp"
+#include "../functor/functional.hpp"
+namespace zstl
+{
+    /**
+     * @brief 侵入式红黑树的钩子：父、左、右指针与颜色，满足 RBBalance 对节点的要求
+     * @details 用户类型以公有基类方式嵌入，多棵树 / 多条链表用不同 Tag 区分；
+     *          未链入时 parent_ 为空
+     */
+    template <typename Tag = void>
+    struct intrusive_rbtree_hook
+    {
+        using augment_type = RBNullAugment;
+
+        intrusive_rbtree_hook() noexcept = default;
+        // 钩子表示链接关系，不随对象复制
+        intrusive_rbtree_hook(const intrusive_rbtree_hook &) noexcept {}
+        intrusive_rbtree_hook &operator=(const intrusive_rbtree_hook &) noexcept { return *this; }
+
+        [[nodiscard]] bool is_linked() const noexcept { return parent_ != nullptr; }
+
+        // 平衡操作只通过以下接口读写父节点与颜色
+        intrusive_rbtree_hook *parent() const { return parent_; }
+        void set_parent(intrusive_rbtree_hook *parent) { parent_ = parent; }
+        Color color() const { return col_; }
+        void set_color(Color col) { col_ = col; }
+
+        intrusive_rbtree_hook *left_ = nullptr;   // 左子树
+        intrusive_rbtree_hook *right_ = nullptr;  // 右子树
+        intrusive_rbtree_hook *parent_ = nullptr; // 父节点
+        Color col_ = Color::RED;                  // 颜色
+    };
+
+    /**
+     * @brief 侵入式树迭代器：复用 RBTreeIterator 的中序移动，解引用时把钩子下转为用户类型
+     */
+    template <typename T, typename Tag, typename Ref, typename Ptr>
+    struct IntrusiveTreeIterator
+    {
+        using hook_type = intrusive_rbtree_hook<Tag>;
+        using Self = IntrusiveTreeIterator<T, Tag, Ref, Ptr>;
+        using walker_type = RBTreeIterator<T, T &, T *, hook_type>; // 只使用其 ++ / --
+
+        // 迭代器萃取必需的五个类型
+        using iterator_category = bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = Ptr;
+        using reference = Ref;
+
+        IntrusiveTreeIterator() = default;
+        explicit IntrusiveTreeIterator(hook_type *hook) : walker_(hook) {}
+
+        // 普通迭代器构造 const 迭代器；写成模板，不顶替隐式拷贝构造
+        template <typename R, typename P, typename = std::enable_if_t<std::is_convertible_v<P, Ptr>>>
+        IntrusiveTreeIterator(const IntrusiveTreeIterator<T, Tag, R, P> &it) : walker_(it.walker_.node_) {}
+
+        Ref operator*() const { return static_cast<Ref>(*walker_.node_); }
+        Ptr operator->() const { return &**this; }
+
+        Self &operator++()
+        {
+            ++walker_;
+            return *this;
+        }
+        Self operator++(int)
+        {
+            Self tmp(*this);
+            ++walker_;
+            return tmp;
+        }
+        Self &operator--()
+        {
+            --walker_;
+            return *this;
+        }
+        Self operator--(int)
+        {
+            Self tmp(*this);
+            --walker_;
+            return tmp;
+        }
+
+        bool operator==(const Self &rhs) const { return walker_.node_ == rhs.walker_.node_; }
+        bool operator!=(const Self &rhs) const { return walker_.node_ != rhs.walker_.node_; }
+
+        hook_type *hook() const { return walker_.node_; }
+
+        walker_type walker_;
+    };
+
+    /**
+     * @brief 侵入式红黑树：元素由用户分配与持有，树只串起其中的钩子
+     * @details 插入时沿比较路径下降后用 RBBalance::link_child 挂接，再由 adjust_insert 恢复平衡；
+     *          删除时与 RBTree 相同，先与后继交换位置，再 adjust_erase 并 unlink_node。
+     *          插入 / 删除均不分配内存。比较器可额外提供 (Key, T) 与 (T, Key) 重载，
+     *          以便 find / lower_bound 等直接按键查找
+     * @tparam T 派生自 intrusive_rbtree_hook<Tag> 的用户类型
+     */
+    template <typename T, typename Compare = less<T>, typename Tag = void>
+    class intrusive_rbtree : protected RBBalance<intrusive_rbtree_hook<Tag>>
+    {
+        using Node = intrusive_rbtree_hook<Tag>;
+
+    public:
+        using hook_type = Node;
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using pointer = T *;
+        using const_pointer = const T *;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using key_compare = Compare;
+
+        using iterator = IntrusiveTreeIterator<T, Tag, T &, T *>;
+        using const_iterator = IntrusiveTreeIterator<T, Tag, const T &, const T *>;
+        using reverse_iterator = basic_reverse_iterator<iterator>;
+        using const_reverse_iterator = basic_reverse_iterator<const_iterator>;
+
+        // --------------- 迭代器接口 ---------------
+        iterator begin() noexcept { return iterator(head_.left_); }
+        iterator end() noexcept { return iterator(&head_); }
+        const_iterator begin() const noexcept { return const_iterator(head_.left_); }
+        const_iterator end() const noexcept { return const_iterator(const_cast<Node *>(&head_)); }
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+        // 由元素得到其迭代器，O(1)
+        iterator iterator_to(T &value) noexcept
+        {
+            assert(as_hook(value).is_linked());
+            return iterator(&as_hook(value));
+        }
+        const_iterator iterator_to(const T &value) const noexcept
+        {
+            return const_iterator(const_cast<Node *>(&as_hook(value)));
+        }
+
+    public:
+        explicit intrusive_rbtree(const Compare &com = Compare()) : com_(com), size_(0)
+        {
+            reset_header();
+        }
+
+        intrusive_rbtree(const intrusive_rbtree &) = delete;
+        intrusive_rbtree &operator=(const intrusive_rbtree &) = delete;
+
+        intrusive_rbtree(intrusive_rbtree &&other) noexcept : com_(other.com_), size_(0)
+        {
+            reset_header();
+            swap(other);
+        }
+        intrusive_rbtree &operator=(intrusive_rbtree &&other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        ~intrusive_rbtree() { clear(); }
+
+        // --------------- 容量与访问 ---------------
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+        [[nodiscard]] size_type size() const noexcept { return size_; }
+
+        // 最小 / 最大元素，O(1)
+        reference front() { return *begin(); }
+        const_reference front() const { return *begin(); }
+        reference back() { return *--end(); }
+        const_reference back() const { return *--end(); }
+
+        // --------------- 插入：均不分配内存 ---------------
+
+        // 键唯一插入：已有等价元素时不插入，返回该元素
+        std::pair<iterator, bool> insert_unique(T &value)
+        {
+            Node *parent = &head_;
+            Node *cur = root();
+            bool left = true;
+            while (cur)
+            {
+                parent = cur;
+                left = com_(value, value_of(cur));
+                if (!left && !com_(value_of(cur), value))
+                    return {iterator(cur), false};
+                cur = left ? cur->left_ : cur->right_;
+            }
+            return {link(value, parent, left), true};
+        }
+
+        // 允许重复键插入：等价元素按插入顺序排列
+        iterator insert_equal(T &value)
+        {
+            Node *parent = &head_;
+            Node *cur = root();
+            bool left = true;
+            while (cur)
+            {
+                parent = cur;
+                left = com_(value, value_of(cur));
+                cur = left ? cur->left_ : cur->right_;
+            }
+            return link(value, parent, left);
+        }
+
+        // --------------- 删除：只摘下钩子，不销毁元素 ---------------
+
+        // 摘下 pos 指向的元素，返回其后继
+        iterator erase(const_iterator pos)
+        {
+            Node *target = pos.hook();
+            assert(target != &head_);
+            iterator next(target);
+            ++next;
+            if (target->left_ && target->right_)
+                this->swap_with_successor(target, next.hook());
+            Node *parent = target->parent();
+            this->adjust_erase(target, parent);
+            this->unlink_node(target, parent);
+            target->left_ = target->right_ = nullptr;
+            target->set_parent(nullptr);
+            target->set_color(Color::RED);
+            --size_;
+            return next;
+        }
+
+        void erase(T &value) { erase(iterator_to(value)); }
+
+        // 摘下所有与 key 等价的元素，返回个数
+        template <typename K>
+        size_type erase_key(const K &key)
+        {
+            iterator first = lower_bound(key), last = upper_bound(key);
+            size_type n = 0;
+            while (first != last)
+            {
+                first = erase(first);
+                ++n;
+            }
+            return n;
+        }
+
+        // 摘下 pos 并以 disposer(T*) 回收
+        template <typename Disposer>
+        iterator erase_and_dispose(const_iterator pos, Disposer disposer)
+        {
+            T *value = const_cast<T *>(&*pos);
+            iterator next = erase(pos);
+            disposer(value);
+            return next;
+        }
+
+        // 摘下全部元素：后序遍历复位钩子，O(n) 且不做任何平衡
+        void clear() noexcept
+        {
+            clear_and_dispose([](T *) {});
+        }
+
+        template <typename Disposer>
+        void clear_and_dispose(Disposer disposer)
+        {
+            Node *cur = root();
+            while (cur)
+            {
+                if (cur->left_)
+                    cur = cur->left_;
+                else if (cur->right_)
+                    cur = cur->right_;
+                else
+                {
+                    // 叶子：从父节点断开后回收，再回到父节点继续
+                    Node *parent = cur->parent();
+                    if (parent != &head_)
+                    {
+                        if (parent->left_ == cur)
+                            parent->left_ = nullptr;
+                        else
+                            parent->right_ = nullptr;
+                    }
+                    else
+                        parent = nullptr;
+                    cur->set_parent(nullptr);
+                    cur->set_color(Color::RED);
+                    disposer(static_cast<T *>(cur));
+                    cur = parent;
+                }
+            }
+            reset_header();
+            size_ = 0;
+        }
+
+        // --------------- 查找 ---------------
+        template <typename K>
+        iterator find(const K &key)
+        {
+            iterator it = lower_bound(key);
+            return it != end() && !com_(key, *it) ? it : end();
+        }
+        template <typename K>
+        const_iterator find(const K &key) const { return const_cast<intrusive_rbtree *>(this)->find(key); }
+
+        template <typename K>
+        size_type count(const K &key) const
+        {
+            size_type n = 0;
+            for (const_iterator it = lower_bound(key), last = upper_bound(key); it != last; ++it)
+                ++n;
+            return n;
+        }
+
+        // 第一个不小于 key 的元素
+        template <typename K>
+        iterator lower_bound(const K &key)
+        {
+            Node *res = &head_;
+            for (Node *cur = root(); cur;)
+            {
+                if (!com_(value_of(cur), key))
+                {
+                    res = cur;
+                    cur = cur->left_;
+                }
+                else
+                    cur = cur->right_;
+            }
+            return iterator(res);
+        }
+        template <typename K>
+        const_iterator lower_bound(const K &key) const { return const_cast<intrusive_rbtree *>(this)->lower_bound(key); }
+
+        // 第一个大于 key 的元素
+        template <typename K>
+        iterator upper_bound(const K &key)
+        {
+            Node *res = &head_;
+            for (Node *cur = root(); cur;)
+            {
+                if (com_(key, value_of(cur)))
+                {
+                    res = cur;
+                    cur = cur->left_;
+                }
+                else
+                    cur = cur->right_;
+            }
+            return iterator(res);
+        }
+        template <typename K>
+        const_iterator upper_bound(const K &key) const { return const_cast<intrusive_rbtree *>(this)->upper_bound(key); }
+
+        key_compare key_comp() const { return com_; }
+
+        // 交换两棵树：交换根并修正根与首尾指向哨兵的指针
+        void swap(intrusive_rbtree &other) noexcept
+        {
+            if (this == &other)
+                return;
+            Node *root_a = root(), *min_a = head_.left_, *max_a = head_.right_;
+            Node *root_b = other.root(), *min_b = other.head_.left_, *max_b = other.head_.right_;
+            adopt(root_b, min_b, max_b);
+            other.adopt(root_a, min_a, max_a);
+            zstl::swap(size_, other.size_);
+            zstl::swap(com_, other.com_);
+        }
+
+    private:
+        static Node &as_hook(T &value) noexcept { return static_cast<Node &>(value); }
+        static const Node &as_hook(const T &value) noexcept { return static_cast<const Node &>(value); }
+        static const T &value_of(Node *node) noexcept { return static_cast<const T &>(*node); }
+
+        Node *root() const noexcept { return head_.parent(); }
+
+        // 空树：哨兵为红色、无父节点、最小 / 最大指针指向自身（RBTreeIterator 依赖这一约定）
+        void reset_header() noexcept
+        {
+            this->header_ = &head_;
+            head_.set_parent(nullptr);
+            head_.left_ = head_.right_ = &head_;
+            head_.set_color(Color::RED);
+        }
+
+        // 接管另一棵树的根与首尾（root 为空时置为空树）
+        void adopt(Node *root, Node *min, Node *max) noexcept
+        {
+            reset_header();
+            if (!root)
+                return;
+            head_.set_parent(root);
+            root->set_parent(&head_);
+            head_.left_ = min;
+            head_.right_ = max;
+        }
+
+        iterator link(T &value, Node *parent, bool left)
+        {
+            Node *node = &as_hook(value);
+            assert(!node->is_linked());
+            node->left_ = node->right_ = nullptr;
+            node->set_color(Color::RED);
+            this->link_child(node, parent, left);
+            this->adjust_insert(node, parent);
+            root()->set_color(Color::BLACK);
+            ++size_;
+            return iterator(node);
+        }
+
+        Node head_;      // 哨兵：parent 为根，left_ / right_ 为最小 / 最大元素
+        Compare com_;    // 比较函数
+        size_type size_; // 元素个数
+    };
+} // namespace zstl
@@ -4,6 +4,7 @@
 #include "../allocator/alloc.hpp"
 #include "../allocator/memory.hpp"
 #include "../algorithm/algo.hpp"
+#include "node_chain.hpp"
 
 namespace zstl
 {
@@ -81,8 +82,10 @@ namespace zstl
         using pointer = Ptr;
         using reference = Ref;
 
-        // 转换构造函数
-        ListIterator(const ListIterator<T, T &, T *> &rhs)
+        // 转换构造函数：普通迭代器构造 const 迭代器
+        // 写成模板，不会顶替拷贝构造函数，隐式拷贝赋值得以保留
+        template <typename R, typename P, typename = std::enable_if_t<std::is_convertible_v<P, Ptr>>>
+        ListIterator(const ListIterator<T, R, P> &rhs)
             : base_(rhs.base_) {}
 
         base_ptr base_; // 当前迭代器指向的节点
@@ -337,6 +340,224 @@ namespace zstl
             zstl::swap(node_alloc_, rhs.node_alloc_);
         }
 
+        // --------------- 链表操作：只重接指针，不分配、不移动元素，迭代器保持有效 ---------------
+
+        // 把 other 的全部节点移到 pos 之前，O(1)
+        void splice(const_iterator pos, list &other)
+        {
+            assert(&other != this && alloc_ == other.alloc_);
+            if (other.empty())
+                return;
+            transfer(pos.base_, other.head_->next_, other.head_);
+            size_ += other.size_;
+            other.size_ = 0;
+        }
+        void splice(const_iterator pos, list &&other) { splice(pos, other); }
+
+        // 把 other 中 it 指向的节点移到 pos 之前，O(1)；other 可以是 *this（如 LRU 的移到队首）
+        void splice(const_iterator pos, list &other, const_iterator it)
+        {
+            assert(alloc_ == other.alloc_);
+            base_ptr node = it.base_;
+            if (pos.base_ == node || pos.base_ == node->next_)
+                return;
+            transfer(pos.base_, node, node->next_);
+            if (&other != this)
+            {
+                --other.size_;
+                ++size_;
+            }
+        }
+        void splice(const_iterator pos, list &&other, const_iterator it) { splice(pos, other, it); }
+
+        // 移动 other 的 [first, last)；跨链表时需要计数，O(区间长度)，同一链表内 O(1)
+        void splice(const_iterator pos, list &other, const_iterator first, const_iterator last)
+        {
+            assert(alloc_ == other.alloc_);
+            if (first == last)
+                return;
+            if (&other != this)
+            {
+                size_type n = 0;
+                for (base_ptr p = first.base_; p != last.base_; p = p->next_)
+                    ++n;
+                other.size_ -= n;
+                size_ += n;
+            }
+            transfer(pos.base_, first.base_, last.base_);
+        }
+        void splice(const_iterator pos, list &&other, const_iterator first, const_iterator last) { splice(pos, other, first, last); }
+
+        // 合并两个有序链表：other 中连续小于当前节点的一段整体移入，结果稳定，other 变为空
+        template <typename Compare>
+        void merge(list &other, Compare comp)
+        {
+            if (&other == this)
+                return;
+            assert(alloc_ == other.alloc_);
+            base_ptr a = head_->next_;
+            base_ptr b = other.head_->next_;
+            while (a != head_ && b != other.head_)
+            {
+                if (comp(value_of(b), value_of(a)))
+                {
+                    base_ptr run_end = b->next_;
+                    while (run_end != other.head_ && comp(value_of(run_end), value_of(a)))
+                        run_end = run_end->next_;
+                    transfer(a, b, run_end);
+                    b = run_end;
+                }
+                else
+                    a = a->next_;
+            }
+            if (b != other.head_)
+                transfer(head_, b, other.head_);
+            size_ += other.size_;
+            other.size_ = 0;
+        }
+        template <typename Compare>
+        void merge(list &&other, Compare comp) { merge(other, comp); }
+        void merge(list &other) { merge(other, default_less()); }
+        void merge(list &&other) { merge(other, default_less()); }
+
+        // 稳定排序：断开环后对 next_ 单链做自底向上归并，最后一遍重建 prev_，无分配
+        template <typename Compare>
+        void sort(Compare comp)
+        {
+            if (size_ < 2)
+                return;
+            head_->prev_->next_ = nullptr;
+            base_ptr first = sort_node_chain(head_->next_, [&comp](base_ptr x, base_ptr y)
+                                             { return comp(value_of(x), value_of(y)); });
+            base_ptr prev = head_;
+            for (base_ptr p = first; p; p = p->next_)
+            {
+                prev->next_ = p;
+                p->prev_ = prev;
+                prev = p;
+            }
+            prev->next_ = head_;
+            head_->prev_ = prev;
+        }
+        void sort() { sort(default_less()); }
+
+        // 逆序：交换每个节点（含头节点）的前后指针
+        void reverse() noexcept
+        {
+            base_ptr p = head_;
+            do
+            {
+                zstl::swap(p->prev_, p->next_);
+                p = p->prev_;
+            } while (p != head_);
+        }
+
+        // 删除满足 pred 的元素，返回删除个数；节点先摘下、遍历结束后再销毁，因此 pred 可以引用被删元素
+        template <typename Predicate>
+        size_type remove_if(Predicate pred)
+        {
+            base_ptr dead = nullptr;
+            size_type removed = 0;
+            for (base_ptr p = head_->next_; p != head_;)
+            {
+                base_ptr next = p->next_;
+                if (pred(value_of(p)))
+                {
+                    unlink(p);
+                    p->next_ = dead;
+                    dead = p;
+                    ++removed;
+                }
+                p = next;
+            }
+            destroy_chain(dead);
+            size_ -= removed;
+            return removed;
+        }
+
+        size_type remove(const T &val)
+        {
+            return remove_if([&val](const T &x)
+                             { return x == val; });
+        }
+
+        // 删除连续重复元素中除第一个以外的元素（pred(前一个保留的, 当前) 为真即视为重复），返回删除个数
+        template <typename BinaryPredicate>
+        size_type unique(BinaryPredicate pred)
+        {
+            if (size_ < 2)
+                return 0;
+            base_ptr dead = nullptr;
+            size_type removed = 0;
+            base_ptr kept = head_->next_;
+            for (base_ptr p = kept->next_; p != head_;)
+            {
+                base_ptr next = p->next_;
+                if (pred(value_of(kept), value_of(p)))
+                {
+                    unlink(p);
+                    p->next_ = dead;
+                    dead = p;
+                    ++removed;
+                }
+                else
+                    kept = p;
+                p = next;
+            }
+            destroy_chain(dead);
+            size_ -= removed;
+            return removed;
+        }
+
+        size_type unique()
+        {
+            return unique([](const T &a, const T &b)
+                          { return a == b; });
+        }
+
+    private:
+        using base_ptr = typename node_traits<T>::base_ptr;
+
+        static T &value_of(base_ptr p) { return p->as_node()->data_; }
+
+        static auto default_less()
+        {
+            return [](const T &a, const T &b)
+            { return a < b; };
+        }
+
+        // 把 [first, last) 从所在链表摘下并接到 pos 之前；pos 不能位于区间内
+        static void transfer(base_ptr pos, base_ptr first, base_ptr last) noexcept
+        {
+            if (first == last || pos == last)
+                return;
+            base_ptr tail = last->prev_;
+            first->prev_->next_ = last;
+            last->prev_ = first->prev_;
+            base_ptr prev = pos->prev_;
+            prev->next_ = first;
+            first->prev_ = prev;
+            tail->next_ = pos;
+            pos->prev_ = tail;
+        }
+
+        static void unlink(base_ptr p) noexcept
+        {
+            p->prev_->next_ = p->next_;
+            p->next_->prev_ = p->prev_;
+        }
+
+        // 销毁以 next_ 串起的已摘下节点
+        void destroy_chain(base_ptr p)
+        {
+            while (p)
+            {
+                base_ptr next = p->next_;
+                destroy_node(reinterpret_cast<node_type *>(p));
+                p = next;
+            }
+        }
+
     private:
         // 初始化空链表（头节点自环），使用分配器完成内存管理
         void empty_init()
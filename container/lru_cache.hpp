@@ -0,0 +1,669 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include "intrusive_hash_set.hpp"
+#include "intrusive_list.hpp"
+#include "vector.hpp"
+#include "../allocator/alloc.hpp"
+#include "../allocator/memory.hpp"
+#include "../functor/functional.hpp"
+namespace zstl
+{
+    inline constexpr size_t CACHE_SKETCH_MIN_WORDS = 16;   // 频率草图的最小字数
+    inline constexpr size_t CACHE_SKETCH_SAMPLE_FACTOR = 10; // 每累计 10 倍字数次访问老化一次
+
+    // 缓存的访问与淘汰统计
+    struct cache_stats
+    {
+        size_t hits = 0;       // 命中次数
+        size_t misses = 0;     // 未命中次数
+        size_t evictions = 0;  // 因容量被淘汰的条目数
+        size_t rejections = 0; // 单条权重超出可容纳上限而没有缓存的写入数
+
+        double hit_rate() const noexcept
+        {
+            size_t total = hits + misses;
+            return total ? static_cast<double>(hits) / total : 0.0;
+        }
+    };
+
+    // 默认权重：每个条目计 1，此时容量就是条目数
+    struct cache_unit_weight
+    {
+        template <typename K, typename V>
+        size_t operator()(const K &, const V &) const noexcept { return 1; }
+    };
+
+    struct CacheIndexTag;
+    struct CacheOrderTag;
+
+    // 缓存条目：键值、散列钩子与次序钩子位于同一次分配中
+    template <typename K, typename V>
+    struct CacheNode : intrusive_hash_hook<CacheIndexTag>, intrusive_list_hook<CacheOrderTag>
+    {
+        template <typename KK, typename VV>
+        CacheNode(KK &&key, VV &&value)
+            : key_(std::forward<KK>(key)), value_(std::forward<VV>(value)), weight_(0), segment_(0) {}
+
+        size_t hash() const noexcept { return intrusive_hash_hook<CacheIndexTag>::hash_; }
+
+        K key_;
+        V value_;
+        size_t weight_;   // 插入或更新时由 Weigher 计算
+        uint8_t segment_; // 所在分段，只有 tinylfu_cache 使用
+    };
+
+    // 把用户的 Hash / Equal 适配到节点，并保留按键查找的重载
+    template <typename K, typename V, typename Hash>
+    struct CacheNodeHash
+    {
+        size_t operator()(const CacheNode<K, V> &node) const { return hash_(node.key_); }
+        size_t operator()(const K &key) const { return hash_(key); }
+        Hash hash_;
+    };
+
+    template <typename K, typename V, typename Equal>
+    struct CacheNodeEqual
+    {
+        bool operator()(const CacheNode<K, V> &a, const CacheNode<K, V> &b) const { return equal_(a.key_, b.key_); }
+        bool operator()(const K &key, const CacheNode<K, V> &node) const { return equal_(key, node.key_); }
+        Equal equal_;
+    };
+
+    /**
+     * @brief lru_cache 与 tinylfu_cache 的公共部分：索引、节点分配、权重与统计
+     * @details 每个条目只分配一个 CacheNode，它同时挂在侵入式散列索引与次序链表上，
+     *          命中时调整次序只是重接指针；派生类负责次序链表并在析构前调用 clear
+     */
+    template <typename K, typename V, typename Hash, typename Equal, typename Weigher, typename Alloc>
+    class CacheBase
+    {
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using size_type = size_t;
+        using hasher = Hash;
+        using key_equal = Equal;
+        using weigher_type = Weigher;
+        using allocator_type = Alloc;
+        // 条目因容量离开缓存时调用（含 tinylfu_cache 未获准入的新条目）；erase / clear / 覆盖写入不会触发
+        using eviction_callback = std::function<void(const K &, V &)>;
+
+        [[nodiscard]] bool empty() const noexcept { return index_.empty(); }
+        [[nodiscard]] size_type size() const noexcept { return index_.size(); }
+        // 当前总权重，不超过 capacity()
+        size_type weight() const noexcept { return weight_; }
+        size_type capacity() const noexcept { return capacity_; }
+
+        const cache_stats &stats() const noexcept { return stats_; }
+        void reset_stats() noexcept { stats_ = cache_stats(); }
+
+        void set_eviction_callback(eviction_callback callback) { on_evict_ = std::move(callback); }
+
+        // 只判断是否存在，不改变次序也不计入统计
+        bool contains(const K &key) const { return index_.contains(key); }
+
+        // 读取但不改变次序、不计入统计；不存在时返回空指针
+        const V *peek(const K &key) const
+        {
+            auto it = index_.find(key);
+            return it == index_.end() ? nullptr : &it->value_;
+        }
+
+    protected:
+        using node_type = CacheNode<K, V>;
+        using node_hasher = CacheNodeHash<K, V, Hash>;
+        using index_type = intrusive_hash_set<node_type, node_hasher, CacheNodeEqual<K, V, Equal>, CacheIndexTag>;
+        using order_list = intrusive_list<node_type, CacheOrderTag>;
+        using node_allocator_type = typename allocator_traits<Alloc>::template rebind_alloc<node_type>;
+        using node_traits_alloc = allocator_traits<node_allocator_type>;
+
+        CacheBase(size_type capacity, const Hash &hash, const Equal &equal, const Weigher &weigher, const Alloc &alloc)
+            : index_(node_hasher{hash}, CacheNodeEqual<K, V, Equal>{equal}), hash_{hash},
+              node_alloc_(alloc), weigher_(weigher), capacity_(capacity), weight_(0) {}
+
+        CacheBase(const CacheBase &) = delete;
+        CacheBase &operator=(const CacheBase &) = delete;
+
+        node_type *find_node(const K &key)
+        {
+            auto it = index_.find(key);
+            return it == index_.end() ? nullptr : &*it;
+        }
+
+        // 分配并构造节点，算好权重，尚未链入任何容器
+        template <typename KK, typename VV>
+        node_type *create_node(KK &&key, VV &&value)
+        {
+            node_type *node = node_traits_alloc::allocate(node_alloc_, 1);
+            node_traits_alloc::construct(node_alloc_, node, std::forward<KK>(key), std::forward<VV>(value));
+            node->weight_ = weigher_(node->key_, node->value_);
+            return node;
+        }
+
+        void destroy_node(node_type *node)
+        {
+            node_traits_alloc::destroy(node_alloc_, node);
+            node_traits_alloc::deallocate(node_alloc_, node, 1);
+        }
+
+        // 覆盖已有条目的值并重新称重，返回权重变化量（可为负，按补码回绕）
+        template <typename VV>
+        size_type assign(node_type *node, VV &&value)
+        {
+            node->value_ = std::forward<VV>(value);
+            size_type old = node->weight_;
+            node->weight_ = weigher_(node->key_, node->value_);
+            weight_ += node->weight_ - old;
+            return node->weight_ - old;
+        }
+
+        // 把新节点登记到索引并计入权重，由派生类链入次序链表
+        void index_node(node_type *node)
+        {
+            index_.insert_unique(*node);
+            weight_ += node->weight_;
+        }
+
+        // 从索引与 list 中摘下并销毁；evicted 为真时计入淘汰并调用回调
+        void drop(order_list &list, node_type *node, bool evicted)
+        {
+            list.erase(*node);
+            index_.erase(*node);
+            weight_ -= node->weight_;
+            if (evicted)
+            {
+                ++stats_.evictions;
+                if (on_evict_)
+                    on_evict_(node->key_, node->value_);
+            }
+            destroy_node(node);
+        }
+
+        // 清空：先复位散列钩子，再逐条回收各次序链表中的节点
+        template <typename... Lists>
+        void destroy_all(Lists &...lists)
+        {
+            index_.clear();
+            (lists.clear_and_dispose([this](node_type *node)
+                                     { destroy_node(node); }),
+             ...);
+            weight_ = 0;
+        }
+
+        index_type index_;               // 键 -> 节点
+        Hash hash_;                      // 与索引一致的散列函数，供按键查询频率
+        node_allocator_type node_alloc_; // 节点分配器
+        Weigher weigher_;                // 条目称重
+        eviction_callback on_evict_;     // 淘汰回调，可为空
+        cache_stats stats_;              // 访问统计
+        size_type capacity_;             // 总权重上限
+        size_type weight_;               // 当前总权重
+    };
+
+    /**
+     * @brief 最近最少使用（LRU）缓存
+     * @details 一条次序链表：命中与写入都把条目移到队首，超出容量时从队尾淘汰。
+     *          每个条目只有一次节点分配（散列索引与次序链表共用），命中路径不分配内存；
+     *          容量按 Weigher 计算的总权重计，默认每条计 1 即按条目数
+     */
+    template <typename K, typename V, typename Hash = hash<K>, typename Equal = equal_to<K>,
+              typename Weigher = cache_unit_weight, typename Alloc = alloc<K>>
+    class lru_cache : public CacheBase<K, V, Hash, Equal, Weigher, Alloc>
+    {
+        using Base = CacheBase<K, V, Hash, Equal, Weigher, Alloc>;
+        using typename Base::node_type;
+
+    public:
+        using typename Base::size_type;
+
+        explicit lru_cache(size_type capacity, const Hash &hash = Hash(), const Equal &equal = Equal(),
+                           const Weigher &weigher = Weigher(), const Alloc &alloc = Alloc())
+            : Base(capacity, hash, equal, weigher, alloc) {}
+
+        ~lru_cache() { clear(); }
+
+        // 查找并标记为最近使用；未命中返回空指针
+        V *get(const K &key)
+        {
+            node_type *node = this->find_node(key);
+            if (!node)
+            {
+                ++this->stats_.misses;
+                return nullptr;
+            }
+            ++this->stats_.hits;
+            touch(node);
+            return &node->value_;
+        }
+
+        /**
+         * @brief 写入或覆盖 key，并标记为最近使用，必要时从队尾淘汰
+         * @return 条目是否留在缓存中；单条权重超过容量时不缓存（已有的旧值一并删除）
+         */
+        template <typename KK, typename VV>
+        bool put(KK &&key, VV &&value)
+        {
+            node_type *node = this->find_node(key);
+            if (node)
+            {
+                this->assign(node, std::forward<VV>(value));
+                if (node->weight_ > this->capacity_)
+                {
+                    this->drop(order_, node, false);
+                    ++this->stats_.rejections;
+                    return false;
+                }
+                touch(node);
+            }
+            else
+            {
+                node = this->create_node(std::forward<KK>(key), std::forward<VV>(value));
+                if (node->weight_ > this->capacity_)
+                {
+                    this->destroy_node(node);
+                    ++this->stats_.rejections;
+                    return false;
+                }
+                this->index_node(node);
+                order_.push_front(*node);
+            }
+            evict_to(this->capacity_);
+            return true;
+        }
+
+        // 删除 key，不触发淘汰回调
+        bool erase(const K &key)
+        {
+            node_type *node = this->find_node(key);
+            if (!node)
+                return false;
+            this->drop(order_, node, false);
+            return true;
+        }
+
+        // 调整容量，缩小时立即从队尾淘汰
+        void set_capacity(size_type capacity)
+        {
+            this->capacity_ = capacity;
+            evict_to(capacity);
+        }
+
+        void clear() { this->destroy_all(order_); }
+
+        // 按从最近到最久的次序访问 f(key, value)
+        template <typename F>
+        void for_each(F f) const
+        {
+            for (const node_type &node : order_)
+                f(node.key_, node.value_);
+        }
+
+    private:
+        void touch(node_type *node) { order_.splice(order_.begin(), order_, order_.iterator_to(*node)); }
+
+        void evict_to(size_type capacity)
+        {
+            while (this->weight_ > capacity)
+                this->drop(order_, &order_.back(), true);
+        }
+
+        typename Base::order_list order_; // 队首最近使用，队尾最先淘汰
+    };
+
+    /**
+     * 频率草图：4 行 Count-Min Sketch，计数器 4 位，每个 64 位字存 16 个
+     * 一个键的 4 个计数器落在同一个 8 字（64 字节）的块内：第 i 行使用块中第 2i 或 2i+1 字，
+     * 一次访问只触及一条缓存行。频率取 4 个计数器的最小值；
+     * 累计计数达到 10 倍字数时全部减半，让过去的热点逐渐冷却
+     */
+    class CacheFrequencySketch
+    {
+        static constexpr size_t BLOCK_WORDS = 8;
+
+    public:
+        /**
+         * 容纳约 n 个不同键：字数取不小于 n 的 2 的幂
+         * 块号取散列高位，块数翻 2^d 倍后新块号右移 d 位即旧块号，块内位置不变；
+         * 因此把旧块复制到它分裂出的每个新块，已有计数原样保留（仍是上界估计）
+         */
+        void ensure_capacity(size_t n)
+        {
+            if (n <= table_.size())
+                return;
+            size_t words = table_.empty() ? CACHE_SKETCH_MIN_WORDS : table_.size();
+            while (words < n)
+                words <<= 1;
+            int bits = 0;
+            while ((BLOCK_WORDS << bits) < words)
+                ++bits;
+            if (table_.empty())
+                table_.assign(words, 0);
+            else
+            {
+                int grow = bits - (64 - shift_); // 块数扩大 2^grow 倍
+                vector<uint64_t> old(std::move(table_));
+                table_.assign(words, 0);
+                for (size_t b = 0; b < words / BLOCK_WORDS; ++b)
+                    std::memcpy(&table_[b * BLOCK_WORDS], &old[(b >> grow) * BLOCK_WORDS], BLOCK_WORDS * sizeof(uint64_t));
+            }
+            shift_ = 64 - bits;
+            sample_ = CACHE_SKETCH_SAMPLE_FACTOR * words;
+        }
+
+        void increment(size_t h)
+        {
+            uint64_t x = spread(h);
+            uint64_t *block = &table_[block_index(x)];
+            bool added = false;
+            for (int i = 0; i < 4; ++i)
+            {
+                uint64_t &word = block[word_in_block(x, i)];
+                int offset = counter_offset(x, i);
+                if (((word >> offset) & 0xF) != 0xF)
+                {
+                    word += uint64_t(1) << offset;
+                    added = true;
+                }
+            }
+            if (added && ++additions_ >= sample_)
+                age();
+        }
+
+        unsigned frequency(size_t h) const
+        {
+            uint64_t x = spread(h);
+            const uint64_t *block = &table_[block_index(x)];
+            unsigned freq = 0xF;
+            for (int i = 0; i < 4; ++i)
+            {
+                unsigned c = static_cast<unsigned>((block[word_in_block(x, i)] >> counter_offset(x, i)) & 0xF);
+                freq = c < freq ? c : freq;
+            }
+            return freq;
+        }
+
+    private:
+        // 一次乘法把散列值的各位扩散到高位，再折回低位供行内选择
+        static uint64_t spread(uint64_t x)
+        {
+            x *= 0x9E3779B97F4A7C15ull;
+            return x ^ (x >> 29);
+        }
+
+        // 高位选块，低 24 位为 4 行各选字（1 位）与计数器（4 位）
+        size_t block_index(uint64_t x) const { return shift_ == 64 ? 0 : static_cast<size_t>(x >> shift_) * BLOCK_WORDS; }
+        static size_t word_in_block(uint64_t x, int i) { return (i << 1) + ((x >> i) & 1); }
+        static int counter_offset(uint64_t x, int i) { return static_cast<int>((x >> (4 + (i << 2))) & 0xF) << 2; }
+
+        void age()
+        {
+            for (uint64_t &word : table_)
+                word = (word >> 1) & 0x7777777777777777ull;
+            additions_ /= 2;
+        }
+
+        vector<uint64_t> table_; // 计数器字，按 8 字分块
+        int shift_ = 64;         // 64 - log2(块数)
+        size_t sample_ = 0;      // 老化周期
+        size_t additions_ = 0;   // 本周期内的计数次数
+    };
+
+    /**
+     * @brief W-TinyLFU 缓存：小的 LRU 窗口 + 按频率准入的分段 LRU 主区
+     * @details 新条目先进入约占 1% 容量的窗口；被挤出窗口的候选者与主区试用段队尾的受害者
+     *          比较频率草图中的估计值，频率更高者留下，使一次性扫描难以冲掉热点。
+     *          主区分试用段与保护段（约 80%），试用段中再次命中的条目晋升到保护段。
+     *          单个条目的权重不能超过 max_entry_weight()（通常即主区容量），否则 put 直接拒绝。
+     *          命中路径只有一次散列查找、一次草图计数与链表重接，不分配内存
+     */
+    template <typename K, typename V, typename Hash = hash<K>, typename Equal = equal_to<K>,
+              typename Weigher = cache_unit_weight, typename Alloc = alloc<K>>
+    class tinylfu_cache : public CacheBase<K, V, Hash, Equal, Weigher, Alloc>
+    {
+        using Base = CacheBase<K, V, Hash, Equal, Weigher, Alloc>;
+        using typename Base::node_type;
+        using typename Base::order_list;
+
+        enum Segment : uint8_t
+        {
+            WINDOW,
+            PROBATION,
+            PROTECTED
+        };
+
+    public:
+        using typename Base::size_type;
+
+        explicit tinylfu_cache(size_type capacity, const Hash &hash = Hash(), const Equal &equal = Equal(),
+                               const Weigher &weigher = Weigher(), const Alloc &alloc = Alloc())
+            : Base(capacity, hash, equal, weigher, alloc), window_weight_(0), probation_weight_(0), protected_weight_(0)
+        {
+            split_capacity();
+            size_sketch();
+        }
+
+        ~tinylfu_cache() { clear(); }
+
+        // 查找；命中时计入频率并按所在分段调整次序，未命中的键在随后 put 时计入
+        V *get(const K &key)
+        {
+            node_type *node = this->find_node(key);
+            if (!node)
+            {
+                ++this->stats_.misses;
+                return nullptr;
+            }
+            ++this->stats_.hits;
+            sketch_.increment(node->hash());
+            on_access(node);
+            return &node->value_;
+        }
+
+        /**
+         * @brief 写入或覆盖 key；新条目进入窗口，随后可能因准入比较被淘汰
+         * @details 权重超过 max_entry_weight() 的条目窗口与主区都放不下，直接拒绝并计入 rejections
+         * @return 条目此刻是否在缓存中
+         */
+        template <typename KK, typename VV>
+        bool put(KK &&key, VV &&value)
+        {
+            node_type *node = this->find_node(key);
+            if (node)
+            {
+                size_type delta = this->assign(node, std::forward<VV>(value));
+                segment_weight(node) += delta;
+                sketch_.increment(node->hash());
+                if (node->weight_ > max_entry_weight())
+                {
+                    remove(node, false);
+                    ++this->stats_.rejections;
+                    return false;
+                }
+                on_access(node);
+            }
+            else
+            {
+                node = this->create_node(std::forward<KK>(key), std::forward<VV>(value));
+                if (node->weight_ > max_entry_weight())
+                {
+                    this->destroy_node(node);
+                    ++this->stats_.rejections;
+                    return false;
+                }
+                this->index_node(node);
+                // 按条目计数时构造时已按容量定好草图；按权重计时提前扩到条目数的两倍
+                if constexpr (!std::is_same_v<Weigher, cache_unit_weight>)
+                    sketch_.ensure_capacity(2 * this->size());
+                sketch_.increment(node->hash());
+                node->segment_ = WINDOW;
+                window_.push_front(*node);
+                window_weight_ += node->weight_;
+            }
+            return evict(node);
+        }
+
+        // 删除 key，不触发淘汰回调
+        bool erase(const K &key)
+        {
+            node_type *node = this->find_node(key);
+            if (!node)
+                return false;
+            remove(node, false);
+            return true;
+        }
+
+        // 调整容量并重新划分窗口与主区，缩小时立即淘汰
+        void set_capacity(size_type capacity)
+        {
+            this->capacity_ = capacity;
+            split_capacity();
+            size_sketch();
+            while (protected_weight_ > protected_capacity_)
+                demote_protected();
+            evict(nullptr);
+        }
+
+        void clear()
+        {
+            this->destroy_all(window_, probation_, protected_);
+            window_weight_ = probation_weight_ = protected_weight_ = 0;
+        }
+
+        // 单个条目允许的最大权重：须整个放进窗口或主区之一
+        size_type max_entry_weight() const noexcept { return window_capacity_ > main_capacity_ ? window_capacity_ : main_capacity_; }
+
+        // 键的估计访问频率（0 ~ 15）
+        unsigned frequency(const K &key) const { return sketch_.frequency(this->hash_(key)); }
+
+    private:
+        void split_capacity()
+        {
+            window_capacity_ = this->capacity_ / 100;
+            if (window_capacity_ == 0)
+                window_capacity_ = this->capacity_ ? 1 : 0;
+            main_capacity_ = this->capacity_ - window_capacity_;
+            protected_capacity_ = main_capacity_ - main_capacity_ / 5;
+        }
+
+        // 按条目计数时容量即键数，一次定好草图大小；按权重计时随条目数增长（扩容保留计数）
+        void size_sketch()
+        {
+            if constexpr (std::is_same_v<Weigher, cache_unit_weight>)
+                sketch_.ensure_capacity(this->capacity_);
+            else
+                sketch_.ensure_capacity(CACHE_SKETCH_MIN_WORDS);
+        }
+
+        size_type main_weight() const noexcept { return probation_weight_ + protected_weight_; }
+
+        order_list &segment_list(node_type *node)
+        {
+            return node->segment_ == WINDOW ? window_ : node->segment_ == PROBATION ? probation_
+                                                                                   : protected_;
+        }
+
+        size_type &segment_weight(node_type *node)
+        {
+            return node->segment_ == WINDOW ? window_weight_ : node->segment_ == PROBATION ? probation_weight_
+                                                                                           : protected_weight_;
+        }
+
+        void on_access(node_type *node)
+        {
+            if (node->segment_ == PROBATION)
+            {
+                probation_.erase(*node);
+                probation_weight_ -= node->weight_;
+                node->segment_ = PROTECTED;
+                protected_.push_front(*node);
+                protected_weight_ += node->weight_;
+                while (protected_weight_ > protected_capacity_ && protected_.size() > 1)
+                    demote_protected();
+                return;
+            }
+            order_list &list = segment_list(node);
+            list.splice(list.begin(), list, list.iterator_to(*node));
+        }
+
+        // 保护段队尾降回试用段队首
+        void demote_protected()
+        {
+            node_type *node = &protected_.back();
+            protected_.pop_back();
+            protected_weight_ -= node->weight_;
+            node->segment_ = PROBATION;
+            probation_.push_front(*node);
+            probation_weight_ += node->weight_;
+        }
+
+        void remove(node_type *node, bool evicted)
+        {
+            segment_weight(node) -= node->weight_;
+            this->drop(segment_list(node), node, evicted);
+        }
+
+        // 主区中除 candidate 外最先淘汰的条目：先试用段队尾，再保护段队尾
+        node_type *main_victim(node_type *candidate)
+        {
+            if (!probation_.empty() && &probation_.back() != candidate)
+                return &probation_.back();
+            if (!protected_.empty())
+                return &protected_.back();
+            return nullptr;
+        }
+
+        /**
+         * 把超出窗口的条目逐个交给主区准入：候选者先放到试用段队首，
+         * 主区超重时与受害者比较频率，候选者严格更高才淘汰受害者，否则淘汰候选者本身；
+         * 最后处理覆盖写入或缩容造成的主区超重。返回 inserted 是否仍在缓存中
+         */
+        bool evict(node_type *inserted)
+        {
+            bool alive = true;
+            while (window_weight_ > window_capacity_ && !window_.empty())
+            {
+                node_type *candidate = &window_.back();
+                window_.pop_back();
+                window_weight_ -= candidate->weight_;
+                candidate->segment_ = PROBATION;
+                probation_.push_front(*candidate);
+                probation_weight_ += candidate->weight_;
+                while (main_weight() > main_capacity_)
+                {
+                    node_type *victim = main_victim(candidate);
+                    if (!victim || sketch_.frequency(candidate->hash()) <= sketch_.frequency(victim->hash()))
+                    {
+                        if (candidate == inserted)
+                            alive = false;
+                        remove(candidate, true);
+                        break;
+                    }
+                    remove(victim, true);
+                }
+            }
+            while (main_weight() > main_capacity_)
+            {
+                node_type *victim = main_victim(nullptr);
+                if (victim == inserted)
+                    alive = false;
+                remove(victim, true);
+            }
+            return alive;
+        }
+
+        order_list window_;            // 准入窗口，LRU
+        order_list probation_;         // 主区试用段，LRU
+        order_list protected_;         // 主区保护段，LRU
+        size_type window_weight_;      // 窗口总权重
+        size_type probation_weight_;   // 试用段总权重
+        size_type protected_weight_;   // 保护段总权重
+        size_type window_capacity_;    // 窗口容量，约为总容量的 1%
+        size_type main_capacity_;      // 主区容量
+        size_type protected_capacity_; // 保护段容量，约为主区的 80%
+        CacheFrequencySketch sketch_;  // 访问频率估计
+    };
+} // namespace zstl
@@ -11,4 +11,18 @@ namespace zstl
     template <typename K, typename V, typename Compare = std::less<K>, typename Alloc = alloc<std::pair<const K, V>>>
     using multimap = assoc_tree<K, V, Compare, Alloc, false>;
 
+    // 维护子树大小的 map，额外支持 nth_element_at / rank / count_range
+    template <typename K, typename V, typename Compare = std::less<K>, typename Alloc = alloc<std::pair<const K, V>>>
+    using ranked_map = assoc_tree<K, V, Compare, Alloc, true, RBSizeAugment>;
+
+    template <typename K, typename V, typename Compare = std::less<K>, typename Alloc = alloc<std::pair<const K, V>>>
+    using ranked_multimap = assoc_tree<K, V, Compare, Alloc, false, RBSizeAugment>;
+
+    // 紧凑节点布局的 map：颜色压入父指针，每节点更省内存
+    template <typename K, typename V, typename Compare = std::less<K>, typename Alloc = alloc<std::pair<const K, V>>>
+    using compact_map = assoc_tree<K, V, Compare, Alloc, true, RBNullAugment, true>;
+
+    template <typename K, typename V, typename Compare = std::less<K>, typename Alloc = alloc<std::pair<const K, V>>>
+    using compact_multimap = assoc_tree<K, V, Compare, Alloc, false, RBNullAugment, true>;
+
 }
@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+namespace zstl
+{
+    /*
+     * 以 next_ 串起、nullptr 结尾的节点链上的归并操作，供 list / forward_list 复用
+     * 只改写 next_ 指针，不分配内存；less(a, b) 比较两个节点的数据
+     */
+
+    // 合并两条有序链，相等时 a 中的节点在前（稳定）；返回新链首
+    template <typename Node, typename Less>
+    Node *merge_node_chains(Node *a, Node *b, Less &less)
+    {
+        Node *head = nullptr;
+        Node **tail = &head; // 指向待填写的 next_ 槽位
+        while (a && b)
+        {
+            if (less(b, a))
+            {
+                *tail = b;
+                b = b->next_;
+            }
+            else
+            {
+                *tail = a;
+                a = a->next_;
+            }
+            tail = &(*tail)->next_;
+        }
+        *tail = a ? a : b;
+        return head;
+    }
+
+    /**
+     * 自底向上归并排序：bins[i] 保存长度为 2^i 的有序段，每取下一个节点就像二进制加一那样逐级合并
+     * 较高的 bin 中总是较早的元素，合并时放在左侧以保持稳定；O(n log n) 比较，无额外分配
+     */
+    template <typename Node, typename Less>
+    Node *sort_node_chain(Node *first, Less less)
+    {
+        constexpr int BINS = sizeof(size_t) * 8;
+        Node *bins[BINS] = {};
+        int used = 0;
+        while (first)
+        {
+            Node *carry = first;
+            first = first->next_;
+            carry->next_ = nullptr;
+            int i = 0;
+            for (; i < used && bins[i]; ++i)
+            {
+                carry = merge_node_chains(bins[i], carry, less);
+                bins[i] = nullptr;
+            }
+            bins[i] = carry;
+            if (i == used)
+                ++used;
+        }
+        Node *result = nullptr;
+        for (int i = 0; i < used; ++i)
+            if (bins[i])
+                result = result ? merge_node_chains(bins[i], result, less) : bins[i];
+        return result;
+    }
+} // namespace zstl
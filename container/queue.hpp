@@ -12,6 +12,10 @@ namespace zstl
         queue() = default;
         ~queue() = default;
 
+        // 以已有容器构造，例如预设容量或覆盖模式的 ring_buffer
+        explicit queue(const Container &c) : con_(c) {}
+        explicit queue(Container &&c) : con_(std::move(c)) {}
+
         // 移动构造函数
         queue(queue &&other) noexcept
             : con_(std::move(other.con_))
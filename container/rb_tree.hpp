@@ -1,8 +1,10 @@
 #pragma once
 #include <utility>
+#include <cstdint>
 #include "../iterator/reverse_iterator.hpp"
 #include "../allocator/alloc.hpp"
 #include "../allocator/memory.hpp"
+#include "../algorithm/algo.hpp"
 namespace zstl
 {
     // 红黑树的颜色
@@ -28,29 +30,139 @@ namespace zstl
         }
     };
 
+    /**
+     * @brief 空增强策略：节点上不维护任何额外信息
+     * @details 所有钩子均为空函数，编译后不产生任何开销
+     */
+    struct RBNullAugment
+    {
+        struct node_base
+        {
+        };
+
+        // 根据左右孩子重新计算节点的附加信息
+        template <typename Node>
+        static void update(Node *)
+        {
+        }
+
+        // 自 node 起沿父链到 header（不含）逐个调整附加信息
+        template <typename Node>
+        static void propagate(Node *, Node *, ptrdiff_t)
+        {
+        }
+    };
+
+    /**
+     * @brief 子树大小增强策略：每个节点维护以其为根的子树节点数
+     * @details 插入/删除时沿路径增减，旋转时重算被旋转的两个节点，
+     *          从而支持 O(log n) 的按序选取（select）与排名（rank）
+     */
+    struct RBSizeAugment
+    {
+        struct node_base
+        {
+            size_t size_ = 1; // 子树节点数（含自身）
+        };
+
+        template <typename Node>
+        static size_t size(const Node *node)
+        {
+            return node ? node->size_ : 0;
+        }
+
+        template <typename Node>
+        static void update(Node *node)
+        {
+            node->size_ = size(node->left_) + size(node->right_) + 1;
+        }
+
+        template <typename Node>
+        static void propagate(Node *node, Node *header, ptrdiff_t delta)
+        {
+            for (; node != header; node = node->parent())
+            {
+                node->size_ += delta;
+            }
+        }
+    };
+
     // 红黑树的节点
-    template <typename T>
-    struct RBNode
+    template <typename T, typename Augment = RBNullAugment>
+    struct RBNode : Augment::node_base
     {
+        using augment_type = Augment;
+
         // 完美转发构造函数
         template <typename... Args>
         RBNode(Args &&...args) : data_(std::forward<Args>(args)...)
         {
         }
 
-        RBNode<T> *left_ = nullptr;   // 左子树
-        RBNode<T> *right_ = nullptr;  // 右子树
-        RBNode<T> *parent_ = nullptr; // 父节点
-        T data_;                      // 键值
-        Color col_ = Color::RED;      // 颜色
+        // 父节点与颜色的访问接口，平衡操作只通过它们读写
+        RBNode *parent() const { return parent_; }
+        void set_parent(RBNode *parent) { parent_ = parent; }
+        Color color() const { return col_; }
+        void set_color(Color col) { col_ = col; }
+
+        RBNode *left_ = nullptr;   // 左子树
+        RBNode *right_ = nullptr;  // 右子树
+        RBNode *parent_ = nullptr; // 父节点
+        T data_;                   // 键值
+        Color col_ = Color::RED;   // 颜色
+    };
+
+    /**
+     * @brief 紧凑布局的红黑树节点：颜色存放在父指针的最低位
+     * @details 节点按指针对齐，父指针最低位恒为 0，可用来存放颜色，
+     *          省去单独的 Color 字段及其对齐填充（64 位下通常每节点省 8 字节），
+     *          代价是每次读写父指针/颜色多一次位运算
+     */
+    template <typename T, typename Augment = RBNullAugment>
+    struct RBCompactNode : Augment::node_base
+    {
+        using augment_type = Augment;
+
+        // 完美转发构造函数
+        template <typename... Args>
+        RBCompactNode(Args &&...args) : data_(std::forward<Args>(args)...)
+        {
+        }
+
+        RBCompactNode *parent() const
+        {
+            return reinterpret_cast<RBCompactNode *>(parent_col_ & ~COLOR_MASK);
+        }
+        void set_parent(RBCompactNode *parent)
+        {
+            // 颜色位借用的是节点地址的最低位，依赖节点自身的对齐；类内此处类型已完整
+            static_assert(alignof(RBCompactNode) > COLOR_MASK, "node address low bit must be free");
+            parent_col_ = reinterpret_cast<uintptr_t>(parent) | (parent_col_ & COLOR_MASK);
+        }
+        Color color() const
+        {
+            return (parent_col_ & COLOR_MASK) ? Color::BLACK : Color::RED;
+        }
+        void set_color(Color col)
+        {
+            parent_col_ = (parent_col_ & ~COLOR_MASK) | (col == Color::BLACK ? COLOR_MASK : 0);
+        }
+
+        RBCompactNode *left_ = nullptr;  // 左子树
+        RBCompactNode *right_ = nullptr; // 右子树
+        uintptr_t parent_col_ = 0;       // 父节点指针 | 颜色位（0 为红，1 为黑）
+        T data_;                         // 键值
+
+    private:
+        static constexpr uintptr_t COLOR_MASK = 1;
     };
 
     // 红黑树的迭代器
-    template <typename T, typename Ref, typename Ptr>
+    template <typename T, typename Ref, typename Ptr, typename NodeT = RBNode<T>>
     struct RBTreeIterator
     {
-        using Node = RBNode<T>;
-        using Self = RBTreeIterator<T, Ref, Ptr>;
+        using Node = NodeT;
+        using Self = RBTreeIterator<T, Ref, Ptr, NodeT>;
 
         // 迭代器萃取必需的五个类型
         using iterator_category = bidirectional_iterator_tag;
@@ -59,19 +171,20 @@ namespace zstl
         using pointer = Ptr;
         using reference = Ref;
 
-        explicit RBTreeIterator(Node *node)
-            : node_(node)
+        RBTreeIterator()
+            : node_(nullptr)
         {
         }
 
-        Self &operator=(const Self &it)
+        explicit RBTreeIterator(Node *node)
+            : node_(node)
         {
-            node_ = it.node_;
-            return *this;
         }
 
         // 普通迭代器构造const迭代器
-        RBTreeIterator(const RBTreeIterator<T, T &, T *> &it)
+        // 写成模板，不顶替拷贝构造函数，拷贝构造与拷贝赋值均由编译器隐式生成
+        template <typename R, typename P, typename = std::enable_if_t<std::is_convertible_v<P, Ptr>>>
+        RBTreeIterator(const RBTreeIterator<T, R, P, NodeT> &it)
             : node_(it.node_)
         {
         }
@@ -116,11 +229,11 @@ namespace zstl
             {
                 // 找到孩子不在右的祖先
                 Node *cur = node_;
-                Node *parent = node_->parent_;
-                while (cur != parent->parent_ && cur == parent->right_)
+                Node *parent = node_->parent();
+                while (cur != parent->parent() && cur == parent->right_)
                 {
                     cur = parent;
-                    parent = parent->parent_;
+                    parent = parent->parent();
                 }
                 node_ = parent;
             }
@@ -139,7 +252,7 @@ namespace zstl
         Self &operator--()
         {
             // 如果是header
-            if (node_->parent_->parent_ == node_ && node_->col_ == Color::RED)
+            if (node_->parent()->parent() == node_ && node_->color() == Color::RED)
             {
                 node_ = node_->right_;
             }
@@ -158,11 +271,11 @@ namespace zstl
             {
                 // 找到孩子不在左的祖先
                 Node *cur = node_;
-                Node *parent = cur->parent_;
-                while (cur != parent->parent_ && cur == parent->left_)
+                Node *parent = cur->parent();
+                while (cur != parent->parent() && cur == parent->left_)
                 {
                     cur = parent;
-                    parent = parent->parent_;
+                    parent = parent->parent();
                 }
                 node_ = parent;
             }
@@ -182,10 +295,11 @@ namespace zstl
     };
 
     // 红黑树的平衡操作
-    template <typename T>
+    template <typename NodeT>
     class RBBalance
     {
-        using Node = RBNode<T>;
+        using Node = NodeT;
+        using augment_type = typename Node::augment_type;
 
     protected:
         // 右旋
@@ -196,14 +310,14 @@ namespace zstl
             Node *subLR = subL->right_;
             parent->left_ = subLR;
             if (subLR)
-                subLR->parent_ = parent;
+                subLR->set_parent(parent);
             subL->right_ = parent;
-            Node *ppNode = parent->parent_;
-            parent->parent_ = subL;
-            if (parent == header_->parent_)
+            Node *ppNode = parent->parent();
+            parent->set_parent(subL);
+            if (parent == header_->parent())
             {
-                header_->parent_ = subL;
-                header_->parent_->parent_ = header_;
+                header_->set_parent(subL);
+                header_->parent()->set_parent(header_);
             }
             else
             {
@@ -215,8 +329,11 @@ namespace zstl
                 {
                     ppNode->right_ = subL;
                 }
-                subL->parent_ = ppNode;
+                subL->set_parent(ppNode);
             }
+            // 先更新下沉的 parent，再更新上浮的 subL
+            augment_type::update(parent);
+            augment_type::update(subL);
         }
 
         // 左旋
@@ -226,17 +343,17 @@ namespace zstl
             Node *subRL = subR->left_;
             parent->right_ = subRL;
             if (subRL)
-                subRL->parent_ = parent;
+                subRL->set_parent(parent);
 
             subR->left_ = parent;
-            Node *ppNode = parent->parent_;
+            Node *ppNode = parent->parent();
 
-            parent->parent_ = subR;
+            parent->set_parent(subR);
 
-            if (parent == header_->parent_)
+            if (parent == header_->parent())
             {
-                header_->parent_ = subR;
-                header_->parent_->parent_ = header_;
+                header_->set_parent(subR);
+                header_->parent()->set_parent(header_);
             }
             else
             {
@@ -248,8 +365,10 @@ namespace zstl
                 {
                     ppNode->left_ = subR;
                 }
-                subR->parent_ = ppNode;
+                subR->set_parent(ppNode);
             }
+            augment_type::update(parent);
+            augment_type::update(subR);
         }
 
         // 左右双旋
@@ -269,19 +388,20 @@ namespace zstl
         // 插入调整
         void adjust_insert(Node *cur, Node *parent)
         {
-            while (parent != header_ && parent->col_ == Color::RED)
+            while (parent != header_ && parent->color() == Color::RED)
             {
-                Node *grandfather = parent->parent_;
+                Node *grandfather = parent->parent();
                 if (parent == grandfather->left_)
                 {
                     Node *uncle = grandfather->right_;
                     // 情况三：如果叔叔存在且为红
-                    if (uncle && uncle->col_ == Color::RED)
+                    if (uncle && uncle->color() == Color::RED)
                     {
-                        parent->col_ = uncle->col_ = Color::BLACK;
-                        grandfather->col_ = Color::RED;
+                        parent->set_color(Color::BLACK);
+                        uncle->set_color(Color::BLACK);
+                        grandfather->set_color(Color::RED);
                         cur = grandfather;
-                        parent = cur->parent_;
+                        parent = cur->parent();
                     }
                     else
                     {
@@ -292,8 +412,8 @@ namespace zstl
                             //   p   u
                             // c
                             RotateR(grandfather);
-                            parent->col_ = Color::BLACK;
-                            grandfather->col_ = Color::RED;
+                            parent->set_color(Color::BLACK);
+                            grandfather->set_color(Color::RED);
                         }
                         else // 情况五：叔叔不存在 / 存在且为黑，cur在parent的右侧
                         {
@@ -301,8 +421,8 @@ namespace zstl
                             //   p   u
                             //     c
                             RotateLR(grandfather);
-                            cur->col_ = Color::BLACK;
-                            grandfather->col_ = Color::RED;
+                            cur->set_color(Color::BLACK);
+                            grandfather->set_color(Color::RED);
                         }
                         // 这时该子树的根节点变为黑色，不需要继续调整
                         break;
@@ -312,13 +432,14 @@ namespace zstl
                 {
                     Node *uncle = grandfather->left_;
                     // 情况三：如果叔叔存在且为红
-                    if (uncle && uncle->col_ == Color::RED)
+                    if (uncle && uncle->color() == Color::RED)
                     {
-                        parent->col_ = uncle->col_ = Color::BLACK;
-                        grandfather->col_ = Color::RED;
+                        parent->set_color(Color::BLACK);
+                        uncle->set_color(Color::BLACK);
+                        grandfather->set_color(Color::RED);
                         // 继续调整
                         cur = grandfather;
-                        parent = cur->parent_;
+                        parent = cur->parent();
                     }
                     else
                     {
@@ -329,8 +450,8 @@ namespace zstl
                             //  u   p
                             //        c
                             RotateL(grandfather);
-                            parent->col_ = Color::BLACK;
-                            grandfather->col_ = Color::RED;
+                            parent->set_color(Color::BLACK);
+                            grandfather->set_color(Color::RED);
                         }
                         else // 情况五：叔叔不存在 / 存在且为黑，cur在parent的右侧
                         {
@@ -338,8 +459,8 @@ namespace zstl
                             //  u   p
                             //    c
                             RotateRL(grandfather);
-                            cur->col_ = Color::BLACK;
-                            grandfather->col_ = Color::RED;
+                            cur->set_color(Color::BLACK);
+                            grandfather->set_color(Color::RED);
                         }
                         // 这时该子树的根节点变为黑色，不需要继续调整
                         break;
@@ -351,62 +472,62 @@ namespace zstl
         // 删除调整
         void adjust_erase(Node *delCur, Node *delParent)
         {
-            if (delCur->col_ == Color::BLACK) // 删除的是黑色结点
+            if (delCur->color() == Color::BLACK) // 删除的是黑色结点
             {
                 if (delCur->left_) // 待删除结点有一个红色的左孩子（不可能是黑色）
                 {
-                    delCur->left_->col_ = Color::BLACK; // 将这个红色的左孩子变黑即可
+                    delCur->left_->set_color(Color::BLACK); // 将这个红色的左孩子变黑即可
                 }
                 else if (delCur->right_) // 待删除结点有一个红色的右孩子（不可能是黑色）
                 {
-                    delCur->right_->col_ = Color::BLACK; // 将这个红色的右孩子变黑即可
+                    delCur->right_->set_color(Color::BLACK); // 将这个红色的右孩子变黑即可
                 }
                 else // 待删除结点的左右均为空
                 {
-                    while (delCur != header_->parent_) // 可能一直调整到根结点
+                    while (delCur != header_->parent()) // 可能一直调整到根结点
                     {
                         if (delCur == delParent->left_) // 待删除结点是其父结点的左孩子
                         {
                             Node *brother = delParent->right_; // 兄弟结点是其父结点的右孩子
                                                                // 新增：若兄弟为空，视作黑色哨兵，向上继续调整
                             // 情况一：brother为红色
-                            if (brother->col_ == Color::RED)
+                            if (brother->color() == Color::RED)
                             {
-                                delParent->col_ = Color::RED;
-                                brother->col_ = Color::BLACK;
+                                delParent->set_color(Color::RED);
+                                brother->set_color(Color::BLACK);
                                 RotateL(delParent);
                                 // 需要继续处理
                                 brother = delParent->right_; // 更新brother
                             }
                             // 情况二：brother为黑色，且其左右孩子都是黑色结点或为空
-                            if (((brother->left_ == nullptr) || (brother->left_->col_ == Color::BLACK)) &&
-                                ((brother->right_ == nullptr) || (brother->right_->col_ == Color::BLACK)))
+                            if (((brother->left_ == nullptr) || (brother->left_->color() == Color::BLACK)) &&
+                                ((brother->right_ == nullptr) || (brother->right_->color() == Color::BLACK)))
                             {
-                                brother->col_ = Color::RED;
-                                if (delParent->col_ == Color::RED)
+                                brother->set_color(Color::RED);
+                                if (delParent->color() == Color::RED)
                                 {
-                                    delParent->col_ = Color::BLACK;
+                                    delParent->set_color(Color::BLACK);
                                     break;
                                 }
                                 // 需要继续处理
                                 delCur = delParent;
-                                delParent = delCur->parent_;
+                                delParent = delCur->parent();
                             }
                             else
                             {
                                 // 情况三：brother为黑色，且其左孩子是红色结点，右孩子是黑色结点或为空
-                                if ((brother->right_ == nullptr) || (brother->right_->col_ == Color::BLACK))
+                                if ((brother->right_ == nullptr) || (brother->right_->color() == Color::BLACK))
                                 {
-                                    brother->left_->col_ = Color::BLACK;
-                                    brother->col_ = Color::RED;
+                                    brother->left_->set_color(Color::BLACK);
+                                    brother->set_color(Color::RED);
                                     RotateR(brother);
                                     // 需要继续处理
                                     brother = delParent->right_; // 更新brother
                                 }
                                 // 情况四：brother为黑色，且其右孩子是红色结点
-                                brother->col_ = delParent->col_;
-                                delParent->col_ = Color::BLACK;
-                                brother->right_->col_ = Color::BLACK;
+                                brother->set_color(delParent->color());
+                                delParent->set_color(Color::BLACK);
+                                brother->right_->set_color(Color::BLACK);
                                 RotateL(delParent);
                                 break; // 情况四执行完毕后调整一定结束
                             }
@@ -415,42 +536,42 @@ namespace zstl
                         {
                             Node *brother = delParent->left_; // 兄弟结点是其父结点的左孩子
                             // 情况一：brother为红色
-                            if (brother->col_ == Color::RED) // brother为红色
+                            if (brother->color() == Color::RED) // brother为红色
                             {
-                                delParent->col_ = Color::RED;
-                                brother->col_ = Color::BLACK;
+                                delParent->set_color(Color::RED);
+                                brother->set_color(Color::BLACK);
                                 RotateR(delParent);
                                 // 需要继续处理
                                 brother = delParent->left_; // 更新brother
                             }
                             // 情况二：brother为黑色，且其左右孩子都是黑色结点或为空
-                            if (((brother->left_ == nullptr) || (brother->left_->col_ == Color::BLACK)) && ((brother->right_ == nullptr) || (brother->right_->col_ == Color::BLACK)))
+                            if (((brother->left_ == nullptr) || (brother->left_->color() == Color::BLACK)) && ((brother->right_ == nullptr) || (brother->right_->color() == Color::BLACK)))
                             {
-                                brother->col_ = Color::RED;
-                                if (delParent->col_ == Color::RED)
+                                brother->set_color(Color::RED);
+                                if (delParent->color() == Color::RED)
                                 {
-                                    delParent->col_ = Color::BLACK;
+                                    delParent->set_color(Color::BLACK);
                                     break;
                                 }
                                 // 需要继续处理
                                 delCur = delParent;
-                                delParent = delCur->parent_;
+                                delParent = delCur->parent();
                             }
                             else
                             {
                                 // 情况三：brother为黑色，且其右孩子是红色结点，左孩子是黑色结点或为空
-                                if ((brother->left_ == nullptr) || (brother->left_->col_ == Color::BLACK))
+                                if ((brother->left_ == nullptr) || (brother->left_->color() == Color::BLACK))
                                 {
-                                    brother->right_->col_ = Color::BLACK;
-                                    brother->col_ = Color::RED;
+                                    brother->right_->set_color(Color::BLACK);
+                                    brother->set_color(Color::RED);
                                     RotateL(brother);
                                     // 需要继续处理
                                     brother = delParent->left_; // 更新brother
                                 }
                                 // 情况四：brother为黑色，且其左孩子是红色结点
-                                brother->col_ = delParent->col_;
-                                delParent->col_ = Color::BLACK;
-                                brother->left_->col_ = Color::BLACK;
+                                brother->set_color(delParent->color());
+                                delParent->set_color(Color::BLACK);
+                                brother->left_->set_color(Color::BLACK);
                                 RotateR(delParent);
                                 break; // 情况四执行完毕后调整一定结束
                             }
@@ -460,16 +581,147 @@ namespace zstl
             }
         }
 
+        /**
+         * @brief 把 node 挂为 parent 的左 / 右孩子并维护最小、最大值指针
+         * @details parent 为 header_ 时 node 成为根；调用方随后负责 adjust_insert
+         */
+        void link_child(Node *node, Node *parent, bool left)
+        {
+            node->set_parent(parent);
+            if (parent == header_)
+            {
+                // 树原为空，新节点即根
+                header_->set_parent(node);
+                header_->left_ = header_->right_ = node;
+            }
+            else if (left)
+            {
+                parent->left_ = node;
+                // 更新最小值指针
+                if (header_->left_ == parent)
+                    header_->left_ = node;
+            }
+            else
+            {
+                parent->right_ = node;
+                // 更新最大值指针
+                if (header_->right_ == parent)
+                    header_->right_ = node;
+            }
+        }
+
+        /**
+         * @brief 交换 target 与其中序后继在树中的位置（连同颜色）
+         * @details 参考 libstdc++ 的 _Rb_tree_rebalance_for_erase：
+         *          successor 必无左孩子，交换后 target 至多只有一个右孩子
+         */
+        void swap_with_successor(Node *target, Node *successor)
+        {
+            Node *tp = target->parent();
+            Node *tl = target->left_;
+            Node *tr = target->right_;
+            Node *sp = successor->parent();
+            Node *sr = successor->right_;
+
+            // successor 接管 target 与父节点的链接
+            if (tp == header_)
+                header_->set_parent(successor);
+            else if (tp->left_ == target)
+                tp->left_ = successor;
+            else
+                tp->right_ = successor;
+            successor->set_parent(tp);
+
+            // successor 接管 target 的左子树
+            successor->left_ = tl;
+            tl->set_parent(successor);
+
+            if (sp == target)
+            {
+                // 后继就是 target 的右孩子
+                successor->right_ = target;
+                target->set_parent(successor);
+            }
+            else
+            {
+                // 后继是右子树的最左节点，必为其父的左孩子
+                successor->right_ = tr;
+                tr->set_parent(successor);
+                sp->left_ = target;
+                target->set_parent(sp);
+            }
+
+            // target 落到后继原来的位置
+            target->left_ = nullptr;
+            target->right_ = sr;
+            if (sr)
+                sr->set_parent(target);
+
+            Color col = target->color();
+            target->set_color(successor->color());
+            successor->set_color(col);
+            // 先更新下方的 target，再更新上方的 successor
+            augment_type::update(target);
+            augment_type::update(successor);
+        }
+
+        /**
+         * @brief 把至多有一个孩子的 del 从树中摘下（不释放），并维护最小、最大值指针
+         * @details 须在 adjust_erase(del, delP) 之后调用
+         */
+        void unlink_node(Node *del, Node *delP)
+        {
+            // 更新最大值与最小值：del 至多一个孩子，最小值无左孩子、最大值无右孩子
+            if (del == header_->left_)
+            {
+                Node *next = del->right_;
+                if (next)
+                    while (next->left_)
+                        next = next->left_;
+                header_->left_ = next ? next : delP;
+            }
+            if (del == header_->right_)
+            {
+                Node *prev = del->left_;
+                if (prev)
+                    while (prev->right_)
+                        prev = prev->right_;
+                header_->right_ = prev ? prev : delP;
+            }
+
+            Node *child = del->left_ ? del->left_ : del->right_;
+            // 根节点被删：直接将唯一子节点提到根
+            if (delP == header_)
+            {
+                header_->set_parent(child);
+                if (child != nullptr)
+                {
+                    child->set_parent(header_);
+                    child->set_color(Color::BLACK);
+                }
+            }
+            else
+            {
+                if (del == delP->left_)
+                    delP->left_ = child;
+                else
+                    delP->right_ = child;
+                if (child)
+                    child->set_parent(delP);
+            }
+        }
+
     protected:
         Node *header_ = nullptr;
     };
 
     // 红黑树的基础操作
-    template <typename K, typename T, typename Compare, typename Alloc>
-    class RBTreeBase : public RBBalance<T>
+    template <typename K, typename T, typename Compare, typename Alloc, typename NodeT = RBNode<T>>
+    class RBTreeBase : public RBBalance<NodeT>
     {
-        using Node = RBNode<T>;
-        using iterator = RBTreeIterator<T, T &, T *>;
+        using Node = NodeT;
+        using iterator = RBTreeIterator<T, T &, T *, NodeT>;
+        using augment_type = typename Node::augment_type;
 
     public:
         using allocator_type = Alloc;
@@ -488,7 +740,7 @@ namespace zstl
         auto insert_impl(Args &&...args)
         {
             Node *parent = this->header_;
-            Node *cur = this->header_->parent_;
+            Node *cur = this->header_->parent();
             Node *newnode = create_node(std::forward<Args>(args)...);
 
             // 定位插入点（重复时统一走右支）
@@ -514,12 +766,13 @@ namespace zstl
             }
 
             // 创建并挂接
-            newnode->parent_ = parent;
+            newnode->set_parent(parent);
             this->link_node(newnode, parent);
+            augment_type::propagate(parent, this->header_, 1);
 
             // 平衡调整
             this->adjust_insert(newnode, parent);
-            this->header_->parent_->col_ = Color::BLACK;
+            this->header_->parent()->set_color(Color::BLACK);
 
             if constexpr (Unique)
                 return std::pair<Node *, bool>{newnode, true};
@@ -530,35 +783,26 @@ namespace zstl
         // 删除的辅助函数
         Node *erase_impl(Node *target, Node *successor)
         {
-            // 1. 定位待真正删除的节点 del and its parent delP
-            Node *del = nullptr, *delP = nullptr;
-            if (!target->left_ || !target->right_)
-            {
-                // 度0或1：直接删除 target
-                del = target;
-                delP = target->parent_;
-            }
-            else
+            // 1. 双子节点：让后继节点在结构上顶替 target，target 落到后继原来的位置（度0或1）
+            //    只改指针不搬数据，其余节点（包括后继）的迭代器保持有效
+            if (target->left_ && target->right_)
             {
-                // 情况 B/双子：交换数据后，将后继节点（必为半叶）设为删除对象
-                this->copy_delete_node(target->data_, successor->data_);
-                del = successor;
-                delP = successor->parent_;
-                successor = target;
+                this->swap_with_successor(target, successor);
             }
+            Node *del = target;
+            Node *delP = target->parent();
 
             // 2. 红黑树删除调整
-            Node *del_node = del;
-            Node *del_node_parent = delP;
-            this->adjust_erase(del, delP);                // 恢复红黑性质
-            this->delete_node(del_node, del_node_parent); // 实际摘除节点并释放
+            this->adjust_erase(del, delP);   // 恢复红黑性质
+            this->delete_node(del, delP);    // 实际摘除节点并释放
+            augment_type::propagate(delP, this->header_, -1);
             return successor;
         }
 
         // 查找节点
         Node *find_impl(const K &val) const
         {
-            Node *cur = this->header_->parent_;
+            Node *cur = this->header_->parent();
             while (cur)
             {
                 if (this->com_(val, this->kov_(cur->data_)))
@@ -580,109 +824,78 @@ namespace zstl
             return this->header_;
         }
 
-        // 插入链接节点
-        void link_node(Node *newnode, Node *parent)
+        // 批量查找时同时推进的下降路径数
+        static constexpr size_t BATCH_GROUP = 16;
+
+        /**
+         * @brief 批量查找：每组 BATCH_GROUP 个键交错下降
+         * @details 每一轮让组内每条路径各下降一层，并预取下一层节点；
+         *          处理完一整轮后再回到第一条路径时，其节点大概率已在缓存中，
+         *          从而把各次查找的缓存缺失重叠起来
+         * @param emit 以 (下标, 节点) 回调结果，未找到时节点为 header_
+         */
+        template <typename Emit>
+        void find_batch_impl(const K *keys, size_t n, Emit emit) const
         {
-            if (parent == this->header_)
-            {
-                // 树原为空，新节点即根
-                this->header_->parent_ = newnode;
-                this->header_->left_ = this->header_->right_ = newnode;
-            }
-            else if (this->com_(this->kov_(newnode->data_), this->kov_(parent->data_)))
+            Node *cur[BATCH_GROUP];
+            for (size_t base = 0; base < n; base += BATCH_GROUP)
             {
-                parent->left_ = newnode;
-                // 更新最小值指针
-                if (this->header_->left_ == parent)
-                    this->header_->left_ = newnode;
-            }
-            else
-            {
-                parent->right_ = newnode;
-                // 更新最大值指针
-                if (this->header_->right_ == parent)
-                    this->header_->right_ = newnode;
-            }
-        }
-
-        // 删除节点
-        void delete_node(Node *del, Node *delP)
-        {
-            // 更新最大值与最小值
-            if (del == this->header_->left_)
-            {
-                iterator next(del);
-                ++next;
-                this->header_->left_ = next.node_;
-            }
-            if (del == this->header_->right_)
-            {
-                iterator prev(del);
-                --prev;
-                this->header_->right_ = prev.node_;
-            }
-
-            // 根节点被删：直接将唯一子节点提到根
-            if (delP == this->header_)
-            {
-                // 调整红黑树
-                Node *child = del->left_ ? del->left_ : del->right_;
-                this->header_->parent_ = child;
-                if (child != nullptr)
+                size_t group = n - base < BATCH_GROUP ? n - base : BATCH_GROUP;
+                for (size_t i = 0; i < group; ++i)
                 {
-                    child->parent_ = this->header_;
-                    child->col_ = Color::BLACK;
+                    cur[i] = this->header_->parent();
+                    emit(base + i, this->header_);
                 }
-            }
-            else if (del->left_ == nullptr) // 实际删除结点的左子树为空
-            {
-                if (del == delP->left_) // 实际删除结点是其父结点的左孩子
-                {
-                    delP->left_ = del->right_;
-                    // 指向父节点
-                    if (del->right_)
-                        del->right_->parent_ = delP;
-                }
-                else // 实际删除结点是其父结点的右孩子
-                {
-                    delP->right_ = del->right_;
-                    if (del->right_)
-                        del->right_->parent_ = delP;
-                }
-            }
-            else // 实际删除结点的右子树为空
-            {
-                if (del == delP->left_) // 实际删除结点是其父结点的左孩子
-                {
-                    delP->left_ = del->left_;
-                    if (del->left_)
-                        del->left_->parent_ = delP;
-                }
-                else // 实际删除结点是其父结点的右孩子
+
+                size_t active = group;
+                while (active)
                 {
-                    delP->right_ = del->left_;
-                    if (del->left_)
-                        del->left_->parent_ = delP;
+                    active = 0;
+                    for (size_t i = 0; i < group; ++i)
+                    {
+                        Node *node = cur[i];
+                        if (!node)
+                            continue;
+                        const K &key = keys[base + i];
+                        if (this->com_(key, this->kov_(node->data_)))
+                        {
+                            node = node->left_;
+                        }
+                        else if (this->com_(this->kov_(node->data_), key))
+                        {
+                            node = node->right_;
+                        }
+                        else
+                        {
+                            // 找到了，该路径结束
+                            emit(base + i, node);
+                            node = nullptr;
+                        }
+                        cur[i] = node;
+                        if (node)
+                        {
+                            __builtin_prefetch(node);
+                            ++active;
+                        }
+                    }
                 }
             }
-
-            this->destroy_node(del); // 实际删除结点
         }
 
-        // 复制节点
-        template <typename L, typename R>
-        void copy_delete_node(std::pair<const L, R> &a, std::pair<const L, R> &b)
+        // 插入链接节点
+        void link_node(Node *newnode, Node *parent)
         {
-            // 赋值 const key —— const_cast 是常见 hack
-            const_cast<L &>(a.first) = b.first;
-            // 赋值 mapped value
-            a.second = b.second;
+            if (parent == this->header_)
+                this->link_child(newnode, parent, true);
+            else
+                this->link_child(newnode, parent, this->com_(this->kov_(newnode->data_), this->kov_(parent->data_)));
         }
 
-        template <typename L>
-        void copy_delete_node(L &a, L &b)
+        // 删除节点
+        void delete_node(Node *del, Node *delP)
         {
-            const_cast<L &>(a) = b;
+            this->unlink_node(del, delP);
+            this->destroy_node(del); // 实际删除结点
         }
 
         // 创建节点
@@ -691,7 +904,8 @@ namespace zstl
         {
             Node *newnode = node_traits_alloc::allocate(node_alloc_, 1);
             node_traits_alloc::construct(node_alloc_, newnode, std::forward<Args>(args)...);
-            newnode->left_ = newnode->right_ = newnode->parent_ = nullptr;
+            newnode->left_ = newnode->right_ = nullptr;
+            newnode->set_parent(nullptr);
             return newnode;
         }
 
@@ -710,17 +924,18 @@ namespace zstl
     };
 
     // 红黑树
-    template <typename K, typename T, typename Compare, typename Alloc>
-    class RBTree : public RBTreeBase<K, T, Compare, Alloc>
+    template <typename K, typename T, typename Compare, typename Alloc, typename NodeT = RBNode<T>>
+    class RBTree : public RBTreeBase<K, T, Compare, Alloc, NodeT>
     {
-        using Node = RBNode<T>;
+        using Node = NodeT;
+        using augment_type = typename Node::augment_type;
 
     public:
         using allocator_type = Alloc;
 
         // 迭代器
-        using iterator = RBTreeIterator<T, T &, T *>;
-        using const_iterator = RBTreeIterator<T, const T &, const T *>;
+        using iterator = RBTreeIterator<T, T &, T *, NodeT>;
+        using const_iterator = RBTreeIterator<T, const T &, const T *, NodeT>;
 
         iterator begin()
         {
@@ -766,8 +981,8 @@ namespace zstl
             this->alloc_ = t.alloc_;
             this->node_alloc_ = this->alloc_;
             init_header();
-            this->header_->parent_ = copy(t.header_->parent_);
-            adjust_header_pointers(this->header_->parent_);
+            this->header_->set_parent(copy(t.header_->parent()));
+            adjust_header_pointers(this->header_->parent());
             size_ = t.size_;
         }
 
@@ -814,7 +1029,7 @@ namespace zstl
         iterator lower_bound(const K &k)
         {
             // 根节点
-            Node *cur = this->header_->parent_;
+            Node *cur = this->header_->parent();
             // 候选，初始为 header_（即 end()）
             Node *res = this->header_;
             while (cur)
@@ -836,7 +1051,7 @@ namespace zstl
 
         const_iterator lower_bound(const K &k) const
         {
-            Node *cur = this->header_->parent_;
+            Node *cur = this->header_->parent();
             Node *res = this->header_;
             while (cur)
             {
@@ -856,7 +1071,7 @@ namespace zstl
         // upper_bound：第一个 > k
         iterator upper_bound(const K &k)
         {
-            Node *cur = this->header_->parent_;
+            Node *cur = this->header_->parent();
             Node *res = this->header_;
             while (cur)
             {
@@ -877,7 +1092,7 @@ namespace zstl
 
         const_iterator upper_bound(const K &k) const
         {
-            Node *cur = this->header_->parent_;
+            Node *cur = this->header_->parent();
             Node *res = this->header_;
             while (cur)
             {
@@ -941,19 +1156,12 @@ namespace zstl
                 return end();
             }
 
-            // 否则逐节点删除，因为删除存在替换删除逻辑
-            // 如果last被替换，就会出现一直first!=last的情况
-            const_iterator ret = const_iterator(last.node_);
+            // 否则逐节点删除，删除只重链节点，last 始终有效
             while (first != last)
             {
-                const_iterator cur = first++;
-                ret = erase(cur);
-                if (ret != first && first != last)
-                {
-                    first = ret;
-                }
+                first = erase(first);
             }
-            return iterator(ret.node_); // 返回下一个有效迭代器
+            return iterator(last.node_); // 返回下一个有效迭代器
         }
         size_t erase(const K &key)
         {
@@ -964,6 +1172,97 @@ namespace zstl
             return 1;
         }
 
+        /**
+         * @brief 批量查找：out[i] 为 keys[i] 对应的迭代器，未找到时为 end()
+         * @tparam It iterator 或 const_iterator
+         */
+        template <typename It>
+        void find_batch(const K *keys, size_t n, It *out) const
+        {
+            this->find_batch_impl(keys, n, [out](size_t i, Node *node)
+                                  { out[i] = It(node); });
+        }
+
+        // 批量判断键是否存在
+        void contains_batch(const K *keys, size_t n, bool *out) const
+        {
+            this->find_batch_impl(keys, n, [this, out](size_t i, Node *node)
+                                  { out[i] = node != this->header_; });
+        }
+
+        /* 顺序统计：以下接口要求节点使用 RBSizeAugment 维护子树大小 */
+
+        // 返回中序第 k 个（从 0 开始）元素，k 越界时返回 end()
+        iterator select(size_t k) const
+        {
+            static_assert(std::is_same_v<augment_type, RBSizeAugment>,
+                          "select requires RBSizeAugment");
+            Node *cur = this->header_->parent();
+            while (cur)
+            {
+                size_t left_size = RBSizeAugment::size(cur->left_);
+                if (k < left_size)
+                {
+                    cur = cur->left_;
+                }
+                else if (k == left_size)
+                {
+                    return iterator(cur);
+                }
+                else
+                {
+                    // 跳过左子树与当前节点
+                    k -= left_size + 1;
+                    cur = cur->right_;
+                }
+            }
+            return iterator(this->header_);
+        }
+
+        // 返回严格小于 k 的元素个数，即 lower_bound(k) 的下标
+        size_t lower_rank(const K &k) const
+        {
+            static_assert(std::is_same_v<augment_type, RBSizeAugment>,
+                          "lower_rank requires RBSizeAugment");
+            Node *cur = this->header_->parent();
+            size_t rank = 0;
+            while (cur)
+            {
+                if (this->com_(this->kov_(cur->data_), k))
+                {
+                    rank += RBSizeAugment::size(cur->left_) + 1;
+                    cur = cur->right_;
+                }
+                else
+                {
+                    cur = cur->left_;
+                }
+            }
+            return rank;
+        }
+
+        // 返回小于等于 k 的元素个数，即 upper_bound(k) 的下标
+        size_t upper_rank(const K &k) const
+        {
+            static_assert(std::is_same_v<augment_type, RBSizeAugment>,
+                          "upper_rank requires RBSizeAugment");
+            Node *cur = this->header_->parent();
+            size_t rank = 0;
+            while (cur)
+            {
+                if (this->com_(k, this->kov_(cur->data_)))
+                {
+                    cur = cur->left_;
+                }
+                else
+                {
+                    rank += RBSizeAugment::size(cur->left_) + 1;
+                    cur = cur->right_;
+                }
+            }
+            return rank;
+        }
+
         // 获取有效数据个数
         size_t size() const
         {
@@ -987,8 +1286,8 @@ namespace zstl
         // 清空节点
         void clear()
         {
-            destroy(this->header_->parent_);
-            this->header_->parent_ = nullptr;
+            destroy(this->header_->parent());
+            this->header_->set_parent(nullptr);
             this->header_->left_ = this->header_;
             this->header_->right_ = this->header_;
             size_ = 0;
@@ -1005,7 +1304,7 @@ namespace zstl
 
     private:
         // 销毁除header之外的节点
-        void destroy(Node *&root)
+        void destroy(Node *root)
         {
             if (root == nullptr)
             {
@@ -1017,7 +1316,6 @@ namespace zstl
             destroy(root->right_);
             // 销毁根节点
             this->destroy_node(root);
-            root = nullptr;
         }
 
         Node *copy(Node *root)
@@ -1034,19 +1332,20 @@ namespace zstl
             // 递归拷贝右子树
             newnode->right_ = copy(root->right_);
             // 将新节点的父节点指针置为空
-            newnode->parent_ = nullptr;
+            newnode->set_parent(nullptr);
             // 拷贝原始节点的颜色信息
-            newnode->col_ = root->col_;
+            newnode->set_color(root->color());
+            augment_type::update(newnode);
 
             // 如果新节点的左子节点存在，设置其父节点为新节点
             if (newnode->left_)
             {
-                newnode->left_->parent_ = newnode;
+                newnode->left_->set_parent(newnode);
             }
             // 如果新节点的右子节点存在，设置其父节点为新节点
             if (newnode->right_)
             {
-                newnode->right_->parent_ = newnode;
+                newnode->right_->set_parent(newnode);
             }
             return newnode;
         }
@@ -1055,10 +1354,10 @@ namespace zstl
         void init_header()
         {
             this->header_ = this->create_node(T());
-            this->header_->col_ = Color::RED;
+            this->header_->set_color(Color::RED);
             this->header_->left_ = this->header_;
             this->header_->right_ = this->header_;
-            this->header_->parent_ = nullptr;
+            this->header_->set_parent(nullptr);
             size_ = 0;
         }
 
@@ -1086,7 +1385,7 @@ namespace zstl
                 max_node = max_node->right_;
             }
             this->header_->right_ = max_node;
-            this->header_->parent_->parent_ = this->header_;
+            this->header_->parent()->set_parent(this->header_);
         }
 
     private:
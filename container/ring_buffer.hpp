@@ -0,0 +1,395 @@
+#pragma once
+#include <cassert>
+#include <cstring>
+#include <initializer_list>
+#include <utility>
+#include "../iterator/reverse_iterator.hpp"
+#include "../allocator/alloc.hpp"
+#include "../allocator/memory.hpp"
+#include "../algorithm/algo.hpp"
+namespace zstl
+{
+    inline constexpr size_t RING_MIN_CAPACITY = 4; // 按需扩容时的最小容量
+
+    // 不小于 n 的最小 2 的幂（n == 0 时为 1）
+    constexpr size_t ring_capacity_for(size_t n)
+    {
+        size_t cap = 1;
+        while (cap < n)
+            cap <<= 1;
+        return cap;
+    }
+
+    //--------------------------------------------------------------------------------
+    // ring_buffer 迭代器
+    // idx_ 为未取模的物理下标（head + 逻辑偏移），解引用时才与 mask_ 相与
+    //--------------------------------------------------------------------------------
+    template <typename T, typename Ptr, typename Ref>
+    struct RingIterator
+    {
+    private:
+        using Self = RingIterator<T, Ptr, Ref>;
+
+    public:
+        using iterator_category = random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = Ptr;
+        using reference = Ref;
+
+    public:
+        RingIterator() : buf_(nullptr), mask_(0), idx_(0) {}
+        RingIterator(T *buf, size_t mask, size_t idx) : buf_(buf), mask_(mask), idx_(idx) {}
+
+        // 普通迭代器构造 const 迭代器
+        template <typename P, typename R, typename = std::enable_if_t<std::is_convertible_v<P, Ptr>>>
+        RingIterator(const RingIterator<T, P, R> &o) : buf_(o.buf_), mask_(o.mask_), idx_(o.idx_)
+        {
+        }
+
+        Ref operator*() const { return buf_[idx_ & mask_]; }
+        Ptr operator->() const { return buf_ + (idx_ & mask_); }
+        Ref operator[](difference_type n) const { return buf_[(idx_ + n) & mask_]; }
+
+        Self &operator++()
+        {
+            ++idx_;
+            return *this;
+        }
+        Self operator++(int)
+        {
+            Self tmp(*this);
+            ++idx_;
+            return tmp;
+        }
+        Self &operator--()
+        {
+            --idx_;
+            return *this;
+        }
+        Self operator--(int)
+        {
+            Self tmp(*this);
+            --idx_;
+            return tmp;
+        }
+        Self &operator+=(difference_type n)
+        {
+            idx_ += n;
+            return *this;
+        }
+        Self &operator-=(difference_type n)
+        {
+            idx_ -= n;
+            return *this;
+        }
+        Self operator+(difference_type n) const { return Self(buf_, mask_, idx_ + n); }
+        Self operator-(difference_type n) const { return Self(buf_, mask_, idx_ - n); }
+        difference_type operator-(const Self &o) const { return static_cast<difference_type>(idx_ - o.idx_); }
+
+        bool operator==(const Self &o) const { return idx_ == o.idx_; }
+        bool operator!=(const Self &o) const { return idx_ != o.idx_; }
+        bool operator<(const Self &o) const { return idx_ < o.idx_; }
+        bool operator>(const Self &o) const { return idx_ > o.idx_; }
+        bool operator<=(const Self &o) const { return idx_ <= o.idx_; }
+        bool operator>=(const Self &o) const { return idx_ >= o.idx_; }
+
+        T *buf_;      // 存储首地址
+        size_t mask_; // 容量 - 1
+        size_t idx_;  // 未取模的物理下标
+    };
+
+    /**
+     * 环形缓冲区：容量为 2 的幂的连续存储，两端 O(1) 插入删除，支持随机访问
+     * 默认满时按 2 倍扩容；overwrite 模式下容量固定，满时覆盖另一端最旧的元素
+     * 提供 push/pop_front/back 等接口，可作为 queue / stack 的底层容器
+     */
+    template <typename T, typename Alloc = alloc<T>>
+    class ring_buffer
+    {
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+        using traits_allocator = allocator_traits<allocator_type>;
+        using pointer = typename traits_allocator::pointer;
+        using const_pointer = typename traits_allocator::const_pointer;
+        using reference = T &;
+        using const_reference = const T &;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using iterator = RingIterator<T, pointer, reference>;
+        using const_iterator = RingIterator<T, const_pointer, const_reference>;
+        using reverse_iterator = basic_reverse_iterator<iterator>;
+        using const_reverse_iterator = basic_reverse_iterator<const_iterator>;
+
+    public:
+        ring_buffer(const allocator_type &alloc = allocator_type())
+            : alloc_(alloc), buf_(nullptr), cap_(0), head_(0), size_(0), overwrite_(false)
+        {
+        }
+
+        // 预留至少 capacity 个位置（向上取 2 的幂）；overwrite 为真时容量固定，满时覆盖最旧元素
+        explicit ring_buffer(size_type capacity, bool overwrite = false,
+                             const allocator_type &alloc = allocator_type())
+            : alloc_(alloc), buf_(nullptr), cap_(0), head_(0), size_(0), overwrite_(overwrite)
+        {
+            reallocate(ring_capacity_for(capacity));
+        }
+
+        ring_buffer(std::initializer_list<T> il, const allocator_type &alloc = allocator_type())
+            : ring_buffer(alloc)
+        {
+            reserve(il.size());
+            for (auto &v : il)
+                traits_allocator::construct(alloc_, buf_ + size_++, v);
+        }
+
+        ring_buffer(const ring_buffer &other)
+            : alloc_(other.alloc_), buf_(nullptr), cap_(0), head_(0), size_(0), overwrite_(other.overwrite_)
+        {
+            if (other.cap_)
+                reallocate(other.cap_);
+            for (const auto &v : other)
+                traits_allocator::construct(alloc_, buf_ + size_++, v);
+        }
+
+        ring_buffer(ring_buffer &&other) noexcept
+            : alloc_(std::move(other.alloc_)), buf_(other.buf_), cap_(other.cap_),
+              head_(other.head_), size_(other.size_), overwrite_(other.overwrite_)
+        {
+            other.buf_ = nullptr;
+            other.cap_ = other.head_ = other.size_ = 0;
+        }
+
+        ring_buffer &operator=(const ring_buffer &other)
+        {
+            if (this != &other)
+            {
+                ring_buffer tmp(other);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        ring_buffer &operator=(ring_buffer &&other) noexcept
+        {
+            if (this != &other)
+            {
+                ring_buffer tmp(std::move(other));
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        ~ring_buffer()
+        {
+            clear();
+            if (buf_)
+                traits_allocator::deallocate(alloc_, buf_, cap_);
+        }
+
+        // 迭代器接口
+        iterator begin() noexcept { return iterator(buf_, cap_ - 1, head_); }
+        iterator end() noexcept { return iterator(buf_, cap_ - 1, head_ + size_); }
+        const_iterator begin() const noexcept { return const_iterator(buf_, cap_ - 1, head_); }
+        const_iterator end() const noexcept { return const_iterator(buf_, cap_ - 1, head_ + size_); }
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+        // 容量
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+        [[nodiscard]] bool full() const noexcept { return size_ == cap_; }
+        [[nodiscard]] size_type size() const noexcept { return size_; }
+        [[nodiscard]] size_type capacity() const noexcept { return cap_; }
+        [[nodiscard]] bool overwrite() const noexcept { return overwrite_; }
+        void set_overwrite(bool on) noexcept { overwrite_ = on; }
+
+        // 容量不足 n 时扩到不小于 n 的 2 的幂
+        void reserve(size_type n)
+        {
+            if (n > cap_)
+                reallocate(ring_capacity_for(n));
+        }
+
+        // 访问
+        reference operator[](size_type pos)
+        {
+            assert(pos < size_);
+            return buf_[slot(pos)];
+        }
+        const_reference operator[](size_type pos) const
+        {
+            assert(pos < size_);
+            return buf_[slot(pos)];
+        }
+        reference front()
+        {
+            assert(!empty());
+            return buf_[head_];
+        }
+        const_reference front() const
+        {
+            assert(!empty());
+            return buf_[head_];
+        }
+        reference back()
+        {
+            assert(!empty());
+            return buf_[slot(size_ - 1)];
+        }
+        const_reference back() const
+        {
+            assert(!empty());
+            return buf_[slot(size_ - 1)];
+        }
+
+        // 尾部构造；满时扩容，overwrite 模式下覆盖队头
+        template <typename... Args>
+        reference emplace_back(Args &&...args)
+        {
+            if (size_ == cap_)
+            {
+                if (overwrite_ && cap_)
+                {
+                    // 队头槽位即新的队尾：先构造临时对象，防止参数引用被覆盖的元素
+                    size_type pos = head_;
+                    buf_[pos] = T(std::forward<Args>(args)...);
+                    head_ = (head_ + 1) & (cap_ - 1);
+                    return buf_[pos];
+                }
+                return realloc_emplace(size_, std::forward<Args>(args)...);
+            }
+            pointer p = buf_ + slot(size_);
+            traits_allocator::construct(alloc_, p, std::forward<Args>(args)...);
+            ++size_;
+            return *p;
+        }
+
+        // 头部构造；满时扩容，overwrite 模式下覆盖队尾
+        template <typename... Args>
+        reference emplace_front(Args &&...args)
+        {
+            if (size_ == cap_)
+            {
+                if (overwrite_ && cap_)
+                {
+                    head_ = (head_ - 1) & (cap_ - 1);
+                    buf_[head_] = T(std::forward<Args>(args)...);
+                    return buf_[head_];
+                }
+                realloc_emplace(0, std::forward<Args>(args)...);
+                return buf_[head_];
+            }
+            head_ = (head_ - 1) & (cap_ - 1);
+            traits_allocator::construct(alloc_, buf_ + head_, std::forward<Args>(args)...);
+            ++size_;
+            return buf_[head_];
+        }
+
+        void push_back(const value_type &val) { emplace_back(val); }
+        void push_back(value_type &&val) { emplace_back(std::move(val)); }
+        void push_front(const value_type &val) { emplace_front(val); }
+        void push_front(value_type &&val) { emplace_front(std::move(val)); }
+
+        void pop_front()
+        {
+            assert(!empty());
+            traits_allocator::destroy(alloc_, buf_ + head_);
+            head_ = (head_ + 1) & (cap_ - 1);
+            --size_;
+        }
+
+        void pop_back()
+        {
+            assert(!empty());
+            traits_allocator::destroy(alloc_, buf_ + slot(size_ - 1));
+            --size_;
+        }
+
+        // 析构全部元素，保留存储
+        void clear() noexcept
+        {
+            for (size_type i = 0; i < size_; ++i)
+                traits_allocator::destroy(alloc_, buf_ + slot(i));
+            head_ = size_ = 0;
+        }
+
+        void swap(ring_buffer &o) noexcept
+        {
+            zstl::swap(alloc_, o.alloc_);
+            zstl::swap(buf_, o.buf_);
+            zstl::swap(cap_, o.cap_);
+            zstl::swap(head_, o.head_);
+            zstl::swap(size_, o.size_);
+            zstl::swap(overwrite_, o.overwrite_);
+        }
+
+    private:
+        // 逻辑下标 i 对应的物理槽位
+        size_type slot(size_type i) const noexcept { return (head_ + i) & (cap_ - 1); }
+
+        /**
+         * 把 [0, n) 个逻辑元素按顺序搬到 dest 起始的未初始化内存并析构源元素
+         * 环形存储最多分两段；可平凡重定位的类型按段 memcpy
+         */
+        void relocate_to(pointer dest, size_type n)
+        {
+            if (n == 0)
+                return;
+            size_type first_len = cap_ - head_ < n ? cap_ - head_ : n;
+            if constexpr (is_trivially_relocatable_v<T>)
+            {
+                std::memcpy(static_cast<void *>(dest), static_cast<const void *>(buf_ + head_), first_len * sizeof(T));
+                std::memcpy(static_cast<void *>(dest + first_len), static_cast<const void *>(buf_), (n - first_len) * sizeof(T));
+            }
+            else
+            {
+                for (size_type i = 0; i < n; ++i)
+                {
+                    pointer src = buf_ + slot(i);
+                    traits_allocator::construct(alloc_, dest + i, std::move_if_noexcept(*src));
+                    traits_allocator::destroy(alloc_, src);
+                }
+            }
+        }
+
+        // 换用容量为 new_cap（2 的幂）的存储，元素重排到 [0, size_)
+        void reallocate(size_type new_cap)
+        {
+            pointer tmp = traits_allocator::allocate(alloc_, new_cap);
+            relocate_to(tmp, size_);
+            if (buf_)
+                traits_allocator::deallocate(alloc_, buf_, cap_);
+            buf_ = tmp;
+            cap_ = new_cap;
+            head_ = 0;
+        }
+
+        // 满时在逻辑位置 idx（0 或 size_）构造新元素：先构造新元素再搬移旧元素，参数可引用旧元素
+        template <typename... Args>
+        reference realloc_emplace(size_type idx, Args &&...args)
+        {
+            size_type new_cap = cap_ ? cap_ * 2 : RING_MIN_CAPACITY;
+            pointer tmp = traits_allocator::allocate(alloc_, new_cap);
+            traits_allocator::construct(alloc_, tmp + idx, std::forward<Args>(args)...);
+            relocate_to(tmp + (idx == 0 ? 1 : 0), size_);
+            if (buf_)
+                traits_allocator::deallocate(alloc_, buf_, cap_);
+            buf_ = tmp;
+            cap_ = new_cap;
+            head_ = 0;
+            ++size_;
+            return buf_[idx];
+        }
+
+    private:
+        allocator_type alloc_; // 元素分配器
+        pointer buf_;          // 连续存储
+        size_type cap_;        // 容量，0 或 2 的幂
+        size_type head_;       // 队头物理下标
+        size_type size_;       // 元素个数
+        bool overwrite_;       // 满时是否覆盖最旧元素
+    };
+}
@@ -0,0 +1,778 @@
+#pragma once
+#include <cassert>
+#include <iostream>
+#include <new>
+#include "../iterator/iterator.hpp"
+#include "../allocator/alloc.hpp"
+#include "../allocator/memory.hpp"
+#include "char_traits.hpp"
+#include "string_view.hpp"
+#include "string.hpp"
+namespace zstl
+{
+    inline constexpr size_t ROPE_LEAF_MAX = 512; // 短片段拼接时合并成叶子，合并结果不超过此长度
+    inline constexpr size_t ROPE_SLICE_MIN = 64; // 短于此长度的子串直接复制，不再引用原叶子
+    inline constexpr int ROPE_MAX_DEPTH = 48;    // 拼接后深度超过此值时重新平衡
+
+    /**
+     * 节点公共部分，三种节点：
+     * - LEAF：字符紧跟在节点之后，capacity_ 为可容纳的字符数
+     * - CONCAT：左右两棵子树的拼接
+     * - SLICE：引用某个叶子的一段字符，子串不复制
+     * 节点按引用计数在多个 rope 之间共享，除独占的右侧路径上的原地追加外一经创建不再修改
+     * 计数不是原子的：共享节点的 rope 不能在多个线程中同时修改或析构，与分配器的约束一致
+     */
+    struct RopeNode
+    {
+        enum Kind : unsigned char
+        {
+            LEAF,
+            CONCAT,
+            SLICE
+        };
+
+        size_t refs_;          // 引用计数
+        size_t size_;          // 子树字符数
+        Kind kind_;            // 节点种类
+        unsigned char depth_;  // 子树深度，叶子与切片为 0
+
+        RopeNode(Kind k, size_t n, unsigned char d) noexcept : refs_(1), size_(n), kind_(k), depth_(d) {}
+    };
+
+    template <typename CharT>
+    struct RopeLeaf : RopeNode
+    {
+        size_t capacity_; // 可容纳的字符数
+
+        RopeLeaf(size_t n, size_t cap) noexcept : RopeNode(LEAF, n, 0), capacity_(cap) {}
+        CharT *data() noexcept { return reinterpret_cast<CharT *>(this + 1); }
+        const CharT *data() const noexcept { return reinterpret_cast<const CharT *>(this + 1); }
+    };
+
+    struct RopeConcat : RopeNode
+    {
+        RopeNode *left_;
+        RopeNode *right_;
+
+        RopeConcat(RopeNode *l, RopeNode *r) noexcept
+            : RopeNode(CONCAT, l->size_ + r->size_,
+                       static_cast<unsigned char>(1 + (l->depth_ > r->depth_ ? l->depth_ : r->depth_))),
+              left_(l), right_(r)
+        {
+        }
+    };
+
+    template <typename CharT>
+    struct RopeSlice : RopeNode
+    {
+        RopeLeaf<CharT> *base_; // 被引用的叶子
+        size_t offset_;         // 起始下标
+
+        RopeSlice(RopeLeaf<CharT> *base, size_t off, size_t n) noexcept
+            : RopeNode(SLICE, n, 0), base_(base), offset_(off)
+        {
+        }
+    };
+
+    // 叶子或切片的首字符
+    template <typename CharT>
+    inline const CharT *rope_chunk_data(const RopeNode *n) noexcept
+    {
+        if (n->kind_ == RopeNode::LEAF)
+            return static_cast<const RopeLeaf<CharT> *>(n)->data();
+        auto s = static_cast<const RopeSlice<CharT> *>(n);
+        return s->base_->data() + s->offset_;
+    }
+
+    // 平衡判定表：深度为 d 的平衡子树至少有 fib(d + 2) 个字符
+    struct RopeMinLength
+    {
+        size_t len_[ROPE_MAX_DEPTH + 2];
+
+        constexpr RopeMinLength() : len_()
+        {
+            len_[0] = 1;
+            len_[1] = 2;
+            for (int i = 2; i < ROPE_MAX_DEPTH + 2; ++i)
+                len_[i] = len_[i - 1] + len_[i - 2];
+        }
+    };
+    inline constexpr RopeMinLength ROPE_MIN_LENGTH{};
+
+    /**
+     * 分块迭代器：按顺序给出每个叶子 / 切片对应的连续字符（视图），不复制
+     * 可直接用于组装 writev 的 iovec；显式栈保存待访问的右子树，深度不超过 ROPE_MAX_DEPTH
+     */
+    template <typename CharT, typename Traits>
+    class RopeChunkIterator
+    {
+    public:
+        using iterator_category = forward_iterator_tag;
+        using value_type = basic_string_view<CharT, Traits>;
+        using difference_type = ptrdiff_t;
+        using pointer = const value_type *;
+        using reference = value_type;
+
+        RopeChunkIterator() noexcept : cur_(nullptr), pos_(0), top_(0) {}
+        RopeChunkIterator(const RopeNode *root, size_t pos) noexcept : cur_(nullptr), pos_(pos), top_(0)
+        {
+            if (root)
+                descend(root);
+        }
+
+        value_type operator*() const noexcept { return value_type(rope_chunk_data<CharT>(cur_), cur_->size_); }
+
+        RopeChunkIterator &operator++() noexcept
+        {
+            pos_ += cur_->size_;
+            if (top_ == 0)
+                cur_ = nullptr;
+            else
+                descend(stack_[--top_]);
+            return *this;
+        }
+        RopeChunkIterator operator++(int) noexcept
+        {
+            RopeChunkIterator t = *this;
+            ++*this;
+            return t;
+        }
+
+        // 当前块首字符在整个 rope 中的下标
+        size_t position() const noexcept { return pos_; }
+
+        // 块都非空，下标唯一确定位置
+        bool operator==(const RopeChunkIterator &o) const noexcept { return pos_ == o.pos_; }
+        bool operator!=(const RopeChunkIterator &o) const noexcept { return pos_ != o.pos_; }
+
+    private:
+        void descend(const RopeNode *n) noexcept
+        {
+            while (n->kind_ == RopeNode::CONCAT)
+            {
+                auto c = static_cast<const RopeConcat *>(n);
+                assert(top_ < ROPE_MAX_DEPTH);
+                stack_[top_++] = c->right_;
+                n = c->left_;
+            }
+            cur_ = n;
+        }
+
+        const RopeNode *cur_;                    // 当前块，末尾为空
+        size_t pos_;                             // 当前块的起始下标
+        int top_;                                // 栈中元素个数
+        const RopeNode *stack_[ROPE_MAX_DEPTH]; // 待访问的右子树
+    };
+
+    // 字符迭代器（只读、前向）：块内按指针前进，跨块时推进分块迭代器
+    template <typename CharT, typename Traits>
+    class RopeIterator
+    {
+    public:
+        using iterator_category = forward_iterator_tag;
+        using value_type = CharT;
+        using difference_type = ptrdiff_t;
+        using pointer = const CharT *;
+        using reference = const CharT &;
+        using chunk_iterator = RopeChunkIterator<CharT, Traits>;
+
+        RopeIterator() noexcept : p_(nullptr), end_(nullptr), pos_(0), size_(0) {}
+        RopeIterator(const chunk_iterator &c, const chunk_iterator &last) noexcept
+            : chunk_(c), p_(nullptr), end_(nullptr), pos_(c.position()), size_(last.position())
+        {
+            if (pos_ < size_)
+                load();
+        }
+
+        reference operator*() const noexcept { return *p_; }
+        pointer operator->() const noexcept { return p_; }
+
+        RopeIterator &operator++() noexcept
+        {
+            ++pos_;
+            if (++p_ == end_)
+            {
+                ++chunk_;
+                p_ = end_ = nullptr;
+                if (pos_ < size_)
+                    load();
+            }
+            return *this;
+        }
+        RopeIterator operator++(int) noexcept
+        {
+            RopeIterator t = *this;
+            ++*this;
+            return t;
+        }
+
+        bool operator==(const RopeIterator &o) const noexcept { return pos_ == o.pos_; }
+        bool operator!=(const RopeIterator &o) const noexcept { return pos_ != o.pos_; }
+
+    private:
+        void load() noexcept
+        {
+            auto v = *chunk_;
+            p_ = v.data();
+            end_ = p_ + v.size();
+        }
+
+        chunk_iterator chunk_; // 当前块
+        const CharT *p_;       // 当前字符
+        const CharT *end_;     // 当前块末尾
+        size_t pos_;           // 当前字符下标
+        size_t size_;          // 总字符数
+    };
+
+    /**
+     * 绳索字符串：由引用计数的字符块组成的平衡二叉树
+     * 拼接、插入、删除与取子串只新建 O(log n) 个节点，不搬移已有字符；拷贝只增加根节点计数
+     * 独占的最右叶子留有余量，连续的短追加原地写入，均摊 O(1)
+     * 随机下标访问为 O(log n)；整体输出用分块迭代器或 to_string
+     */
+    template <typename CharT, typename Traits = char_traits<CharT>, typename Alloc = alloc<CharT>>
+    class basic_rope
+    {
+    private:
+        using Node = RopeNode;
+        using Leaf = RopeLeaf<CharT>;
+        using Slice = RopeSlice<CharT>;
+        using Concat = RopeConcat;
+
+        static_assert(alignof(Leaf) == alignof(Concat) && alignof(Slice) == alignof(Concat), "rope nodes must share alignment");
+
+        // 三种节点都以 Block 为单位分配，叶子按字符数变长
+        struct alignas(alignof(Leaf)) Block
+        {
+            unsigned char bytes_[alignof(Leaf)];
+        };
+
+    public:
+        using traits_type = Traits;
+        using value_type = CharT;
+        using allocator_type = Alloc;
+        using traits_allocator = allocator_traits<allocator_type>;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using view_type = basic_string_view<CharT, Traits>;
+        using chunk_iterator = RopeChunkIterator<CharT, Traits>;
+        using const_iterator = RopeIterator<CharT, Traits>;
+        using iterator = const_iterator;
+
+        inline static const size_type npos = static_cast<size_type>(-1);
+
+    private:
+        using block_allocator_type = typename traits_allocator::template rebind_alloc<Block>;
+        using block_traits_alloc = allocator_traits<block_allocator_type>;
+
+    public:
+        allocator_type get_allocator() const noexcept { return allocator_type(alloc_); }
+
+        explicit basic_rope(const allocator_type &a = allocator_type()) : alloc_(a), root_(nullptr) {}
+
+        basic_rope(const CharT *s, const allocator_type &a = allocator_type())
+            : basic_rope(s, Traits::length(s), a)
+        {
+        }
+
+        basic_rope(const CharT *s, size_type n, const allocator_type &a = allocator_type())
+            : alloc_(a), root_(n ? make_leaf(s, n, n) : nullptr)
+        {
+        }
+
+        explicit basic_rope(view_type v, const allocator_type &a = allocator_type())
+            : basic_rope(v.data(), v.size(), a)
+        {
+        }
+
+        // 拷贝只共享根节点
+        basic_rope(const basic_rope &o) : alloc_(o.alloc_), root_(ref(o.root_)) {}
+
+        basic_rope(basic_rope &&o) noexcept : alloc_(o.alloc_), root_(o.root_) { o.root_ = nullptr; }
+
+        ~basic_rope() { unref(root_); }
+
+        basic_rope &operator=(const basic_rope &o)
+        {
+            Node *old = root_;
+            root_ = ref(o.root_);
+            unref(old);
+            return *this;
+        }
+
+        basic_rope &operator=(basic_rope &&o) noexcept
+        {
+            if (this != &o)
+            {
+                unref(root_);
+                root_ = o.root_;
+                o.root_ = nullptr;
+            }
+            return *this;
+        }
+
+        // 大小
+        [[nodiscard]] size_type size() const noexcept { return root_ ? root_->size_ : 0; }
+        [[nodiscard]] size_type length() const noexcept { return size(); }
+        [[nodiscard]] bool empty() const noexcept { return root_ == nullptr; }
+        // 树的深度，叶子为 0
+        int depth() const noexcept { return root_ ? root_->depth_ : 0; }
+
+        // 下标访问：沿树下降，O(log n)
+        CharT operator[](size_type pos) const noexcept
+        {
+            assert(pos < size());
+            const Node *n = root_;
+            while (n->kind_ == Node::CONCAT)
+            {
+                auto c = static_cast<const Concat *>(n);
+                if (pos < c->left_->size_)
+                    n = c->left_;
+                else
+                {
+                    pos -= c->left_->size_;
+                    n = c->right_;
+                }
+            }
+            return rope_chunk_data<CharT>(n)[pos];
+        }
+
+        // 迭代器
+        chunk_iterator chunk_begin() const noexcept { return chunk_iterator(root_, 0); }
+        chunk_iterator chunk_end() const noexcept { return chunk_iterator(nullptr, size()); }
+        const_iterator begin() const noexcept { return const_iterator(chunk_begin(), chunk_end()); }
+        const_iterator end() const noexcept { return const_iterator(chunk_end(), chunk_end()); }
+
+        // 追加
+        basic_rope &append(const basic_rope &r)
+        {
+            root_ = concat(root_, ref(r.root_));
+            return *this;
+        }
+
+        // 最右叶子独占且有余量时原地写入；否则新建叶子，短片段预留 ROPE_LEAF_MAX 的容量
+        basic_rope &append(const CharT *s, size_type n)
+        {
+            if (n == 0 || append_in_place(s, n))
+                return *this;
+            root_ = concat(root_, make_leaf(s, n, n < ROPE_LEAF_MAX ? ROPE_LEAF_MAX : n));
+            return *this;
+        }
+        basic_rope &append(const CharT *s) { return append(s, Traits::length(s)); }
+        basic_rope &append(view_type v) { return append(v.data(), v.size()); }
+
+        void push_back(CharT ch) { append(&ch, 1); }
+
+        basic_rope &operator+=(const basic_rope &r) { return append(r); }
+        basic_rope &operator+=(view_type v) { return append(v.data(), v.size()); }
+        basic_rope &operator+=(const CharT *s) { return append(s); }
+        basic_rope &operator+=(CharT ch)
+        {
+            push_back(ch);
+            return *this;
+        }
+
+        // 插入：切成两段后与 r 拼接，共享两侧原有的块
+        basic_rope &insert(size_type pos, const basic_rope &r)
+        {
+            assert(pos <= size());
+            if (pos == size())
+                return append(r);
+            Node *mid = ref(r.root_); // 先取得引用，r 可以是自身
+            Node *head = substr_node(root_, 0, pos);
+            Node *tail = substr_node(root_, pos, size());
+            unref(root_);
+            root_ = concat(concat(head, mid), tail);
+            return *this;
+        }
+        basic_rope &insert(size_type pos, const CharT *s, size_type n)
+        {
+            assert(pos <= size());
+            if (pos == size())
+                return append(s, n);
+            return insert(pos, basic_rope(s, n, get_allocator()));
+        }
+        basic_rope &insert(size_type pos, const CharT *s) { return insert(pos, s, Traits::length(s)); }
+        basic_rope &insert(size_type pos, view_type v) { return insert(pos, v.data(), v.size()); }
+
+        // 删除 [pos, pos + n)
+        basic_rope &erase(size_type pos, size_type n = npos)
+        {
+            size_type sz = size();
+            assert(pos <= sz);
+            size_type last = n < sz - pos ? pos + n : sz;
+            if (pos == last)
+                return *this;
+            Node *head = substr_node(root_, 0, pos);
+            Node *tail = substr_node(root_, last, sz);
+            unref(root_);
+            root_ = concat(head, tail);
+            return *this;
+        }
+
+        // 子串：共享原有的块，较长的叶子片段以切片引用
+        basic_rope substr(size_type pos, size_type n = npos) const
+        {
+            size_type sz = size();
+            assert(pos <= sz);
+            size_type last = n < sz - pos ? pos + n : sz;
+            basic_rope r(nullptr, alloc_);
+            r.root_ = r.substr_node(root_, pos, last); // 新节点由结果的分配器分配
+            return r;
+        }
+
+        void clear() noexcept
+        {
+            unref(root_);
+            root_ = nullptr;
+        }
+
+        void swap(basic_rope &o) noexcept
+        {
+            zstl::swap(root_, o.root_);
+            zstl::swap(alloc_, o.alloc_);
+        }
+
+        // 把 [pos, pos + n) 复制到 out，返回复制的字符数
+        size_type copy(CharT *out, size_type n, size_type pos = 0) const
+        {
+            size_type sz = size();
+            assert(pos <= sz);
+            size_type last = n < sz - pos ? pos + n : sz;
+            if (pos < last)
+                copy_node(root_, pos, last, out);
+            return last - pos;
+        }
+
+        // 转为连续存储的字符串
+        basic_string<CharT, Traits> to_string() const
+        {
+            basic_string<CharT, Traits> s;
+            s.resize_uninitialized(size());
+            copy(s.data(), size());
+            return s;
+        }
+
+        // 按字典序逐块比较
+        int compare(const basic_rope &o) const noexcept
+        {
+            if (root_ == o.root_)
+                return 0;
+            chunk_iterator a = chunk_begin(), b = o.chunk_begin(), ae = chunk_end(), be = o.chunk_end();
+            view_type va, vb;
+            for (;;)
+            {
+                if (va.empty() && a != ae)
+                    va = *a++;
+                if (vb.empty() && b != be)
+                    vb = *b++;
+                if (va.empty() || vb.empty())
+                    return va.empty() ? (vb.empty() ? 0 : -1) : 1;
+                size_type m = va.size() < vb.size() ? va.size() : vb.size();
+                int c = Traits::compare(va.data(), vb.data(), m);
+                if (c != 0)
+                    return c;
+                va.remove_prefix(m);
+                vb.remove_prefix(m);
+            }
+        }
+
+        friend bool operator==(const basic_rope &a, const basic_rope &b) noexcept
+        {
+            return a.size() == b.size() && a.compare(b) == 0;
+        }
+        friend bool operator!=(const basic_rope &a, const basic_rope &b) noexcept { return !(a == b); }
+        friend bool operator<(const basic_rope &a, const basic_rope &b) noexcept { return a.compare(b) < 0; }
+
+        friend basic_rope operator+(const basic_rope &a, const basic_rope &b)
+        {
+            basic_rope r(a);
+            r.append(b);
+            return r;
+        }
+
+        friend std::ostream &operator<<(std::ostream &os, const basic_rope &r)
+        {
+            for (auto it = r.chunk_begin(); it != r.chunk_end(); ++it)
+                os << *it;
+            return os;
+        }
+
+    private:
+        basic_rope(Node *root, const block_allocator_type &a) noexcept : alloc_(a), root_(root) {}
+
+        /* 节点内存管理 */
+
+        static size_type node_blocks(size_type bytes) { return (bytes + sizeof(Block) - 1) / sizeof(Block); }
+
+        static size_type node_bytes(const Node *n) noexcept
+        {
+            switch (n->kind_)
+            {
+            case Node::LEAF:
+                return sizeof(Leaf) + static_cast<const Leaf *>(n)->capacity_ * sizeof(CharT);
+            case Node::CONCAT:
+                return sizeof(Concat);
+            default:
+                return sizeof(Slice);
+            }
+        }
+
+        void *allocate_node(size_type bytes)
+        {
+            return block_traits_alloc::allocate(alloc_, node_blocks(bytes));
+        }
+
+        void free_node(Node *n) noexcept
+        {
+            block_traits_alloc::deallocate(alloc_, reinterpret_cast<Block *>(n), node_blocks(node_bytes(n)));
+        }
+
+        static Node *ref(Node *n) noexcept
+        {
+            if (n)
+                ++n->refs_;
+            return n;
+        }
+
+        // 释放一个引用；计数归零时释放节点并继续释放子节点（右子树迭代处理）
+        void unref(Node *n) noexcept
+        {
+            while (n && --n->refs_ == 0)
+            {
+                Node *next = nullptr;
+                if (n->kind_ == Node::CONCAT)
+                {
+                    auto c = static_cast<Concat *>(n);
+                    unref(c->left_);
+                    next = c->right_;
+                }
+                else if (n->kind_ == Node::SLICE)
+                    next = static_cast<Slice *>(n)->base_;
+                free_node(n);
+                n = next;
+            }
+        }
+
+        Leaf *make_leaf(const CharT *s, size_type n, size_type cap)
+        {
+            Leaf *l = ::new (allocate_node(sizeof(Leaf) + cap * sizeof(CharT))) Leaf(n, cap);
+            Traits::copy(l->data(), s, n);
+            return l;
+        }
+
+        // 以下构造函数接管传入节点的引用
+        Node *make_concat(Node *l, Node *r) { return ::new (allocate_node(sizeof(Concat))) Concat(l, r); }
+
+        Node *make_slice(Leaf *base, size_type off, size_type n)
+        {
+            return ::new (allocate_node(sizeof(Slice))) Slice(base, off, n);
+        }
+
+        static bool is_flat(const Node *n) noexcept { return n->kind_ != Node::CONCAT; }
+
+        static bool is_balanced(const Node *n) noexcept { return n->size_ >= ROPE_MIN_LENGTH.len_[n->depth_]; }
+
+        // 两个短块合并为一个叶子：l 为独占且有余量的叶子时原地追加
+        Node *merge_flat(Node *l, Node *r)
+        {
+            size_type ln = l->size_, rn = r->size_;
+            if (l->kind_ == Node::LEAF && l->refs_ == 1 && static_cast<Leaf *>(l)->capacity_ >= ln + rn)
+            {
+                Traits::copy(static_cast<Leaf *>(l)->data() + ln, rope_chunk_data<CharT>(r), rn);
+                l->size_ = ln + rn;
+                unref(r);
+                return l;
+            }
+            Leaf *m = make_leaf(rope_chunk_data<CharT>(l), ln, ROPE_LEAF_MAX);
+            Traits::copy(m->data() + ln, rope_chunk_data<CharT>(r), rn);
+            m->size_ = ln + rn;
+            unref(l);
+            unref(r);
+            return m;
+        }
+
+        /**
+         * 拼接（接管 l、r 的引用）
+         * 右侧为短块时与左侧的短块（或左子树最右的短块）合并，避免产生大量小叶子；
+         * 深度超过 ROPE_MAX_DEPTH 时整体重新平衡
+         */
+        Node *concat(Node *l, Node *r)
+        {
+            if (!l)
+                return r;
+            if (!r)
+                return l;
+            if (is_flat(r) && r->size_ < ROPE_LEAF_MAX)
+            {
+                if (is_flat(l) && l->size_ + r->size_ <= ROPE_LEAF_MAX)
+                    return merge_flat(l, r);
+                if (l->kind_ == Node::CONCAT)
+                {
+                    auto c = static_cast<Concat *>(l);
+                    if (is_flat(c->right_) && c->right_->size_ + r->size_ <= ROPE_LEAF_MAX)
+                    {
+                        Node *left = ref(c->left_);
+                        Node *right = ref(c->right_);
+                        unref(l);
+                        return make_concat(left, merge_flat(right, r));
+                    }
+                }
+            }
+            Node *n = make_concat(l, r);
+            return n->depth_ > ROPE_MAX_DEPTH ? rebalance(n) : n;
+        }
+
+        // 不合并、不平衡的拼接，供重新平衡使用
+        Node *concat_raw(Node *l, Node *r)
+        {
+            if (!l)
+                return r;
+            if (!r)
+                return l;
+            return make_concat(l, r);
+        }
+
+        /**
+         * 重新平衡（接管 n 的引用）：按 Boehm 等人的做法，把已平衡的子树依次放入以斐波那契数分档的森林，
+         * 同档相遇时拼接后上移，最后从低档到高档拼接成一棵平衡树
+         */
+        Node *rebalance(Node *n)
+        {
+            Node *forest[ROPE_MAX_DEPTH + 1] = {};
+            add_to_forest(n, forest);
+            unref(n);
+            Node *result = nullptr;
+            for (int i = 0; i <= ROPE_MAX_DEPTH; ++i)
+                if (forest[i])
+                    result = concat_raw(forest[i], result);
+            assert(result->depth_ <= ROPE_MAX_DEPTH);
+            return result;
+        }
+
+        void add_to_forest(Node *n, Node **forest)
+        {
+            if (n->kind_ == Node::CONCAT && !is_balanced(n))
+            {
+                auto c = static_cast<Concat *>(n);
+                add_to_forest(c->left_, forest);
+                add_to_forest(c->right_, forest);
+            }
+            else
+                add_leaf_to_forest(ref(n), forest);
+        }
+
+        void add_leaf_to_forest(Node *n, Node **forest)
+        {
+            Node *too_tiny = nullptr;
+            int i = 0;
+            for (; i < ROPE_MAX_DEPTH && n->size_ >= ROPE_MIN_LENGTH.len_[i + 1]; ++i)
+            {
+                if (forest[i])
+                {
+                    too_tiny = concat_raw(forest[i], too_tiny);
+                    forest[i] = nullptr;
+                }
+            }
+            Node *ins = concat_raw(too_tiny, n);
+            for (;; ++i)
+            {
+                if (forest[i])
+                {
+                    ins = concat_raw(forest[i], ins);
+                    forest[i] = nullptr;
+                }
+                if (i == ROPE_MAX_DEPTH || ins->size_ < ROPE_MIN_LENGTH.len_[i + 1])
+                {
+                    forest[i] = ins;
+                    break;
+                }
+            }
+        }
+
+        // 取 [b, e) 对应的子树（返回新引用），沿两条边界路径新建 O(depth) 个节点
+        Node *substr_node(Node *n, size_type b, size_type e)
+        {
+            if (b >= e)
+                return nullptr;
+            if (b == 0 && e == n->size_)
+                return ref(n);
+            if (n->kind_ == Node::CONCAT)
+            {
+                auto c = static_cast<Concat *>(n);
+                size_type ln = c->left_->size_;
+                if (e <= ln)
+                    return substr_node(c->left_, b, e);
+                if (b >= ln)
+                    return substr_node(c->right_, b - ln, e - ln);
+                Node *l = substr_node(c->left_, b, ln);
+                return concat(l, substr_node(c->right_, 0, e - ln));
+            }
+            size_type len = e - b;
+            if (len < ROPE_SLICE_MIN)
+                return make_leaf(rope_chunk_data<CharT>(n) + b, len, len);
+            if (n->kind_ == Node::LEAF)
+                return make_slice(static_cast<Leaf *>(ref(n)), b, len);
+            auto s = static_cast<Slice *>(n);
+            return make_slice(static_cast<Leaf *>(ref(s->base_)), s->offset_ + b, len);
+        }
+
+        // 最右路径上的节点全部独占、最右叶子有余量时原地追加，并更新路径上的长度
+        bool append_in_place(const CharT *s, size_type n)
+        {
+            Node *p = root_;
+            if (!p)
+                return false;
+            for (;;)
+            {
+                if (p->refs_ != 1)
+                    return false;
+                if (p->kind_ != Node::CONCAT)
+                    break;
+                p = static_cast<Concat *>(p)->right_;
+            }
+            if (p->kind_ != Node::LEAF || static_cast<Leaf *>(p)->capacity_ - p->size_ < n)
+                return false;
+            Traits::copy(static_cast<Leaf *>(p)->data() + p->size_, s, n);
+            for (Node *q = root_;; q = static_cast<Concat *>(q)->right_)
+            {
+                q->size_ += n;
+                if (q == p)
+                    break;
+            }
+            return true;
+        }
+
+        static void copy_node(const Node *n, size_type b, size_type e, CharT *out)
+        {
+            while (n->kind_ == Node::CONCAT)
+            {
+                auto c = static_cast<const Concat *>(n);
+                size_type ln = c->left_->size_;
+                if (e <= ln)
+                    n = c->left_;
+                else if (b >= ln)
+                {
+                    b -= ln;
+                    e -= ln;
+                    n = c->right_;
+                }
+                else
+                {
+                    copy_node(c->left_, b, ln, out);
+                    out += ln - b;
+                    b = 0;
+                    e -= ln;
+                    n = c->right_;
+                }
+            }
+            Traits::copy(out, rope_chunk_data<CharT>(n) + b, e - b);
+        }
+
+        block_allocator_type alloc_; // 节点内存
+        Node *root_;                 // 根节点，空串为 nullptr
+    };
+
+    using rope = basic_rope<char>;
+    using wrope = basic_rope<wchar_t>;
+} // namespace zstl
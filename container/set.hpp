@@ -9,4 +9,18 @@ namespace zstl
 
     template <typename K, typename Compare = zstl::less<K>, typename Alloc = alloc<K>>
     using multiset = assoc_tree<K, tree_null_type, Compare, Alloc, false>;
+
+    // 维护子树大小的 set，额外支持 nth_element_at / rank / count_range
+    template <typename K, typename Compare = zstl::less<K>, typename Alloc = alloc<K>>
+    using ranked_set = assoc_tree<K, tree_null_type, Compare, Alloc, true, RBSizeAugment>;
+
+    template <typename K, typename Compare = zstl::less<K>, typename Alloc = alloc<K>>
+    using ranked_multiset = assoc_tree<K, tree_null_type, Compare, Alloc, false, RBSizeAugment>;
+
+    // 紧凑节点布局的 set：颜色压入父指针，每节点更省内存
+    template <typename K, typename Compare = zstl::less<K>, typename Alloc = alloc<K>>
+    using compact_set = assoc_tree<K, tree_null_type, Compare, Alloc, true, RBNullAugment, true>;
+
+    template <typename K, typename Compare = zstl::less<K>, typename Alloc = alloc<K>>
+    using compact_multiset = assoc_tree<K, tree_null_type, Compare, Alloc, false, RBNullAugment, true>;
 }
\ No newline at end of file
@@ -0,0 +1,8 @@
+#pragma once
+#include "vector.hpp"
+namespace zstl
+{
+    // 前 N 个元素存放在对象内部的 vector，超出 N 后才向分配器申请内存；接口与迭代器类型同 vector
+    template <typename T, size_t N, typename Alloc = alloc<T>, typename Growth = growth_2x>
+    using small_vector = vector<T, Alloc, N, Growth>;
+}
@@ -8,6 +8,10 @@ namespace zstl
     public:
         stack() = default;
         ~stack() = default;
+
+        // 以已有容器构造，例如预设容量或覆盖模式的 ring_buffer
+        explicit stack(const Container &c) : con_(c) {}
+        explicit stack(Container &&c) : con_(std::move(c)) {}
         // 移动构造函数
         stack(stack &&other) noexcept
             : con_(std::move(other.con_))
@@ -2,98 +2,27 @@
 #include <iostream>
 #include <cassert>
 #include <cstring>
+#include <locale>
+#include <string_view>
+#include <type_traits>
 #include "../iterator/reverse_iterator.hpp"
 #include "../allocator/alloc.hpp"
 #include "../allocator/memory.hpp"
+#include "../allocator/growth_policy.hpp"
 #include "../algorithm/algo.hpp"
+#include "../algorithm/string_search.hpp"
+#include "../algorithm/charconv.hpp"
+#include "string_view.hpp"
 namespace zstl
 {
-    // 通用字符特性模板，提供字符类型的基本操作
-    template <class CharType>
-    struct char_traits
-    {
-        using char_type = CharType; // 字符类型别名
-
-        // 计算以终止符结尾的字符串长度
-        static size_t length(const char_type *str) noexcept
-        {
-            size_t len = 0;
-            for (; *str != char_type(0); ++str)
-                ++len;
-            return len;
-        }
-
-        // 按字典序比较两个字符串的前n个字符
-        static int compare(const char_type *s1, const char_type *s2, size_t n) noexcept
-        {
-            for (; n; --n, ++s1, ++s2)
-            {
-                if (*s1 < *s2)
-                    return -1;
-                if (*s2 < *s1)
-                    return 1;
-            }
-            return 0;
-        }
-
-        // 安全拷贝n个字符（要求源和目标内存不重叠）
-        static char_type *copy(char_type *dst, const char_type *src, size_t n) noexcept
-        {
-            assert(src + n <= dst || dst + n <= src);
-            char_type *r = dst;
-            for (; n; --n, ++dst, ++src)
-                *dst = *src;
-            return r;
-        }
-
-        // 安全移动n个字符（支持内存重叠情况）
-        static char_type *move(char_type *dst, const char_type *src, size_t n) noexcept
-        {
-            char_type *r = dst;
-            if (dst < src)
-            {
-                for (; n; --n, ++dst, ++src)
-                    *dst = *src;
-            }
-            else if (src < dst)
-            {
-                dst += n;
-                src += n;
-                for (; n; --n)
-                    *--dst = *--src;
-            }
-            return r;
-        }
-
-        // 用指定字符填充内存区域
-        static char_type *fill(char_type *dst, char_type ch, size_t count) noexcept
-        {
-            char_type *r = dst;
-            for (; count; --count, ++dst)
-                *dst = ch;
-            return r;
-        }
-    };
-
-    // char类型特化版本，使用标准库函数优化性能
-    template <>
-    struct char_traits<char>
-    {
-        using char_type = char;
-        static size_t length(const char_type *str) noexcept { return strlen(str); }
-        static int compare(const char_type *s1, const char_type *s2, size_t n) noexcept { return memcmp(s1, s2, n); }
-        static char_type *copy(char_type *dst, const char_type *src, size_t n) noexcept
-        {
-            assert(src + n <= dst || dst + n <= src);
-            return reinterpret_cast<char_type *>(memcpy(dst, src, n));
-        }
-        static char_type *move(char_type *dst, const char_type *src, size_t n) noexcept { return reinterpret_cast<char_type *>(memmove(dst, src, n)); }
-        static char_type *fill(char_type *dst, char_type ch, size_t count) noexcept { return reinterpret_cast<char_type *>(memset(dst, ch, count)); }
-    };
-
     // 动态字符串模板类，使用 zstl::allocator 和 allocator_traits 管理内存
-    template <typename CharT, typename Traits = char_traits<CharT>, typename Alloc = alloc<CharT>>
-    class basic_string
+    // Growth 为扩容策略，见 growth_policy.hpp
+    // 短字符串优化：不超过 SSO_CAPACITY 个字符时存放在对象内部，不向分配器申请内存；
+    // str_ 始终指向当前数据（内部缓冲区或堆），访问路径不做分支
+    // 空分配器作为私有基类，不占对象空间，string 为 32 字节
+    template <typename CharT, typename Traits = char_traits<CharT>, typename Alloc = alloc<CharT>,
+              typename Growth = growth_2x>
+    class basic_string : private Alloc
     {
     public:
         // 类型定义
@@ -109,6 +38,9 @@ namespace zstl
 
         inline static const size_type npos = static_cast<size_type>(-1);
 
+        // 内部缓冲区可容纳的字符数（不含终止符），缓冲区与堆容量字段共用 16 字节
+        static constexpr size_type SSO_CAPACITY = 16 / sizeof(value_type) - 1;
+
     public:
         // 迭代器相关
         using iterator = value_type *;
@@ -128,32 +60,41 @@ namespace zstl
 
     public:
         // 返回当前使用的分配器实例
-        allocator_type get_allocator() const noexcept { return alloc_; }
+        allocator_type get_allocator() const noexcept { return alloc_ref(); }
 
-        // 默认构造函数：使用指定或默认分配器，初始化空字符串
+        // 默认构造函数：空字符串使用内部缓冲区，不分配内存
         explicit basic_string(const allocator_type &alloc = allocator_type())
-            : alloc_(alloc), str_(traits_allocator::allocate(alloc_, 1)), size_(0), capacity_(0)
+            : Alloc(alloc), str_(local_), size_(0)
         {
-            // 设置终止符
-            Traits::fill(str_, value_type(0), 1);
+            local_[0] = value_type(0);
         }
 
         // C 风格字符串构造函数：深拷贝输入字符串
         basic_string(const value_type *s, const allocator_type &alloc = allocator_type())
-            : alloc_(alloc)
+            : Alloc(alloc), str_(local_), size_(0)
+        {
+            init(s, Traits::length(s));
+        }
+
+        // 从 [s, s + n) 构造，不要求终止符
+        basic_string(const value_type *s, size_type n, const allocator_type &alloc = allocator_type())
+            : Alloc(alloc), str_(local_), size_(0)
         {
-            size_ = Traits::length(s);                                // 计算长度
-            capacity_ = size_;                                        // 初始容量等于长度
-            str_ = traits_allocator::allocate(alloc_, capacity_ + 1); // 分配内存
-            Traits::copy(str_, s, size_ + 1);                         // 拷贝内容和终止符
+            init(s, n);
+        }
+
+        // 从视图构造：显式调用，避免视图被隐式复制成字符串
+        explicit basic_string(basic_string_view<value_type, Traits> v, const allocator_type &alloc = allocator_type())
+            : Alloc(alloc), str_(local_), size_(0)
+        {
+            init(v.data(), v.size());
         }
 
         // 拷贝构造（带分配器参数）：使用指定分配器复制字符串内容
         basic_string(const basic_string &o, const allocator_type &alloc)
-            : alloc_(alloc), size_(o.size_), capacity_(o.capacity_)
+            : Alloc(alloc), str_(local_), size_(0)
         {
-            str_ = traits_allocator::allocate(alloc_, capacity_ + 1); // 分配内存
-            Traits::copy(str_, o.str_, size_ + 1);                    // 拷贝数据
+            init(o.str_, o.size_);
         }
 
         // 拷贝构造：委托给带分配器版本，使用源对象的分配器
@@ -162,27 +103,11 @@ namespace zstl
         {
         }
 
-        // 移动构造（带分配器参数）：同分配器则窃取资源，否则重新分配并复制
+        // 移动构造（带分配器参数）：同分配器则窃取堆内存，短串或分配器不同时复制
         basic_string(basic_string &&o, const allocator_type &alloc) noexcept
-            : alloc_(alloc), str_(nullptr), size_(0), capacity_(0)
+            : Alloc(alloc), str_(local_), size_(0)
         {
-            if (alloc_ == o.get_allocator())
-            {
-                // 分配器相同，直接窃取指针
-                str_ = o.str_;
-                size_ = o.size_;
-                capacity_ = o.capacity_;
-                o.str_ = nullptr;
-                o.size_ = o.capacity_ = 0;
-            }
-            else
-            {
-                // 分配器不同，按新分配器重新复制数据
-                size_ = o.size_;
-                capacity_ = size_;
-                str_ = traits_allocator::allocate(alloc_, capacity_ + 1);
-                Traits::copy(str_, o.str_, size_ + 1);
-            }
+            steal_or_copy(o);
         }
 
         // 移动构造：委托给带分配器版本
@@ -191,13 +116,10 @@ namespace zstl
         {
         }
 
-        // 析构：释放分配内存
+        // 析构：释放堆内存
         ~basic_string() noexcept
         {
-            if (str_)
-            {
-                traits_allocator::deallocate(alloc_, str_, capacity_ + 1);
-            }
+            release();
         }
 
         // 拷贝赋值：按拷贝-交换范式实现
@@ -211,48 +133,36 @@ namespace zstl
             return *this;
         }
 
-        // 移动赋值：按分配器一致性处理资源
+        // 移动赋值：释放现有内存后按分配器一致性接管
         basic_string &operator=(basic_string &&o) noexcept
         {
             if (this != &o)
             {
-                traits_allocator::deallocate(alloc_, str_, capacity_ + 1); // 释放现有内存
-                if (alloc_ == o.get_allocator())
-                {
-                    // 分配器相同，直接窃取资源
-                    str_ = o.str_;
-                    size_ = o.size_;
-                    capacity_ = o.capacity_;
-                    o.str_ = nullptr;
-                    o.size_ = o.capacity_ = 0;
-                }
-                else
-                {
-                    // 分配器不同，重新分配并拷贝数据
-                    size_ = o.size_;
-                    capacity_ = size_;
-                    str_ = traits_allocator::allocate(alloc_, capacity_ + 1);
-                    Traits::copy(str_, o.str_, size_ + 1);
-                }
+                release();
+                str_ = local_;
+                size_ = 0;
+                steal_or_copy(o);
             }
             return *this;
         }
 
         // 大小与容量
         [[nodiscard]] size_type size() const noexcept { return size_; }
-        [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+        [[nodiscard]] size_type capacity() const noexcept { return is_local() ? SSO_CAPACITY : capacity_; }
         [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
 
         // 预分配内存
         void reserve(size_type n)
         {
-            if (n > capacity_)
+            if (n > capacity())
             {
-                pointer tmp = traits_allocator::allocate(alloc_, n + 1);
+                // 容量取分配器实际给出的大小（扣除终止符）
+                auto r = traits_allocator::allocate_at_least(alloc_ref(), n + 1);
+                pointer tmp = r.ptr;
                 Traits::copy(tmp, str_, size_ + 1);
-                traits_allocator::deallocate(alloc_, str_, capacity_ + 1);
+                release();
                 str_ = tmp;
-                capacity_ = n;
+                capacity_ = r.count - 1; // 与内部缓冲区共用存储，须在拷出数据之后写入
             }
         }
 
@@ -268,12 +178,33 @@ namespace zstl
             str_[size_] = value_type(0);
         }
 
+        // 改变长度但不填充新增字符，用于随后整体覆写的缓冲区
+        void resize_uninitialized(size_type n)
+        {
+            grow_to(n);
+            size_ = n;
+            str_[size_] = value_type(0);
+        }
+
+        /**
+         * 扩展到 n 个字符（新增部分不填充）后调用 op(data(), n) 覆写内容
+         * op 返回最终长度 r（r <= n）
+         */
+        template <typename Op>
+        void resize_and_overwrite(size_type n, Op op)
+        {
+            grow_to(n);
+            size_type r = static_cast<size_type>(op(str_, n));
+            assert(r <= n);
+            size_ = r;
+            str_[size_] = value_type(0);
+        }
+
         // 清空内容
         void clear() noexcept
         {
             size_ = 0;
-            if (str_)
-                Traits::fill(str_, value_type(0), 1);
+            str_[0] = value_type(0);
         }
 
         // 下标访问
@@ -293,12 +224,20 @@ namespace zstl
         reference &back() { return str_[size_ - 1]; }
         const_reference back() const { return str_[size_ - 1]; }
         const_pointer c_str() const noexcept { return str_; }
+        pointer data() noexcept { return str_; }
+        const_pointer data() const noexcept { return str_; }
+
+        // 转为只读视图，不拷贝
+        operator basic_string_view<value_type, Traits>() const noexcept
+        {
+            return basic_string_view<value_type, Traits>(str_, size_);
+        }
 
         // 追加操作
         void push_back(value_type ch)
         {
-            if (size_ + 1 > capacity_)
-                reserve(capacity_ ? capacity_ * 2 : 4);
+            if (size_ + 1 > capacity())
+                grow_to(size_ + 1);
             str_[size_++] = ch;
             str_[size_] = value_type(0);
         }
@@ -313,35 +252,65 @@ namespace zstl
             append(s);
             return *this;
         }
+        basic_string &operator+=(const basic_string &s)
+        {
+            append(s.str_, s.size_);
+            return *this;
+        }
+        basic_string &operator+=(basic_string_view<value_type, Traits> v)
+        {
+            append(v.data(), v.size());
+            return *this;
+        }
+
+        void append(const value_type *s) { append(s, Traits::length(s)); }
+        void append(const basic_string &s) { append(s.str_, s.size_); }
+        void append(basic_string_view<value_type, Traits> v) { append(v.data(), v.size()); }
 
-        void append(const value_type *s)
+        // 追加 [s, s + n)；s 可以指向自身内容，扩容后按偏移重新定位
+        void append(const value_type *s, size_type n)
         {
-            size_type l = Traits::length(s);
-            if (size_ + l > capacity_)
-                reserve(size_ + l);
-            Traits::copy(str_ + size_, s, l + 1);
-            size_ += l;
+            if (size_ + n > capacity())
+            {
+                size_type off = static_cast<size_type>(s - str_);
+                bool inside = s >= str_ && s <= str_ + size_;
+                grow_to(size_ + n);
+                if (inside)
+                    s = str_ + off;
+            }
+            Traits::copy(str_ + size_, s, n);
+            size_ += n;
+            str_[size_] = value_type(0);
         }
 
         void insert(size_type pos, value_type ch)
         {
             assert(pos <= size_);
-            if (size_ + 1 > capacity_)
-                reserve(capacity_ ? capacity_ * 2 : 4);
+            if (size_ + 1 > capacity())
+                grow_to(size_ + 1);
             Traits::move(str_ + pos + 1, str_ + pos, size_ - pos + 1);
             str_[pos] = ch;
             ++size_;
         }
 
-        void insert(size_type pos, const value_type *s)
+        void insert(size_type pos, const value_type *s) { insert(pos, s, Traits::length(s)); }
+        void insert(size_type pos, basic_string_view<value_type, Traits> v) { insert(pos, v.data(), v.size()); }
+
+        // 在 pos 处插入 [s, s + n)；s 指向自身内容时先复制出来，避免搬移后读到错位的数据
+        void insert(size_type pos, const value_type *s, size_type n)
         {
             assert(pos <= size_);
-            size_type l = Traits::length(s);
-            if (size_ + l > capacity_)
-                reserve(size_ + l);
-            Traits::move(str_ + pos + l, str_ + pos, size_ - pos + 1);
-            Traits::copy(str_ + pos, s, l);
-            size_ += l;
+            if (s >= str_ && s <= str_ + size_)
+            {
+                basic_string tmp(s, n, get_allocator());
+                insert(pos, tmp.str_, n);
+                return;
+            }
+            if (size_ + n > capacity())
+                grow_to(size_ + n);
+            Traits::move(str_ + pos + n, str_ + pos, size_ - pos + 1);
+            Traits::copy(str_ + pos, s, n);
+            size_ += n;
         }
 
         void erase(size_type pos, size_type len = npos)
@@ -368,33 +337,120 @@ namespace zstl
             }
         }
 
+        // 两侧都在堆上时交换指针；否则短串需按值搬到对方的内部缓冲区
         void swap(basic_string &o) noexcept
         {
-            zstl::swap(str_, o.str_);
+            if (this == &o)
+                return;
+            if (!is_local() && !o.is_local())
+            {
+                zstl::swap(str_, o.str_);
+                zstl::swap(capacity_, o.capacity_);
+            }
+            else if (is_local() && o.is_local())
+            {
+                value_type tmp[SSO_CAPACITY + 1];
+                Traits::copy(tmp, local_, size_ + 1);
+                Traits::copy(local_, o.local_, o.size_ + 1);
+                Traits::copy(o.local_, tmp, size_ + 1);
+            }
+            else
+            {
+                basic_string &l = is_local() ? *this : o; // 短串一侧
+                basic_string &h = is_local() ? o : *this; // 堆一侧
+                pointer heap = h.str_;
+                size_type cap = h.capacity_;
+                Traits::copy(h.local_, l.local_, l.size_ + 1);
+                h.str_ = h.local_;
+                l.str_ = heap;
+                l.capacity_ = cap;
+            }
             zstl::swap(size_, o.size_);
-            zstl::swap(capacity_, o.capacity_);
         }
 
-        // 查找
+        // 查找：见 string_search.hpp，char 使用 memchr / SSE2，长模式串使用 Two-Way
         size_type find(value_type ch, size_type pos = 0) const noexcept
         {
-            for (; pos < size_; ++pos)
-                if (str_[pos] == ch)
-                    return pos;
-            return npos;
+            if (pos >= size_)
+                return npos;
+            return to_pos(find_char(str_ + pos, size_ - pos, ch));
         }
 
-        size_type find(const value_type *s, size_type pos = 0) const noexcept
+        size_type find(const value_type *s, size_type pos = 0) const noexcept { return find(s, pos, Traits::length(s)); }
+        size_type find(basic_string_view<value_type, Traits> v, size_type pos = 0) const noexcept
         {
-            size_type l = Traits::length(s);
-            for (; pos + l <= size_; ++pos)
-            {
-                if (Traits::compare(str_ + pos, s, l) == 0)
-                    return pos;
-            }
-            return npos;
+            return find(v.data(), pos, v.size());
+        }
+
+        // 查找 [s, s + n)，不要求终止符
+        size_type find(const value_type *s, size_type pos, size_type n) const noexcept
+        {
+            if (pos > size_)
+                return npos;
+            return to_pos(search_substr(str_ + pos, size_ - pos, s, n));
+        }
+
+        // 反向查找：起点不超过 pos 的最后一次出现
+        size_type rfind(value_type ch, size_type pos = npos) const noexcept
+        {
+            if (size_ == 0)
+                return npos;
+            size_type n = pos < size_ ? pos + 1 : size_;
+            return to_pos(rfind_char(str_, n, ch));
+        }
+
+        size_type rfind(const value_type *s, size_type pos = npos) const noexcept { return rfind(s, pos, Traits::length(s)); }
+        size_type rfind(basic_string_view<value_type, Traits> v, size_type pos = npos) const noexcept
+        {
+            return rfind(v.data(), pos, v.size());
+        }
+
+        size_type rfind(const value_type *s, size_type pos, size_type l) const noexcept
+        {
+            if (l > size_)
+                return npos;
+            size_type start = pos < size_ - l ? pos : size_ - l; // 最后一个可能的起点
+            return to_pos(rsearch_substr(str_, start + l, s, l));
+        }
+
+        // 首个 / 最后一个属于字符集 s 的位置
+        size_type find_first_of(const value_type *s, size_type pos = 0) const noexcept
+        {
+            return find_first_of(s, pos, Traits::length(s));
+        }
+        size_type find_first_of(basic_string_view<value_type, Traits> v, size_type pos = 0) const noexcept
+        {
+            return find_first_of(v.data(), pos, v.size());
+        }
+
+        size_type find_first_of(const value_type *s, size_type pos, size_type n) const noexcept
+        {
+            if (pos >= size_)
+                return npos;
+            return to_pos(find_any_of(str_ + pos, size_ - pos, s, n));
+        }
+
+        size_type find_first_of(value_type ch, size_type pos = 0) const noexcept { return find(ch, pos); }
+
+        size_type find_last_of(const value_type *s, size_type pos = npos) const noexcept
+        {
+            return find_last_of(s, pos, Traits::length(s));
+        }
+        size_type find_last_of(basic_string_view<value_type, Traits> v, size_type pos = npos) const noexcept
+        {
+            return find_last_of(v.data(), pos, v.size());
         }
 
+        size_type find_last_of(const value_type *s, size_type pos, size_type l) const noexcept
+        {
+            if (size_ == 0)
+                return npos;
+            size_type n = pos < size_ ? pos + 1 : size_;
+            return to_pos(rfind_any_of(str_, n, s, l));
+        }
+
+        size_type find_last_of(value_type ch, size_type pos = npos) const noexcept { return rfind(ch, pos); }
+
         basic_string substr(size_type pos, size_type len = npos) const
         {
             basic_string r;
@@ -409,6 +465,12 @@ namespace zstl
             return r;
         }
 
+        // 与视图按字典序比较，返回负数 / 0 / 正数
+        int compare(basic_string_view<value_type, Traits> v) const noexcept
+        {
+            return basic_string_view<value_type, Traits>(str_, size_).compare(v);
+        }
+
         // 比较运算符
         bool operator<(const basic_string &s) const noexcept
         {
@@ -426,29 +488,139 @@ namespace zstl
         bool operator!=(const basic_string &s) const noexcept { return !(*this == s); }
 
         // I/O 操作
+        // 跳过前导空白后逐字符读入，直到空白或流结束；不经过定长缓冲区，长度不受限
         friend std::istream &operator>>(std::istream &is, basic_string &str)
         {
-            value_type buf[4096];
-            is >> buf;
-            basic_string t(buf);
-            str.swap(t);
+            std::istream::sentry ok(is);
+            if (!ok)
+                return is;
+            str.clear();
+            const auto &ct = std::use_facet<std::ctype<char>>(is.getloc());
+            std::streambuf *sb = is.rdbuf();
+            std::ios_base::iostate state = std::ios_base::goodbit;
+            std::streamsize width = is.width();
+            size_type limit = width > 0 ? static_cast<size_type>(width) : npos;
+            auto c = sb->sgetc();
+            while (str.size_ < limit)
+            {
+                if (std::istream::traits_type::eq_int_type(c, std::istream::traits_type::eof()))
+                {
+                    state |= std::ios_base::eofbit;
+                    break;
+                }
+                char ch = std::istream::traits_type::to_char_type(c);
+                if (ct.is(std::ctype_base::space, ch))
+                    break;
+                str.push_back(static_cast<value_type>(ch));
+                c = sb->snextc();
+            }
+            is.width(0);
+            if (str.empty())
+                state |= std::ios_base::failbit;
+            is.setstate(state);
             return is;
         }
 
         friend std::ostream &operator<<(std::ostream &os, const basic_string &str)
         {
+            // char 整段写出（同时遵循 width / fill），其他字符类型逐个写出
+            if constexpr (std::is_same_v<CharT, char>)
+                return os << std::string_view(str.str_, str.size_);
             for (size_type i = 0; i < str.size_; ++i)
                 os << str.str_[i];
             return os;
         }
 
     private:
-        allocator_type alloc_;   // 分配器实例
-        pointer str_ = nullptr;  // 数据存储指针
-        size_type size_ = 0;     // 当前元素数量
-        size_type capacity_ = 0; // 当前分配容量
+        allocator_type &alloc_ref() noexcept { return *this; }
+        const allocator_type &alloc_ref() const noexcept { return *this; }
+
+        bool is_local() const noexcept { return str_ == local_; }
+
+        // 查找原语返回的指针转为下标
+        size_type to_pos(const value_type *p) const noexcept { return p ? static_cast<size_type>(p - str_) : npos; }
+
+        // 释放堆内存（短串无操作），不修改 str_ / size_
+        void release() noexcept
+        {
+            if (!is_local())
+                traits_allocator::deallocate(alloc_ref(), str_, capacity_ + 1);
+        }
+
+        // 从空的短串状态拷入 [s, s + n)
+        void init(const value_type *s, size_type n)
+        {
+            if (n > SSO_CAPACITY)
+            {
+                auto r = traits_allocator::allocate_at_least(alloc_ref(), n + 1);
+                str_ = r.ptr;
+                capacity_ = r.count - 1;
+            }
+            Traits::copy(str_, s, n);
+            str_[n] = value_type(0);
+            size_ = n;
+        }
+
+        // 从空的短串状态接管 o：同分配器且在堆上时窃取指针，否则复制；o 置为空串
+        void steal_or_copy(basic_string &o) noexcept
+        {
+            if (!o.is_local() && alloc_ref() == o.alloc_ref())
+            {
+                str_ = o.str_;
+                capacity_ = o.capacity_;
+                size_ = o.size_;
+            }
+            else
+            {
+                init(o.str_, o.size_);
+                o.release();
+            }
+            o.str_ = o.local_;
+            o.size_ = 0;
+            o.local_[0] = value_type(0);
+        }
+
+        // 保证容量不小于 n，扩容时按增长策略放大，连续追加为均摊 O(1)
+        void grow_to(size_type n)
+        {
+            size_type cap = capacity();
+            if (n > cap)
+                reserve(Growth::next_capacity(cap, n, sizeof(value_type)));
+        }
+
+        pointer str_;   // 当前数据：指向 local_ 或堆内存
+        size_type size_; // 当前字符数
+        union
+        {
+            size_type capacity_;                  // 堆容量（不含终止符）
+            value_type local_[SSO_CAPACITY + 1]; // 短串的内部缓冲区
+        };
     };
 
     using string = basic_string<char>;
     using wstring = basic_string<wchar_t>;
+
+    // 整数的十进制表示，直接在短串缓冲区 / 栈上格式化，不经过 sprintf
+    template <typename T, typename = std::enable_if_t<is_charconv_integer_v<T>>>
+    string to_string(T value)
+    {
+        char buf[std::numeric_limits<T>::digits10 + 3];
+        to_chars_result r = to_chars(buf, buf + sizeof(buf), value);
+        return string(buf, static_cast<size_t>(r.ptr - buf));
+    }
+
+    // 浮点的最短往返表示（与 std::to_chars 相同），不同于 std::to_string 的 "%f"
+    inline string to_string(double value)
+    {
+        char buf[32];
+        to_chars_result r = to_chars(buf, buf + sizeof(buf), value);
+        return string(buf, static_cast<size_t>(r.ptr - buf));
+    }
+
+    inline string to_string(float value)
+    {
+        char buf[32];
+        to_chars_result r = to_chars(buf, buf + sizeof(buf), value);
+        return string(buf, static_cast<size_t>(r.ptr - buf));
+    }
 } // namespace zstl
\ No newline at end of file
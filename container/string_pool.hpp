@@ -0,0 +1,343 @@
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include "../allocator/alloc.hpp"
+#include "../allocator/memory.hpp"
+#include "../functor/functional.hpp"
+#include "char_traits.hpp"
+#include "string_view.hpp"
+namespace zstl
+{
+    inline constexpr size_t STRING_POOL_BLOCK_BYTES = 64 * 1024; // 竞技场每块大小
+    inline constexpr size_t STRING_POOL_MIN_SLOTS = 64;          // 散列表初始槽数
+
+    // 池中的一条字符串：散列值与长度在前，字符（含终止符）紧随其后
+    struct InternedEntry
+    {
+        size_t hash_; // 预先计算的散列值
+        size_t size_; // 字符数
+    };
+
+    template <typename CharT>
+    inline const CharT *interned_chars(const InternedEntry *e) noexcept
+    {
+        return reinterpret_cast<const CharT *>(e + 1);
+    }
+
+    // 池内散列：按字节做 FNV-1a
+    template <typename CharT>
+    inline size_t interned_hash(const CharT *s, size_t n) noexcept
+    {
+        return bitwise_hash(reinterpret_cast<const unsigned char *>(s), n * sizeof(CharT));
+    }
+
+    /**
+     * 驻留字符串句柄：只含一个指向池中条目的指针
+     * 同一个池给出的句柄内容相同当且仅当指针相同，相等比较与散列都不读取字符
+     * 空串为空指针；句柄在池 clear 或析构之前有效，不同池的句柄不可相互比较
+     */
+    template <typename CharT, typename Traits = char_traits<CharT>>
+    class basic_interned_string
+    {
+        template <typename, typename, typename>
+        friend class basic_string_pool;
+
+    public:
+        using value_type = CharT;
+        using size_type = size_t;
+        using view_type = basic_string_view<CharT, Traits>;
+
+        basic_interned_string() noexcept : entry_(nullptr) {}
+
+        const CharT *data() const noexcept { return entry_ ? interned_chars<CharT>(entry_) : empty_chars(); }
+        const CharT *c_str() const noexcept { return data(); }
+        [[nodiscard]] size_type size() const noexcept { return entry_ ? entry_->size_ : 0; }
+        [[nodiscard]] bool empty() const noexcept { return entry_ == nullptr; }
+
+        // 驻留时计算的散列值，空串为 0
+        size_t hash() const noexcept { return entry_ ? entry_->hash_ : 0; }
+
+        // 标识：同一池内内容相同的句柄标识相同
+        const void *id() const noexcept { return entry_; }
+
+        view_type view() const noexcept { return view_type(data(), size()); }
+        operator view_type() const noexcept { return view(); }
+
+        // 按字典序比较内容
+        int compare(basic_interned_string o) const noexcept
+        {
+            return entry_ == o.entry_ ? 0 : view().compare(o.view());
+        }
+
+        friend bool operator==(basic_interned_string a, basic_interned_string b) noexcept { return a.entry_ == b.entry_; }
+        friend bool operator!=(basic_interned_string a, basic_interned_string b) noexcept { return a.entry_ != b.entry_; }
+
+        friend std::ostream &operator<<(std::ostream &os, basic_interned_string s) { return os << s.view(); }
+
+    private:
+        explicit basic_interned_string(const InternedEntry *e) noexcept : entry_(e) {}
+
+        static const CharT *empty_chars() noexcept
+        {
+            static const CharT zero = CharT();
+            return &zero;
+        }
+
+        const InternedEntry *entry_; // 池中条目，空串为 nullptr
+    };
+
+    /**
+     * 字符串驻留池：相同内容只保存一份
+     * 字符存放在按块分配的竞技场中，条目地址在池的生命周期内不变；开放寻址散列表（线性探测）只存条目指针，
+     * 探测时先比较预存的散列值与长度，再比较字符
+     * 非线程安全，多线程共享时需外部加锁
+     */
+    template <typename CharT, typename Traits = char_traits<CharT>, typename Alloc = alloc<CharT>>
+    class basic_string_pool
+    {
+    private:
+        // 竞技场以 Unit 为单位分配，保证条目对齐
+        struct alignas(alignof(InternedEntry)) Unit
+        {
+            unsigned char bytes_[alignof(InternedEntry)];
+        };
+
+        // 竞技场块头，条目紧随其后
+        struct ArenaBlock
+        {
+            ArenaBlock *next_;
+            size_t units_; // 整块（含块头）的 Unit 数
+        };
+
+    public:
+        using value_type = CharT;
+        using traits_type = Traits;
+        using allocator_type = Alloc;
+        using traits_allocator = allocator_traits<allocator_type>;
+        using size_type = size_t;
+        using handle = basic_interned_string<CharT, Traits>;
+        using view_type = basic_string_view<CharT, Traits>;
+
+    private:
+        using unit_allocator_type = typename traits_allocator::template rebind_alloc<Unit>;
+        using unit_traits_alloc = allocator_traits<unit_allocator_type>;
+        using slot_allocator_type = typename traits_allocator::template rebind_alloc<const InternedEntry *>;
+        using slot_traits_alloc = allocator_traits<slot_allocator_type>;
+
+        static constexpr size_type HEADER_UNITS = (sizeof(ArenaBlock) + sizeof(Unit) - 1) / sizeof(Unit);
+        static constexpr size_type BLOCK_UNITS = STRING_POOL_BLOCK_BYTES / sizeof(Unit);
+
+    public:
+        explicit basic_string_pool(const allocator_type &a = allocator_type())
+            : unit_alloc_(a), slot_alloc_(a), blocks_(nullptr), cur_(nullptr), end_(nullptr),
+              slots_(nullptr), mask_(0), count_(0), arena_units_(0)
+        {
+        }
+
+        basic_string_pool(const basic_string_pool &) = delete;
+        basic_string_pool &operator=(const basic_string_pool &) = delete;
+
+        ~basic_string_pool() { release(); }
+
+        // 驻留：已存在时返回已有句柄，否则拷入竞技场
+        handle intern(view_type s)
+        {
+            size_type n = s.size();
+            if (n == 0)
+                return handle();
+            size_t h = interned_hash(s.data(), n);
+            if ((count_ + 1) * 4 > (mask_ + 1) * 3)
+                rehash(mask_ ? 2 * (mask_ + 1) : STRING_POOL_MIN_SLOTS);
+            size_type i = h & mask_;
+            for (; slots_[i]; i = (i + 1) & mask_)
+                if (matches(slots_[i], h, s))
+                    return handle(slots_[i]);
+            InternedEntry *e = new_entry(h, s);
+            slots_[i] = e;
+            ++count_;
+            return handle(e);
+        }
+        handle intern(const CharT *s) { return intern(view_type(s)); }
+
+        // 只查找不插入：找到时写入 out 并返回 true
+        bool find(view_type s, handle &out) const noexcept
+        {
+            if (s.empty())
+            {
+                out = handle();
+                return true;
+            }
+            if (!slots_)
+                return false;
+            size_t h = interned_hash(s.data(), s.size());
+            for (size_type i = h & mask_; slots_[i]; i = (i + 1) & mask_)
+            {
+                if (matches(slots_[i], h, s))
+                {
+                    out = handle(slots_[i]);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // 不同字符串个数（不含空串）
+        [[nodiscard]] size_type size() const noexcept { return count_; }
+        [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+
+        // 竞技场已申请的字节数
+        size_type arena_bytes() const noexcept { return arena_units_ * sizeof(Unit); }
+
+        // 预留可容纳 n 个字符串而不扩容的散列表
+        void reserve(size_type n)
+        {
+            size_type slots = STRING_POOL_MIN_SLOTS;
+            while (n * 4 > slots * 3)
+                slots *= 2;
+            if (slots > mask_ + 1 || !slots_)
+                rehash(slots);
+        }
+
+        // 释放全部字符串，此前的句柄全部失效
+        void clear() noexcept
+        {
+            release();
+            blocks_ = nullptr;
+            cur_ = end_ = nullptr;
+            slots_ = nullptr;
+            mask_ = count_ = arena_units_ = 0;
+        }
+
+    private:
+        bool matches(const InternedEntry *e, size_t h, view_type s) const noexcept
+        {
+            return e->hash_ == h && e->size_ == s.size() && Traits::compare(interned_chars<CharT>(e), s.data(), s.size()) == 0;
+        }
+
+        InternedEntry *new_entry(size_t h, view_type s)
+        {
+            size_type n = s.size();
+            size_type units = (sizeof(InternedEntry) + (n + 1) * sizeof(CharT) + sizeof(Unit) - 1) / sizeof(Unit);
+            Unit *mem = allocate_units(units);
+            InternedEntry *e = ::new (static_cast<void *>(mem)) InternedEntry{h, n};
+            CharT *chars = reinterpret_cast<CharT *>(e + 1);
+            Traits::copy(chars, s.data(), n);
+            chars[n] = CharT();
+            return e;
+        }
+
+        // 从当前块顺序切分；放不下时新开一块，超过块大小四分之一的条目单独成块，不浪费当前块的剩余空间
+        Unit *allocate_units(size_type units)
+        {
+            if (static_cast<size_type>(end_ - cur_) >= units)
+            {
+                Unit *p = cur_;
+                cur_ += units;
+                return p;
+            }
+            if (units > BLOCK_UNITS / 4)
+                return new_block(HEADER_UNITS + units);
+            cur_ = new_block(BLOCK_UNITS);
+            end_ = cur_ + (BLOCK_UNITS - HEADER_UNITS);
+            Unit *p = cur_;
+            cur_ += units;
+            return p;
+        }
+
+        // 申请一块并挂到块链表头部，返回块头之后的第一个 Unit
+        Unit *new_block(size_type units)
+        {
+            Unit *mem = unit_traits_alloc::allocate(unit_alloc_, units);
+            ArenaBlock *b = ::new (static_cast<void *>(mem)) ArenaBlock{blocks_, units};
+            blocks_ = b;
+            arena_units_ += units;
+            return mem + HEADER_UNITS;
+        }
+
+        // 扩容到 slots 个槽（2 的幂），条目不移动，只重排指针
+        void rehash(size_type slots)
+        {
+            const InternedEntry **fresh = slot_traits_alloc::allocate(slot_alloc_, slots);
+            for (size_type i = 0; i < slots; ++i)
+                fresh[i] = nullptr;
+            size_type mask = slots - 1;
+            if (slots_)
+            {
+                for (size_type i = 0; i <= mask_; ++i)
+                {
+                    const InternedEntry *e = slots_[i];
+                    if (!e)
+                        continue;
+                    size_type j = e->hash_ & mask;
+                    while (fresh[j])
+                        j = (j + 1) & mask;
+                    fresh[j] = e;
+                }
+                slot_traits_alloc::deallocate(slot_alloc_, slots_, mask_ + 1);
+            }
+            slots_ = fresh;
+            mask_ = mask;
+        }
+
+        void release() noexcept
+        {
+            while (blocks_)
+            {
+                ArenaBlock *next = blocks_->next_;
+                unit_traits_alloc::deallocate(unit_alloc_, reinterpret_cast<Unit *>(blocks_), blocks_->units_);
+                blocks_ = next;
+            }
+            if (slots_)
+                slot_traits_alloc::deallocate(slot_alloc_, slots_, mask_ + 1);
+        }
+
+        unit_allocator_type unit_alloc_;  // 竞技场内存
+        slot_allocator_type slot_alloc_;  // 散列表内存
+        ArenaBlock *blocks_;              // 块链表，最新的在前
+        Unit *cur_;                       // 当前块的空闲起点
+        Unit *end_;                       // 当前块末尾
+        const InternedEntry **slots_;     // 散列表，空槽为 nullptr
+        size_type mask_;                  // 槽数 - 1
+        size_type count_;                 // 字符串个数
+        size_type arena_units_;           // 竞技场已申请的 Unit 数
+    };
+
+    using string_pool = basic_string_pool<char>;
+    using interned_string = basic_interned_string<char>;
+
+    // 句柄的散列、相等与排序只看指针：散列取预存值，排序为池内稳定的任意顺序（按内容排序用 compare）
+    template <typename CharT, typename Traits>
+    struct hash<basic_interned_string<CharT, Traits>>
+    {
+        size_t operator()(const basic_interned_string<CharT, Traits> &s) const noexcept { return s.hash(); }
+    };
+
+    template <typename CharT, typename Traits>
+    struct equal_to<basic_interned_string<CharT, Traits>>
+    {
+        bool operator()(const basic_interned_string<CharT, Traits> &a, const basic_interned_string<CharT, Traits> &b) const noexcept
+        {
+            return a.id() == b.id();
+        }
+    };
+
+    template <typename CharT, typename Traits>
+    struct less<basic_interned_string<CharT, Traits>>
+    {
+        bool operator()(const basic_interned_string<CharT, Traits> &a, const basic_interned_string<CharT, Traits> &b) const noexcept
+        {
+            return reinterpret_cast<uintptr_t>(a.id()) < reinterpret_cast<uintptr_t>(b.id());
+        }
+    };
+} // namespace zstl
+
+namespace std
+{
+    // zstl 的有序容器默认使用 std::less，同样按指针排序
+    template <typename CharT, typename Traits>
+    struct less<zstl::basic_interned_string<CharT, Traits>> : zstl::less<zstl::basic_interned_string<CharT, Traits>>
+    {
+    };
+} // namespace std
@@ -0,0 +1,190 @@
+#pragma once
+#include <iostream>
+#include <cassert>
+#include <string_view>
+#include <type_traits>
+#include "char_traits.hpp"
+#include "../iterator/reverse_iterator.hpp"
+#include "../algorithm/string_search.hpp"
+#include "../algorithm/algo.hpp"
+namespace zstl
+{
+    /**
+     * 只读字符串视图：不持有内存，只记录 (指针, 长度)
+     * 切分、查找与比较都不分配，也不依赖终止符；被引用的字符须在视图使用期间保持有效
+     */
+    template <typename CharT, typename Traits = char_traits<CharT>>
+    class basic_string_view
+    {
+    public:
+        using traits_type = Traits;
+        using value_type = CharT;
+        using pointer = CharT *;
+        using const_pointer = const CharT *;
+        using reference = CharT &;
+        using const_reference = const CharT &;
+        using iterator = const CharT *;
+        using const_iterator = const CharT *;
+        using reverse_iterator = basic_reverse_iterator<const_iterator>;
+        using const_reverse_iterator = reverse_iterator;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+        inline static const size_type npos = static_cast<size_type>(-1);
+
+    public:
+        constexpr basic_string_view() noexcept : data_(nullptr), size_(0) {}
+        constexpr basic_string_view(const CharT *s, size_type n) noexcept : data_(s), size_(n) {}
+        basic_string_view(const CharT *s) noexcept : data_(s), size_(Traits::length(s)) {}
+
+        // 迭代器
+        constexpr const_iterator begin() const noexcept { return data_; }
+        constexpr const_iterator end() const noexcept { return data_ + size_; }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+        // 容量与访问
+        [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+        [[nodiscard]] constexpr size_type length() const noexcept { return size_; }
+        [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+        constexpr const_pointer data() const noexcept { return data_; }
+
+        const_reference operator[](size_type pos) const
+        {
+            assert(pos < size_);
+            return data_[pos];
+        }
+        const_reference front() const
+        {
+            assert(size_ > 0);
+            return data_[0];
+        }
+        const_reference back() const
+        {
+            assert(size_ > 0);
+            return data_[size_ - 1];
+        }
+
+        // 收缩视图
+        void remove_prefix(size_type n)
+        {
+            assert(n <= size_);
+            data_ += n;
+            size_ -= n;
+        }
+        void remove_suffix(size_type n)
+        {
+            assert(n <= size_);
+            size_ -= n;
+        }
+
+        void swap(basic_string_view &o) noexcept
+        {
+            zstl::swap(data_, o.data_);
+            zstl::swap(size_, o.size_);
+        }
+
+        // 子视图：不拷贝字符
+        basic_string_view substr(size_type pos = 0, size_type len = npos) const
+        {
+            assert(pos <= size_);
+            size_type rest = size_ - pos;
+            return basic_string_view(data_ + pos, len < rest ? len : rest);
+        }
+
+        // 字典序比较，返回负数 / 0 / 正数
+        int compare(basic_string_view v) const noexcept
+        {
+            size_type m = size_ < v.size_ ? size_ : v.size_;
+            int c = m ? Traits::compare(data_, v.data_, m) : 0;
+            if (c != 0)
+                return c;
+            return size_ == v.size_ ? 0 : (size_ < v.size_ ? -1 : 1);
+        }
+
+        bool starts_with(basic_string_view v) const noexcept
+        {
+            return size_ >= v.size_ && (v.size_ == 0 || Traits::compare(data_, v.data_, v.size_) == 0);
+        }
+        bool starts_with(CharT ch) const noexcept { return size_ && data_[0] == ch; }
+        bool ends_with(basic_string_view v) const noexcept
+        {
+            return size_ >= v.size_ && (v.size_ == 0 || Traits::compare(data_ + size_ - v.size_, v.data_, v.size_) == 0);
+        }
+        bool ends_with(CharT ch) const noexcept { return size_ && data_[size_ - 1] == ch; }
+
+        // 查找：与 basic_string 相同，基于 string_search.hpp
+        size_type find(CharT ch, size_type pos = 0) const noexcept
+        {
+            if (pos >= size_)
+                return npos;
+            return to_pos(find_char(data_ + pos, size_ - pos, ch));
+        }
+        size_type find(basic_string_view v, size_type pos = 0) const noexcept
+        {
+            if (pos > size_)
+                return npos;
+            return to_pos(search_substr(data_ + pos, size_ - pos, v.data_, v.size_));
+        }
+
+        size_type rfind(CharT ch, size_type pos = npos) const noexcept
+        {
+            if (size_ == 0)
+                return npos;
+            return to_pos(rfind_char(data_, pos < size_ ? pos + 1 : size_, ch));
+        }
+        size_type rfind(basic_string_view v, size_type pos = npos) const noexcept
+        {
+            if (v.size_ > size_)
+                return npos;
+            size_type start = pos < size_ - v.size_ ? pos : size_ - v.size_;
+            return to_pos(rsearch_substr(data_, start + v.size_, v.data_, v.size_));
+        }
+
+        size_type find_first_of(basic_string_view v, size_type pos = 0) const noexcept
+        {
+            if (pos >= size_)
+                return npos;
+            return to_pos(find_any_of(data_ + pos, size_ - pos, v.data_, v.size_));
+        }
+        size_type find_first_of(CharT ch, size_type pos = 0) const noexcept { return find(ch, pos); }
+
+        size_type find_last_of(basic_string_view v, size_type pos = npos) const noexcept
+        {
+            if (size_ == 0)
+                return npos;
+            return to_pos(rfind_any_of(data_, pos < size_ ? pos + 1 : size_, v.data_, v.size_));
+        }
+        size_type find_last_of(CharT ch, size_type pos = npos) const noexcept { return rfind(ch, pos); }
+
+        // 比较运算符
+        friend bool operator==(basic_string_view a, basic_string_view b) noexcept
+        {
+            return a.size_ == b.size_ && (a.size_ == 0 || Traits::compare(a.data_, b.data_, a.size_) == 0);
+        }
+        friend bool operator!=(basic_string_view a, basic_string_view b) noexcept { return !(a == b); }
+        friend bool operator<(basic_string_view a, basic_string_view b) noexcept { return a.compare(b) < 0; }
+        friend bool operator>(basic_string_view a, basic_string_view b) noexcept { return b < a; }
+        friend bool operator<=(basic_string_view a, basic_string_view b) noexcept { return !(b < a); }
+        friend bool operator>=(basic_string_view a, basic_string_view b) noexcept { return !(a < b); }
+
+        friend std::ostream &operator<<(std::ostream &os, basic_string_view v)
+        {
+            // char 整段写出（同时遵循 width / fill），其他字符类型逐个写出
+            if constexpr (std::is_same_v<CharT, char>)
+                return os << std::string_view(v.data_, v.size_);
+            for (size_type i = 0; i < v.size_; ++i)
+                os << v.data_[i];
+            return os;
+        }
+
+    private:
+        size_type to_pos(const CharT *p) const noexcept { return p ? static_cast<size_type>(p - data_) : npos; }
+
+        const CharT *data_; // 首字符
+        size_type size_;    // 字符数
+    };
+
+    using string_view = basic_string_view<char>;
+    using wstring_view = basic_string_view<wchar_t>;
+} // namespace zstl
@@ -0,0 +1,405 @@
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+#include "../iterator/reverse_iterator.hpp"
+#include "../allocator/alloc.hpp"
+#include "../allocator/memory.hpp"
+#include "../algorithm/algo.hpp"
+namespace zstl
+{
+    inline constexpr size_t UNROLLED_BLOCK_SLOTS = 64; // 每块的槽位数，恰好对应一个 64 位占用掩码
+    inline constexpr uint64_t UNROLLED_FULL_MASK = ~uint64_t(0);
+    inline constexpr uint64_t UNROLLED_END_BIT = uint64_t(1) << 63; // end() 位于哨兵的第 63 号槽
+
+    /**
+     * 块头：块按遍历次序串成带哨兵的环，尚有空槽的块另串成一条空闲链
+     * 哨兵只有块头、没有槽位，其掩码恒为 0
+     */
+    struct UnrolledBlockBase
+    {
+        UnrolledBlockBase *prev_ = nullptr;      // 遍历次序的前驱
+        UnrolledBlockBase *next_ = nullptr;      // 遍历次序的后继
+        UnrolledBlockBase *free_prev_ = nullptr; // 空闲链前驱
+        UnrolledBlockBase *free_next_ = nullptr; // 空闲链后继
+        uint64_t mask_ = 0;                      // 第 i 位为 1 表示槽 i 存有元素
+    };
+
+    template <typename T>
+    struct UnrolledBlock : UnrolledBlockBase
+    {
+        T *slot(unsigned i) noexcept { return reinterpret_cast<T *>(storage_) + i; }
+
+        alignas(T) unsigned char storage_[UNROLLED_BLOCK_SLOTS * sizeof(T)]; // 未初始化的槽位
+    };
+
+    // 掩码中不高于第 i 位的最近一个 1；不存在时返回 UNROLLED_BLOCK_SLOTS
+    inline unsigned unrolled_prev_slot(uint64_t mask, unsigned i) noexcept
+    {
+        uint64_t rest = i + 1 < UNROLLED_BLOCK_SLOTS ? mask & ((uint64_t(2) << i) - 1) : mask;
+        return rest ? 63u - static_cast<unsigned>(__builtin_clzll(rest)) : static_cast<unsigned>(UNROLLED_BLOCK_SLOTS);
+    }
+
+    // 迭代器：块指针 + 槽号；块内按掩码跳过空槽，块尾沿环进入下一块
+    template <typename T, typename Ref, typename Ptr>
+    struct UnrolledListIterator
+    {
+        using Self = UnrolledListIterator<T, Ref, Ptr>;
+        using block_type = UnrolledBlock<T>;
+
+        // 迭代器萃取必需的五个类型
+        using iterator_category = bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = Ptr;
+        using reference = Ref;
+
+        UnrolledListIterator() : block_(nullptr), slot_(0) {}
+        UnrolledListIterator(UnrolledBlockBase *block, unsigned slot) : block_(block), slot_(slot) {}
+
+        // 普通迭代器构造 const 迭代器；写成模板，不顶替隐式拷贝构造
+        template <typename R, typename P, typename = std::enable_if_t<std::is_convertible_v<P, Ptr>>>
+        UnrolledListIterator(const UnrolledListIterator<T, R, P> &it) : block_(it.block_), slot_(it.slot_) {}
+
+        Ref operator*() const { return *static_cast<block_type *>(block_)->slot(slot_); }
+        Ptr operator->() const { return &**this; }
+
+        Self &operator++()
+        {
+            uint64_t rest = block_->mask_ & (~uint64_t(1) << slot_); // 高于当前槽的元素
+            if (rest)
+                slot_ = static_cast<unsigned>(__builtin_ctzll(rest));
+            else
+            {
+                // 环中的块都非空；哨兵掩码为 0，补上最高位后恰好得到 end() 的槽号 63
+                block_ = block_->next_;
+                slot_ = static_cast<unsigned>(__builtin_ctzll(block_->mask_ | UNROLLED_END_BIT));
+            }
+            return *this;
+        }
+        Self operator++(int)
+        {
+            Self tmp(*this);
+            ++*this;
+            return tmp;
+        }
+        Self &operator--()
+        {
+            unsigned prev = slot_ ? unrolled_prev_slot(block_->mask_, slot_ - 1) : static_cast<unsigned>(UNROLLED_BLOCK_SLOTS);
+            if (prev == UNROLLED_BLOCK_SLOTS)
+            {
+                block_ = block_->prev_;
+                prev = 63u - static_cast<unsigned>(__builtin_clzll(block_->mask_));
+            }
+            slot_ = prev;
+            return *this;
+        }
+        Self operator--(int)
+        {
+            Self tmp(*this);
+            --*this;
+            return tmp;
+        }
+
+        bool operator==(const Self &rhs) const { return block_ == rhs.block_ && slot_ == rhs.slot_; }
+        bool operator!=(const Self &rhs) const { return !(*this == rhs); }
+
+        UnrolledBlockBase *block_; // 所在块，end() 为哨兵的 63 号槽
+        unsigned slot_;            // 块内槽号
+    };
+
+    /**
+     * @brief 展开链表（colony 式分块容器）：每块连续存放 64 个槽位，以占用掩码标记哪些槽有元素
+     * @details 插入放进任意一个有空槽的块（优先复用删除留下的空洞），删除只清掉掩码位，均为 O(1)；
+     *          元素从不移动，指向其余元素的迭代器与指针在插入 / 删除后始终有效。
+     *          遍历按块在环中的次序、块内按槽号连续访问内存，以 ctz 跳过空槽。
+     *          这是无序容器，不能替代 list：遍历次序由块与槽的位置决定，不等于插入次序，
+     *          删除留下的空洞会被之后的插入填上，也不支持在指定位置插入。
+     *          块变空时立即释放，另缓存一个空块以免在边界上反复分配
+     */
+    template <typename T, typename Alloc = alloc<T>>
+    class unrolled_list
+    {
+    public:
+        // --------------- 类型重定义 ---------------
+        using allocator_type = Alloc;
+        using traits_allocator = allocator_traits<allocator_type>;
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using pointer = typename traits_allocator::pointer;
+        using const_pointer = typename traits_allocator::const_pointer;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+        using block_type = UnrolledBlock<T>;
+        using block_allocator_type = typename traits_allocator::template rebind_alloc<block_type>;
+        using block_traits_alloc = allocator_traits<block_allocator_type>;
+
+        using iterator = UnrolledListIterator<T, T &, T *>;
+        using const_iterator = UnrolledListIterator<T, const T &, const T *>;
+        using reverse_iterator = basic_reverse_iterator<iterator>;
+        using const_reverse_iterator = basic_reverse_iterator<const_iterator>;
+
+        // --------------- 迭代器接口 ---------------
+        iterator begin() noexcept { return ++end(); }
+        iterator end() noexcept { return iterator(&head_, UNROLLED_BLOCK_SLOTS - 1); }
+        const_iterator begin() const noexcept { return const_cast<unrolled_list *>(this)->begin(); }
+        const_iterator end() const noexcept { return const_cast<unrolled_list *>(this)->end(); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator cend() const noexcept { return end(); }
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    public:
+        explicit unrolled_list(const allocator_type &alloc = allocator_type())
+            : block_alloc_(alloc), spare_(nullptr), size_(0) { empty_init(); }
+
+        template <typename InputIter, typename = std::enable_if_t<!std::is_integral_v<InputIter>>>
+        unrolled_list(InputIter first, InputIter last, const allocator_type &alloc = allocator_type())
+            : unrolled_list(alloc)
+        {
+            for (; first != last; ++first)
+                emplace(*first);
+        }
+
+        unrolled_list(std::initializer_list<T> il, const allocator_type &alloc = allocator_type())
+            : unrolled_list(il.begin(), il.end(), alloc) {}
+
+        unrolled_list(const unrolled_list &other) : unrolled_list(other.begin(), other.end(), other.block_alloc_) {}
+
+        // 移动：接管整条块环并修正首尾块指向哨兵的指针
+        unrolled_list(unrolled_list &&other) noexcept : unrolled_list(other.block_alloc_) { swap(other); }
+
+        unrolled_list &operator=(const unrolled_list &other)
+        {
+            if (this != &other)
+            {
+                unrolled_list tmp(other);
+                swap(tmp);
+            }
+            return *this;
+        }
+        unrolled_list &operator=(unrolled_list &&other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        ~unrolled_list()
+        {
+            clear();
+            release_spare();
+        }
+
+        // --------------- 容量 ---------------
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+        [[nodiscard]] size_type size() const noexcept { return size_; }
+
+        // --------------- 插入：O(1)，不移动已有元素 ---------------
+        template <typename... Args>
+        iterator emplace(Args &&...args)
+        {
+            if (free_head_.free_next_ == &free_head_)
+                add_block();
+            block_type *block = static_cast<block_type *>(free_head_.free_next_);
+            unsigned slot = static_cast<unsigned>(__builtin_ctzll(~block->mask_));
+            block_traits_alloc::construct(block_alloc_, block->slot(slot), std::forward<Args>(args)...);
+            block->mask_ |= uint64_t(1) << slot;
+            if (block->mask_ == UNROLLED_FULL_MASK)
+                unlink_free(block);
+            ++size_;
+            return iterator(block, slot);
+        }
+
+        iterator insert(const T &value) { return emplace(value); }
+        iterator insert(T &&value) { return emplace(std::move(value)); }
+
+        // --------------- 删除：O(1)，只清掉掩码位 ---------------
+        iterator erase(const_iterator pos)
+        {
+            iterator next(pos.block_, pos.slot_);
+            ++next;
+            block_type *block = static_cast<block_type *>(pos.block_);
+            assert(block != &head_ && (block->mask_ >> pos.slot_ & 1));
+            block_traits_alloc::destroy(block_alloc_, block->slot(pos.slot_));
+            if (block->mask_ == UNROLLED_FULL_MASK)
+                link_free(block);
+            block->mask_ &= ~(uint64_t(1) << pos.slot_);
+            --size_;
+            if (block->mask_ == 0)
+                remove_block(block);
+            return next;
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            while (first != last)
+                first = erase(first);
+            return iterator(last.block_, last.slot_);
+        }
+
+        // 删除所有满足 pred 的元素，返回个数；逐块扫描掩码，不经迭代器
+        template <typename Pred>
+        size_type remove_if(Pred pred)
+        {
+            size_type removed = 0;
+            for (UnrolledBlockBase *b = head_.next_; b != &head_;)
+            {
+                block_type *block = static_cast<block_type *>(b);
+                b = b->next_;
+                bool was_full = block->mask_ == UNROLLED_FULL_MASK;
+                for (uint64_t m = block->mask_; m; m &= m - 1)
+                {
+                    unsigned slot = static_cast<unsigned>(__builtin_ctzll(m));
+                    if (pred(*block->slot(slot)))
+                    {
+                        block_traits_alloc::destroy(block_alloc_, block->slot(slot));
+                        block->mask_ &= ~(uint64_t(1) << slot);
+                        ++removed;
+                    }
+                }
+                if (was_full && block->mask_ != UNROLLED_FULL_MASK)
+                    link_free(block);
+                if (block->mask_ == 0)
+                    remove_block(block);
+            }
+            size_ -= removed;
+            return removed;
+        }
+
+        // 销毁全部元素并释放所有块（保留一个缓存块）
+        void clear() noexcept
+        {
+            for (UnrolledBlockBase *b = head_.next_; b != &head_;)
+            {
+                block_type *block = static_cast<block_type *>(b);
+                b = b->next_;
+                for (uint64_t m = block->mask_; m; m &= m - 1)
+                    block_traits_alloc::destroy(block_alloc_, block->slot(static_cast<unsigned>(__builtin_ctzll(m))));
+                block->mask_ = 0;
+                release_block(block);
+            }
+            empty_init();
+            size_ = 0;
+        }
+
+        void swap(unrolled_list &other) noexcept
+        {
+            if (this == &other)
+                return;
+            swap_ring(head_, other.head_, &UnrolledBlockBase::prev_, &UnrolledBlockBase::next_);
+            swap_ring(free_head_, other.free_head_, &UnrolledBlockBase::free_prev_, &UnrolledBlockBase::free_next_);
+            zstl::swap(block_alloc_, other.block_alloc_);
+            zstl::swap(spare_, other.spare_);
+            zstl::swap(size_, other.size_);
+        }
+
+    private:
+        void empty_init() noexcept
+        {
+            head_.prev_ = head_.next_ = &head_;
+            free_head_.free_prev_ = free_head_.free_next_ = &free_head_;
+        }
+
+        // 新块接到遍历环尾部并放进空闲链；优先取缓存块
+        void add_block()
+        {
+            block_type *block = spare_;
+            if (block)
+                spare_ = nullptr;
+            else
+            {
+                block = block_traits_alloc::allocate(block_alloc_, 1);
+                ::new (static_cast<void *>(block)) block_type;
+            }
+            block->mask_ = 0;
+            block->prev_ = head_.prev_;
+            block->next_ = &head_;
+            head_.prev_->next_ = block;
+            head_.prev_ = block;
+            link_free(block);
+        }
+
+        // 已空的块：从两条链上摘下后缓存或释放
+        void remove_block(block_type *block) noexcept
+        {
+            unlink_free(block);
+            block->prev_->next_ = block->next_;
+            block->next_->prev_ = block->prev_;
+            release_block(block);
+        }
+
+        void release_block(block_type *block) noexcept
+        {
+            if (!spare_)
+                spare_ = block;
+            else
+                block_traits_alloc::deallocate(block_alloc_, block, 1);
+        }
+
+        void release_spare() noexcept
+        {
+            if (spare_)
+                block_traits_alloc::deallocate(block_alloc_, spare_, 1);
+            spare_ = nullptr;
+        }
+
+        // 空闲链头插：最近出现空槽的块最先被复用，保持写入集中
+        void link_free(UnrolledBlockBase *block) noexcept
+        {
+            block->free_prev_ = &free_head_;
+            block->free_next_ = free_head_.free_next_;
+            free_head_.free_next_->free_prev_ = block;
+            free_head_.free_next_ = block;
+        }
+
+        static void unlink_free(UnrolledBlockBase *block) noexcept
+        {
+            block->free_prev_->free_next_ = block->free_next_;
+            block->free_next_->free_prev_ = block->free_prev_;
+        }
+
+        // 交换两个哨兵各自串起的环（prev / next 为所用的一对指针成员）
+        using Link = UnrolledBlockBase *UnrolledBlockBase::*;
+        static void swap_ring(UnrolledBlockBase &a, UnrolledBlockBase &b, Link prev, Link next) noexcept
+        {
+            UnrolledBlockBase *a_first = a.*next, *a_last = a.*prev;
+            UnrolledBlockBase *b_first = b.*next, *b_last = b.*prev;
+            auto relink = [prev, next](UnrolledBlockBase &head, UnrolledBlockBase *other_head,
+                                       UnrolledBlockBase *first, UnrolledBlockBase *last)
+            {
+                if (first == other_head)
+                {
+                    head.*prev = head.*next = &head;
+                    return;
+                }
+                head.*next = first;
+                head.*prev = last;
+                first->*prev = &head;
+                last->*next = &head;
+            };
+            relink(a, &b, b_first, b_last);
+            relink(b, &a, a_first, a_last);
+        }
+
+        block_allocator_type block_alloc_; // 块分配器
+        UnrolledBlockBase head_;           // 遍历环的哨兵
+        UnrolledBlockBase free_head_;      // 空闲链的哨兵
+        block_type *spare_;                // 缓存的空块
+        size_type size_;                   // 元素个数
+    };
+
+    template <typename T, typename Alloc>
+    void swap(unrolled_list<T, Alloc> &lhs, unrolled_list<T, Alloc> &rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+} // namespace zstl
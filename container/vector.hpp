@@ -1,14 +1,39 @@
 #pragma once
 #include <cassert>
+#include <cstring>
 #include <initializer_list>
+#include <iterator>
 #include "../iterator/reverse_iterator.hpp"
 #include "../allocator/alloc.hpp"
 #include "../allocator/memory.hpp"
+#include "../allocator/growth_policy.hpp"
 #include "../algorithm/algo.hpp"
 namespace zstl
 {
-    template <typename T, typename Alloc = alloc<T>>
-    class vector
+    // 内联存储：N 个元素的未初始化缓冲区，N == 0 时为空基类
+    template <typename T, size_t N>
+    struct VectorInlineStorage
+    {
+        T *inline_data() { return reinterpret_cast<T *>(buf_); }
+        const T *inline_data() const { return reinterpret_cast<const T *>(buf_); }
+
+        alignas(T) unsigned char buf_[N * sizeof(T)];
+    };
+
+    template <typename T>
+    struct VectorInlineStorage<T, 0>
+    {
+        T *inline_data() { return nullptr; }
+        const T *inline_data() const { return nullptr; }
+    };
+
+    /**
+     * InlineN > 0 时前 InlineN 个元素存放在对象内部，超出后才向分配器申请内存
+     * 对外通过 small_vector<T, N> 使用，见 small_vector.hpp
+     * Growth 为扩容策略，见 growth_policy.hpp
+     */
+    template <typename T, typename Alloc = alloc<T>, size_t InlineN = 0, typename Growth = growth_2x>
+    class vector : private VectorInlineStorage<T, InlineN>
     {
         static_assert(!std::is_same_v<bool, T>, "vector<bool> is abandoned in zstl");
 
@@ -48,17 +73,14 @@ namespace zstl
 
         // 默认构造函数，不做任何初始化
         explicit vector(const allocator_type &alloc = allocator_type())
-            : alloc_(alloc), start_(nullptr), finish_(nullptr), end_of_storage_(nullptr) {}
+            : alloc_(alloc) {}
 
         // 拷贝构造函数：复制另一个 vector 对象
         vector(const vector &v, const allocator_type &alloc)
             : alloc_(alloc)
         {
-            // 分配足够的内存存储 v 的所有元素
-            reserve(v.size());
-            // 逐个调用 push_back 将 v 中的元素复制进来
-            for (auto &e : v)
-                push_back(e);
+            // 一次分配后整体复制
+            assign(v.begin(), v.end());
         }
 
         // 拷贝构造函数
@@ -69,21 +91,15 @@ namespace zstl
         vector(std::initializer_list<T> lt, const allocator_type &alloc = allocator_type())
             : alloc_(alloc)
         {
-            reserve(lt.size());
-            for (auto &e : lt)
-                push_back(e);
+            assign(lt.begin(), lt.end());
         }
 
         // 范围构造函数：根据迭代器 [first, last) 内的元素构造 vector
-        template <typename InputIterator>
+        template <typename InputIterator, typename = std::enable_if_t<!std::is_integral_v<InputIterator>>>
         vector(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type())
             : alloc_(alloc)
         {
-            while (first != last)
-            {
-                push_back(*first);
-                ++first;
-            }
+            assign(first, last);
         }
 
         // 指定大小构造，并用 val 初始化每个元素
@@ -103,31 +119,23 @@ namespace zstl
 
         // 移动构造（带分配器）
         vector(vector &&v, const allocator_type &alloc) noexcept
-            : alloc_(alloc), start_(nullptr), finish_(nullptr), end_of_storage_(nullptr)
+            : alloc_(alloc)
         {
             // 简化：无状态分配器直接窃取资源
-            start_ = v.start_;
-            finish_ = v.finish_;
-            end_of_storage_ = v.end_of_storage_;
-            v.start_ = v.finish_ = v.end_of_storage_ = nullptr;
+            steal(v);
         }
 
         // 析构函数，释放 vector 内部申请的内存空间
         ~vector()
         {
-            clear();
-            if (start_)
-                traits_allocator::deallocate(alloc_, start_, capacity());
+            release();
         }
 
         // 赋值重载
         vector &operator=(const vector &v)
         {
             if (this != &v)
-            {
-                vector tmp(v, get_allocator());
-                swap(tmp);
-            }
+                assign(v.begin(), v.end());
             return *this;
         }
 
@@ -136,14 +144,10 @@ namespace zstl
         {
             if (this != &v)
             {
-                clear();
-                if (start_)
-                    traits_allocator::deallocate(alloc_, start_, capacity());
+                release();
+                reset_storage();
                 // 窃取资源
-                start_ = v.start_;
-                finish_ = v.finish_;
-                end_of_storage_ = v.end_of_storage_;
-                v.start_ = v.finish_ = v.end_of_storage_ = nullptr;
+                steal(v);
             }
             return *this;
         }
@@ -161,19 +165,17 @@ namespace zstl
             if (n > capacity())
             {
                 size_type old_size = size();
-                // 用 allocator_traits 申请原始内存
-                pointer tmp = traits_allocator::allocate(alloc_, n);
-                // 将原有元素复制到新的内存中
-                for (size_type i = 0; i < old_size; ++i)
-                {
-                    traits_allocator::construct(alloc_, tmp + i, std::move(start_[i]));
-                }
+                // 用 allocator_traits 申请原始内存，容量取分配器实际给出的大小
+                size_type cap = 0;
+                pointer tmp = allocate_buffer(n, cap);
+                // 将原有元素搬移到新内存，并析构旧元素
+                relocate(start_, finish_, tmp);
                 // 释放旧内存
-                traits_allocator::deallocate(alloc_, start_, capacity());
+                deallocate_buffer();
                 // 更新内部指针
                 start_ = tmp;
                 finish_ = start_ + old_size;
-                end_of_storage_ = start_ + n;
+                end_of_storage_ = start_ + cap;
             }
         }
 
@@ -199,10 +201,36 @@ namespace zstl
             }
         }
 
+        // 改变大小但不初始化新增元素，仅限平凡类型；用于随后整体覆写的缓冲区
+        template <typename U = T>
+        std::enable_if_t<std::is_trivial_v<U>> resize_uninitialized(size_type n)
+        {
+            grow_to(n);
+            finish_ = start_ + n;
+        }
+
+        /**
+         * 扩展到 n 个元素（新增部分不初始化）后调用 op(data(), n) 覆写内容
+         * op 返回最终长度 r（r <= n），仅限平凡类型
+         */
+        template <typename Op, typename U = T>
+        std::enable_if_t<std::is_trivial_v<U>> resize_and_overwrite(size_type n, Op op)
+        {
+            grow_to(n);
+            size_type r = static_cast<size_type>(op(start_, n));
+            assert(r <= n);
+            finish_ = start_ + r;
+        }
+
         // 在 vector 尾部添加一个新元素
         void push_back(const value_type &val)
         {
-            insert(end(), val);
+            emplace_back(val);
+        }
+
+        void push_back(value_type &&val)
+        {
+            emplace_back(std::move(val));
         }
 
         // 移除 vector 尾部的元素
@@ -219,8 +247,9 @@ namespace zstl
         {
             if (finish_ == end_of_storage_)
             {
-                size_type new_cap = capacity() ? capacity() * 2 : 4;
-                reserve(new_cap);
+                // 先在新内存上构造，args 可能引用旧内存中的元素
+                realloc_emplace(size(), std::forward<Args>(args)...);
+                return;
             }
             traits_allocator::construct(alloc_, finish_, std::forward<Args>(args)...);
             ++finish_;
@@ -232,19 +261,34 @@ namespace zstl
             assert(pos >= start_ && pos <= finish_);
             size_type idx = pos - start_;
             if (finish_ == end_of_storage_)
+                return realloc_emplace(idx, val);
+            if (pos == finish_)
             {
-                size_type new_cap = capacity() ? capacity() * 2 : 4;
-                reserve(new_cap);
+                traits_allocator::construct(alloc_, finish_, val);
+                ++finish_;
+                return pos;
             }
-            pos = start_ + idx;
-            // 移动元素
-            for (iterator it = finish_; it > pos; --it)
+            if constexpr (is_trivially_relocatable_v<T>)
             {
-                traits_allocator::construct(alloc_, it, std::move(*(it - 1)));
+                // 整体后移一格；val 若位于被移动区间内，其地址随之后移
+                const value_type *vp = std::addressof(val);
+                if (pos <= vp && vp < finish_)
+                    ++vp;
+                std::memmove(static_cast<void *>(pos + 1), static_cast<const void *>(pos),
+                             (finish_ - pos) * sizeof(T));
+                ++finish_;
+                traits_allocator::construct(alloc_, pos, *vp);
+            }
+            else
+            {
+                // 先复制 val，防止其引用被移动的元素
+                value_type copy(val);
+                traits_allocator::construct(alloc_, finish_, std::move(*(finish_ - 1)));
+                for (iterator it = finish_ - 1; it > pos; --it)
+                    *it = std::move(*(it - 1));
+                *pos = std::move(copy);
+                ++finish_;
             }
-            // 插入新元素
-            traits_allocator::construct(alloc_, pos, val);
-            ++finish_;
             return pos;
         }
 
@@ -252,23 +296,213 @@ namespace zstl
         iterator erase(iterator pos)
         {
             assert(pos >= start_ && pos < finish_);
-            // 销毁 pos
-            traits_allocator::destroy(alloc_, pos);
-            // 移动后续元素覆盖
-            for (iterator it = pos; it < finish_ - 1; ++it)
+            if constexpr (is_trivially_relocatable_v<T>)
             {
-                traits_allocator::construct(alloc_, it, std::move(*(it + 1)));
+                // 析构 pos 后将后续元素整体前移
+                traits_allocator::destroy(alloc_, pos);
+                std::memmove(static_cast<void *>(pos), static_cast<const void *>(pos + 1),
+                             (finish_ - pos - 1) * sizeof(T));
+                --finish_;
+            }
+            else
+            {
+                // 移动赋值覆盖，再析构尾部多出的元素
+                for (iterator it = pos; it + 1 < finish_; ++it)
+                    *it = std::move(*(it + 1));
+                --finish_;
+                traits_allocator::destroy(alloc_, finish_);
             }
-            --finish_;
             return pos;
         }
 
+        // 在 pos 处插入 n 个 val
+        iterator insert(iterator pos, size_type n, const value_type &val)
+        {
+            assert(pos >= start_ && pos <= finish_);
+            if (n == 0)
+                return pos;
+            // 先复制 val，防止其引用被移动的元素
+            value_type copy(val);
+            size_type live = make_room(pos, n);
+            for (size_type i = 0; i < live; ++i)
+                pos[i] = copy;
+            for (size_type i = live; i < n; ++i)
+                traits_allocator::construct(alloc_, pos + i, copy);
+            return pos;
+        }
+
+        // 在 pos 处插入 [first, last)；前向迭代器只腾挪一次，[first, last) 不得指向自身
+        template <typename InputIterator, typename = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+        iterator insert(iterator pos, InputIterator first, InputIterator last)
+        {
+            assert(pos >= start_ && pos <= finish_);
+            if constexpr (is_forward_iterator_v<InputIterator>)
+            {
+                size_type n = zstl::distance(first, last);
+                if (n == 0)
+                    return pos;
+                size_type live = make_room(pos, n);
+                for (size_type i = 0; i < live; ++i, ++first)
+                    pos[i] = *first;
+                construct_range(first, last, pos + live);
+                return pos;
+            }
+            else
+            {
+                // 单趟迭代器：尾部直接追加，否则先收集再整体插入
+                size_type idx = pos - start_;
+                if (pos == finish_)
+                {
+                    for (; first != last; ++first)
+                        emplace_back(*first);
+                    return start_ + idx;
+                }
+                vector tmp(first, last, alloc_);
+                return insert(pos, tmp.begin(), tmp.end());
+            }
+        }
+
+        iterator insert(iterator pos, std::initializer_list<T> il)
+        {
+            return insert(pos, il.begin(), il.end());
+        }
+
+        // 在尾部追加一个范围内的全部元素
+        template <typename Range>
+        void append_range(const Range &r)
+        {
+            insert(end(), std::begin(r), std::end(r));
+        }
+
+        // 用 n 个 val 替换全部内容
+        void assign(size_type n, const value_type &val)
+        {
+            if (n > capacity())
+            {
+                vector tmp(n, val, alloc_);
+                swap(tmp);
+                return;
+            }
+            size_type common = zstl::min(n, size());
+            for (size_type i = 0; i < common; ++i)
+                start_[i] = val;
+            if (n > size())
+            {
+                for (; finish_ != start_ + n; ++finish_)
+                    traits_allocator::construct(alloc_, finish_, val);
+            }
+            else
+            {
+                traits_allocator::destroy_range(alloc_, start_ + n, finish_);
+                finish_ = start_ + n;
+            }
+        }
+
+        // 用 [first, last) 替换全部内容；容量足够时复用已有元素与内存
+        template <typename InputIterator, typename = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+        void assign(InputIterator first, InputIterator last)
+        {
+            if constexpr (is_forward_iterator_v<InputIterator>)
+            {
+                size_type n = zstl::distance(first, last);
+                if (n > capacity())
+                {
+                    // 按 n 个分配，旧元素直接丢弃
+                    size_type cap = 0;
+                    pointer tmp = allocate_buffer(n, cap);
+                    construct_range(first, last, tmp);
+                    release();
+                    start_ = tmp;
+                    finish_ = tmp + n;
+                    end_of_storage_ = tmp + cap;
+                    return;
+                }
+                size_type common = zstl::min(n, size());
+                InputIterator mid = first;
+                zstl::advance(mid, common);
+                zstl::copy(first, mid, start_);
+                if (n > size())
+                {
+                    construct_range(mid, last, finish_);
+                }
+                else
+                {
+                    traits_allocator::destroy_range(alloc_, start_ + n, finish_);
+                }
+                finish_ = start_ + n;
+            }
+            else
+            {
+                clear();
+                for (; first != last; ++first)
+                    emplace_back(*first);
+            }
+        }
+
+        void assign(std::initializer_list<T> il)
+        {
+            assign(il.begin(), il.end());
+        }
+
+        // 删除 [first, last) 内的元素，返回删除位置
+        iterator erase(iterator first, iterator last)
+        {
+            assert(first >= start_ && first <= last && last <= finish_);
+            if (first == last)
+                return first;
+            size_type tail = finish_ - last;
+            if constexpr (is_trivially_relocatable_v<T>)
+            {
+                traits_allocator::destroy_range(alloc_, first, last);
+                std::memmove(static_cast<void *>(first), static_cast<const void *>(last), tail * sizeof(T));
+            }
+            else
+            {
+                for (size_type i = 0; i < tail; ++i)
+                    first[i] = std::move(last[i]);
+                traits_allocator::destroy_range(alloc_, first + tail, finish_);
+            }
+            finish_ = first + tail;
+            return first;
+        }
+
+        // 释放多余容量，使 capacity() == size()
+        void shrink_to_fit()
+        {
+            if (finish_ == end_of_storage_)
+                return;
+            if (is_inline())
+                return;
+            size_type n = size();
+            if (n <= InlineN)
+            {
+                // 元素放得回内联存储时搬回去
+                pointer old = start_;
+                size_type old_cap = capacity();
+                reset_storage();
+                relocate(old, old + n, start_);
+                finish_ = start_ + n;
+                if (old)
+                    traits_allocator::deallocate(alloc_, old, old_cap);
+                return;
+            }
+            pointer tmp = traits_allocator::allocate(alloc_, n);
+            relocate(start_, finish_, tmp);
+            deallocate_buffer();
+            start_ = tmp;
+            finish_ = end_of_storage_ = tmp + n;
+        }
+
         // 获取首尾元素
         reference front() { return start_[0]; }
         reference back() { return *(finish_ - 1); }
         const_reference front() const { return start_[0]; }
         const_reference back() const { return *(finish_ - 1); }
 
+        // 底层连续存储的首地址
+        pointer data() noexcept { return start_; }
+        const_pointer data() const noexcept { return start_; }
+
         // 重载 [] 运算符，提供对元素的可读写访问
         reference operator[](size_type pos)
         {
@@ -284,6 +518,17 @@ namespace zstl
         // 交换两个 vector 内部数据的指针，效率高，不需要复制元素
         void swap(vector &v)
         {
+            if constexpr (InlineN > 0)
+            {
+                // 内联存储中的元素无法通过交换指针转移
+                if (is_inline() || v.is_inline())
+                {
+                    vector tmp(std::move(v));
+                    v = std::move(*this);
+                    *this = std::move(tmp);
+                    return;
+                }
+            }
             zstl::swap(start_, v.start_);
             zstl::swap(finish_, v.finish_);
             zstl::swap(end_of_storage_, v.end_of_storage_);
@@ -299,9 +544,190 @@ namespace zstl
         }
 
     private:
+        // 按增长策略计算容纳 required 个元素所需的新容量
+        size_type next_capacity(size_type required) const
+        {
+            return Growth::next_capacity(capacity(), required, sizeof(T));
+        }
+
+        // 申请至少 n 个元素的内存，cap 返回实际可用的个数
+        pointer allocate_buffer(size_type n, size_type &cap)
+        {
+            auto r = traits_allocator::allocate_at_least(alloc_, n);
+            cap = r.count;
+            return r.ptr;
+        }
+
+        /**
+         * 将 [first, last) 的元素搬移到未初始化内存 dest 并析构源元素
+         * 可平凡重定位的类型直接 memcpy；否则移动构造（移动可能抛出时退化为拷贝）
+         */
+        void relocate(iterator first, iterator last, iterator dest)
+        {
+            if constexpr (is_trivially_relocatable_v<T>)
+            {
+                // 与 make_room 相同：空区间（可能是空指针）不调用 memcpy
+                size_type count = last - first;
+                if (first && count != 0)
+                    std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first), count * sizeof(T));
+            }
+            else
+            {
+                for (iterator it = first; it != last; ++it, ++dest)
+                    traits_allocator::construct(alloc_, dest, std::move_if_noexcept(*it));
+                traits_allocator::destroy_range(alloc_, first, last);
+            }
+        }
+
+        // 容量不足时在 idx 处构造新元素：先构造新元素，再把两侧旧元素搬移过去
+        template <typename... Args>
+        iterator realloc_emplace(size_type idx, Args &&...args)
+        {
+            size_type old_size = size();
+            size_type new_cap = 0;
+            pointer tmp = allocate_buffer(next_capacity(old_size + 1), new_cap);
+            traits_allocator::construct(alloc_, tmp + idx, std::forward<Args>(args)...);
+            relocate(start_, start_ + idx, tmp);
+            relocate(start_ + idx, finish_, tmp + idx + 1);
+            deallocate_buffer();
+            start_ = tmp;
+            finish_ = start_ + old_size + 1;
+            end_of_storage_ = start_ + new_cap;
+            return start_ + idx;
+        }
+
+        // 保证容量不小于 n，扩容时按增长策略放大
+        void grow_to(size_type n)
+        {
+            if (n > capacity())
+                reserve(next_capacity(n));
+        }
+
+        // 析构全部元素并归还内存（不重置指针）
+        void release()
+        {
+            clear();
+            deallocate_buffer();
+        }
+
+        // 归还堆内存；内联存储无需归还
+        void deallocate_buffer()
+        {
+            if (start_ && !is_inline())
+                traits_allocator::deallocate(alloc_, start_, capacity());
+        }
+
+        // 当前是否使用内联存储
+        bool is_inline() const
+        {
+            if constexpr (InlineN == 0)
+                return false;
+            else
+                return start_ == this->inline_data();
+        }
+
+        // 回到初始的空状态：内联存储或空指针
+        void reset_storage()
+        {
+            start_ = finish_ = this->inline_data();
+            end_of_storage_ = start_ + InlineN;
+        }
+
+        // 从 v 接管全部元素，要求 *this 处于初始空状态
+        void steal(vector &v)
+        {
+            if (v.is_inline())
+            {
+                // 内联存储只能逐个搬移，元素数不超过 InlineN
+                relocate(v.start_, v.finish_, start_);
+                finish_ = start_ + v.size();
+                v.finish_ = v.start_;
+                return;
+            }
+            start_ = v.start_;
+            finish_ = v.finish_;
+            end_of_storage_ = v.end_of_storage_;
+            v.reset_storage();
+        }
+
+        /**
+         * 在 pos 处腾出 n 个槽位，必要时扩容并更新 pos
+         * 返回值 live：[pos, pos + live) 为已被移走的存活对象（需赋值），其余为未初始化内存（需构造）
+         */
+        size_type make_room(iterator &pos, size_type n)
+        {
+            size_type idx = pos - start_;
+            size_type old_size = size();
+            if (n > static_cast<size_type>(end_of_storage_ - finish_))
+            {
+                // 一次扩到足够大，前后两段整体搬移
+                size_type new_cap = 0;
+                pointer tmp = allocate_buffer(next_capacity(old_size + n), new_cap);
+                relocate(start_, start_ + idx, tmp);
+                relocate(start_ + idx, finish_, tmp + idx + n);
+                deallocate_buffer();
+                start_ = tmp;
+                finish_ = start_ + old_size + n;
+                end_of_storage_ = start_ + new_cap;
+                pos = start_ + idx;
+                return 0;
+            }
+            size_type elems_after = finish_ - pos;
+            if constexpr (is_trivially_relocatable_v<T>)
+            {
+                // 空 vector 的 pos 为空指针：没有元素要后移时跳过 memmove（显式判空让编译器也能看出这一点）
+                if (pos && elems_after != 0)
+                    std::memmove(static_cast<void *>(pos + n), static_cast<const void *>(pos), elems_after * sizeof(T));
+                finish_ += n;
+                return 0;
+            }
+            else
+            {
+                iterator old_finish = finish_;
+                if (elems_after > n)
+                {
+                    // 尾部 n 个移动构造到未初始化区，其余移动赋值后移
+                    for (size_type i = 0; i < n; ++i)
+                        traits_allocator::construct(alloc_, old_finish + i, std::move(*(old_finish - n + i)));
+                    for (iterator it = old_finish - n; it != pos;)
+                    {
+                        --it;
+                        it[n] = std::move(*it);
+                    }
+                    finish_ += n;
+                    return n;
+                }
+                // 被移动的元素全部落在未初始化区
+                for (size_type i = 0; i < elems_after; ++i)
+                    traits_allocator::construct(alloc_, pos + n + i, std::move(pos[i]));
+                finish_ += n;
+                return elems_after;
+            }
+        }
+
+        // 将 [first, last) 复制构造到未初始化内存 dest；同类型指针区间直接 memcpy
+        template <typename ForwardIt>
+        void construct_range(ForwardIt first, ForwardIt last, iterator dest)
+        {
+            using src_type = std::remove_cv_t<typename iterator_traits<ForwardIt>::value_type>;
+            if constexpr (std::is_pointer_v<ForwardIt> && std::is_same_v<src_type, T> &&
+                          std::is_trivially_copyable_v<T>)
+            {
+                // 与 make_room 相同：空区间（可能是空指针）不调用 memcpy
+                size_type count = last - first;
+                if (first && count != 0)
+                    std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first), count * sizeof(T));
+            }
+            else
+            {
+                for (; first != last; ++first, ++dest)
+                    traits_allocator::construct(alloc_, dest, *first);
+            }
+        }
+
         allocator_type alloc_;
-        iterator start_ = nullptr;
-        iterator finish_ = nullptr;
-        iterator end_of_storage_ = nullptr;
+        iterator start_ = this->inline_data();
+        iterator finish_ = start_;
+        iterator end_of_storage_ = start_ + InlineN;
     };
 } // namespace zstl
@@ -255,6 +255,19 @@ namespace zstl
         }
     };
 
+    // string_view 特化：与 hash<zstl::string> 取值一致，视图可直接用于按字符串键查找
+    template <>
+    struct hash<zstl::string_view>
+    {
+        size_t operator()(zstl::string_view s) const noexcept
+        {
+            size_t h = 0;
+            for (auto c : s)
+                h = h * 131 + c;
+            return h;
+        }
+    };
+
     // 前置声明
     template <typename Fun, typename... Args>
     struct bind_t;
@@ -183,4 +183,39 @@ namespace zstl
         advance(it, -n);
         return it;
     }
+
+    /**
+     * 分段迭代器萃取：底层由若干连续缓冲区组成的迭代器（如 deque）可特化本模板，
+     * 算法据此按段处理，每段退化为原始指针区间，从而复用指针版本的 memmove/memset 优化
+     * 特化需提供：
+     *   segment_iterator / local_iterator 类型
+     *   segment(it) / local(it)：迭代器所在的段与段内位置
+     *   begin(seg) / end(seg)：段的首尾
+     */
+    template <typename It>
+    struct segmented_iterator_traits
+    {
+        static constexpr bool is_segmented = false;
+    };
+
+    template <typename It>
+    inline constexpr bool is_segmented_iterator_v = segmented_iterator_traits<It>::is_segmented;
+
+    // 对分段区间 [first, last) 的每个连续段依次调用 f(local_first, local_last)
+    template <typename SegIt, typename F>
+    void for_each_segment(SegIt first, SegIt last, F &&f)
+    {
+        using Traits = segmented_iterator_traits<SegIt>;
+        auto sfirst = Traits::segment(first);
+        auto slast = Traits::segment(last);
+        if (sfirst == slast)
+        {
+            f(Traits::local(first), Traits::local(last));
+            return;
+        }
+        f(Traits::local(first), Traits::end(sfirst));
+        for (++sfirst; sfirst != slast; ++sfirst)
+            f(Traits::begin(sfirst), Traits::end(sfirst));
+        f(Traits::begin(slast), Traits::local(last));
+    }
 }
\ No newline at end of file
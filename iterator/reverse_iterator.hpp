@@ -48,7 +48,7 @@ namespace zstl
         self operator++(int)
         {
             self tmp = *this;
-            --(*this);
+            ++(*this);
             return tmp;
         }
 
@@ -170,6 +170,12 @@ namespace zstl
             return self(this->current_ + n);
         }
 
+        // 两个反向迭代器之间的距离
+        difference_type operator-(const self &b) const
+        {
+            return b.current_ - this->current_;
+        }
+
         reference operator[](difference_type n) const
         {
             return *(*this + n);
@@ -1,7 +1,13 @@
 #include "test_string.hpp"
+#include "test_string_view.hpp"
+#include "test_rope.hpp"
+#include "test_string_pool.hpp"
+#include "test_charconv.hpp"
 #include "test_vector.hpp"
+#include "test_small_vector.hpp"
 #include "test_list.hpp"
 #include "test_deque.hpp"
+#include "test_ring_buffer.hpp"
 #include "test_stack.hpp"
 #include "test_queue.hpp"
 #include "test_priority_queue.hpp"
@@ -9,11 +15,21 @@
 #include "test_map.hpp"
 #include "test_multiset.hpp"
 #include "test_multimap.hpp"
+#include "test_ranked_set.hpp"
+#include "test_ranked_map.hpp"
+#include "test_compact_map.hpp"
+#include "test_concurrent_skiplist_map.hpp"
+#include "test_concurrent_queue.hpp"
 #include "test_unordered_set.hpp"
 #include "test_unordered_map.hpp"
 #include "test_unordered_multiset.hpp"
 #include "test_unordered_multimap.hpp"
 #include "test_forward_list.hpp"
+#include "test_intrusive_list.hpp"
+#include "test_intrusive_rbtree.hpp"
+#include "test_intrusive_hash_set.hpp"
+#include "test_lru_cache.hpp"
+#include "test_unrolled_list.hpp"
 #include "test_array.hpp"
 
 #include "test_stream_iterator.hpp"
@@ -122,4 +122,76 @@ namespace zstl
         SUCCEED();
     }
 
+
+    // 测试：good_size 取整到内存池档位 / malloc 粒度 / 页
+    TEST_F(allocTest, GoodSizeRoundsToSizeClass)
+    {
+        EXPECT_EQ(alloc<int>::good_size(0), 0u);
+        EXPECT_EQ(alloc<int>::good_size(1), 2u);  // 4 字节 -> 8 字节档位
+        EXPECT_EQ(alloc<int>::good_size(5), 6u);  // 20 字节 -> 24 字节档位
+        EXPECT_EQ(alloc<char>::good_size(129), 144u);
+        EXPECT_EQ(alloc<char>::good_size(5000), 8192u);
+        struct Big
+        {
+            char c[24];
+        };
+        EXPECT_EQ(alloc<Big>::good_size(1), 1u);
+        for (size_t n = 1; n < 3000; n += 7)
+            EXPECT_GE(alloc<Big>::good_size(n), n);
+    }
+
+    // 测试：allocator_traits::allocate_at_least 返回的个数可用于释放
+    TEST_F(allocTest, AllocateAtLeast)
+    {
+        alloc<int> a;
+        for (size_t n = 1; n < 2000; n += 13)
+        {
+            auto r = allocator_traits<alloc<int>>::allocate_at_least(a, n);
+            ASSERT_NE(r.ptr, nullptr);
+            EXPECT_GE(r.count, n);
+            r.ptr[r.count - 1] = 1; // 整个区间都可用
+            allocator_traits<alloc<int>>::deallocate(a, r.ptr, r.count);
+        }
+        // vector 的容量反映实际拿到的大小
+        vector<int> v;
+        v.reserve(5);
+        EXPECT_EQ(v.capacity(), 6u);
+    }
+
+    // 测试：扩容策略
+    TEST_F(allocTest, GrowthPolicies)
+    {
+        EXPECT_EQ(growth_2x::next_capacity(0, 1, 4), 4u);
+        EXPECT_EQ(growth_2x::next_capacity(8, 9, 4), 16u);
+        EXPECT_EQ(growth_2x::next_capacity(8, 100, 4), 100u);
+        EXPECT_EQ(growth_1_5x::next_capacity(8, 9, 4), 12u);
+        EXPECT_EQ(growth_page::next_capacity(8, 9, 4), 16u);
+        EXPECT_EQ(growth_page::next_capacity(1000, 1001, 8), 2048u); // 16000 字节 -> 16384
+
+        vector<int, alloc<int>, 0, growth_1_5x> v;
+        size_t reallocs = 0, cap = v.capacity();
+        for (int i = 0; i < 10000; ++i)
+        {
+            v.push_back(i);
+            if (v.capacity() != cap)
+                ++reallocs, cap = v.capacity();
+        }
+        EXPECT_LT(reallocs, 30u);
+        EXPECT_EQ(v[9999], 9999);
+
+        // 连续 append 为均摊 O(1)：扩容次数为对数级
+        string s;
+        reallocs = 0, cap = s.capacity();
+        for (int i = 0; i < 10000; ++i)
+        {
+            s.append("abc");
+            if (s.capacity() != cap)
+                ++reallocs, cap = s.capacity();
+        }
+        EXPECT_EQ(s.size(), 30000u);
+        EXPECT_LT(reallocs, 20u);
+        basic_string<char, char_traits<char>, alloc<char>, growth_page> p;
+        p.resize_uninitialized(5000);
+        EXPECT_EQ(p.capacity() % PAGE_BYTES, PAGE_BYTES - 1); // 扣除终止符
+    }
 }
\ No newline at end of file
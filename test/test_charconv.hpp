@@ -0,0 +1,300 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+#include "../algorithm/charconv.hpp"
+#include "../container/string.hpp"
+
+namespace zstl
+{
+    // 与 std::to_chars 逐字节一致，并能解析回原值
+    template <typename T>
+    void expect_integer_round_trip(T v, int base)
+    {
+        char a[80], b[80];
+        to_chars_result r1 = to_chars(a, a + sizeof(a), v, base);
+        std::to_chars_result r2 = std::to_chars(b, b + sizeof(b), v, base);
+        ASSERT_EQ(r1.ec, std::errc());
+        ASSERT_EQ(std::string(a, r1.ptr), std::string(b, r2.ptr));
+        T back = 0;
+        from_chars_result p = from_chars(a, r1.ptr, back, base);
+        ASSERT_EQ(p.ec, std::errc());
+        ASSERT_EQ(p.ptr, r1.ptr);
+        ASSERT_EQ(back, v);
+    }
+
+    template <typename T>
+    void expect_integer_type(uint64_t seed)
+    {
+        auto next = [&seed]
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            return seed;
+        };
+        expect_integer_round_trip(std::numeric_limits<T>::min(), 10);
+        expect_integer_round_trip(std::numeric_limits<T>::max(), 10);
+        expect_integer_round_trip(std::numeric_limits<T>::min(), 2);
+        expect_integer_round_trip(T(0), 10);
+        for (int i = 0; i < 20000; ++i)
+        {
+            T v = static_cast<T>(next() >> (next() % 64));
+            expect_integer_round_trip(v, i % 4 ? 10 : 2 + static_cast<int>(next() % 35));
+        }
+    }
+
+    TEST(CharconvTest, IntegerMatchesStd)
+    {
+        expect_integer_type<signed char>(1);
+        expect_integer_type<unsigned char>(2);
+        expect_integer_type<short>(3);
+        expect_integer_type<unsigned short>(4);
+        expect_integer_type<int>(5);
+        expect_integer_type<unsigned>(6);
+        expect_integer_type<long long>(7);
+        expect_integer_type<unsigned long long>(8);
+
+        char buf[4];
+        to_chars_result r = to_chars(buf, buf + 3, 1234);
+        EXPECT_EQ(r.ec, std::errc::value_too_large);
+        EXPECT_EQ(r.ptr, buf + 3);
+        r = to_chars(buf, buf + 4, -255, 16);
+        EXPECT_EQ(std::string(buf, r.ptr), "-ff");
+    }
+
+    // 错误处理与 std::from_chars 相同：无数字、溢出、在首个非数字处停止
+    TEST(CharconvTest, IntegerParseErrors)
+    {
+        int v = 42;
+        const char *s = "12ab";
+        from_chars_result r = from_chars(s, s + 4, v);
+        EXPECT_EQ(r.ec, std::errc());
+        EXPECT_EQ(r.ptr, s + 2);
+        EXPECT_EQ(v, 12);
+
+        r = from_chars(s, s + 4, v, 16);
+        EXPECT_EQ(v, 0x12ab);
+
+        const char *bad[] = {"", "-", "+1", " 1", "x"};
+        for (const char *b : bad)
+        {
+            v = 42;
+            r = from_chars(b, b + std::strlen(b), v);
+            EXPECT_EQ(r.ec, std::errc::invalid_argument) << b;
+            EXPECT_EQ(r.ptr, b);
+            EXPECT_EQ(v, 42);
+        }
+
+        unsigned u = 7;
+        const char *neg = "-1";
+        EXPECT_EQ(from_chars(neg, neg + 2, u).ec, std::errc::invalid_argument);
+
+        const char *big = "2147483648;";
+        r = from_chars(big, big + 11, v);
+        EXPECT_EQ(r.ec, std::errc::result_out_of_range);
+        EXPECT_EQ(r.ptr, big + 10);
+        EXPECT_EQ(v, 42);
+        const char *min = "-2147483648";
+        r = from_chars(min, min + 11, v);
+        EXPECT_EQ(r.ec, std::errc());
+        EXPECT_EQ(v, std::numeric_limits<int>::min());
+
+        uint64_t w = 0;
+        const char *huge = "184467440737095516150000";
+        r = from_chars(huge, huge + std::strlen(huge), w);
+        EXPECT_EQ(r.ec, std::errc::result_out_of_range);
+        EXPECT_EQ(r.ptr, huge + std::strlen(huge));
+    }
+
+    template <typename F>
+    void expect_float_matches_std(F v)
+    {
+        char a[64], b[64];
+        to_chars_result r1 = to_chars(a, a + sizeof(a), v);
+        std::to_chars_result r2 = std::to_chars(b, b + sizeof(b), v);
+        ASSERT_EQ(std::string(a, r1.ptr), std::string(b, r2.ptr));
+        if (std::isnan(v))
+            return;
+        F back;
+        from_chars_result p = from_chars(a, r1.ptr, back);
+        ASSERT_EQ(p.ec, std::errc());
+        ASSERT_EQ(p.ptr, r1.ptr);
+        ASSERT_EQ(std::memcmp(&back, &v, sizeof(F)), 0) << std::string(a, r1.ptr);
+    }
+
+    // 最短往返表示：随机位模式、2 的幂及其前驱、边界值与 std::to_chars 逐字节一致
+    TEST(CharconvTest, FloatFormatMatchesStd)
+    {
+        uint64_t seed = 88172645463325252ull;
+        for (int i = 0; i < 200000; ++i)
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            double d;
+            std::memcpy(&d, &seed, sizeof(d));
+            expect_float_matches_std(d);
+            uint32_t bits = static_cast<uint32_t>(seed >> 16);
+            float f;
+            std::memcpy(&f, &bits, sizeof(f));
+            expect_float_matches_std(f);
+        }
+        for (int e = -1074; e < 1024; ++e)
+        {
+            expect_float_matches_std(std::ldexp(1.0, e));
+            expect_float_matches_std(std::nextafter(std::ldexp(1.0, e), 0.0));
+        }
+        for (int e = -149; e < 128; ++e)
+            expect_float_matches_std(std::ldexp(1.0f, e));
+        const double special[] = {0.0, -0.0, 1.0, 0.1, 0.3, 1e-5, 1e-4, 123456.0, 1e15, 1e16, 1e21, 1e22, 1e23,
+                                  5e-324, 2.2250738585072014e-308, 1.7976931348623157e308, 9007199254740993.0,
+                                  std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+                                  std::numeric_limits<double>::quiet_NaN()};
+        for (double d : special)
+        {
+            expect_float_matches_std(d);
+            expect_float_matches_std(static_cast<float>(d));
+        }
+
+        char buf[4];
+        EXPECT_EQ(to_chars(buf, buf + 4, 0.125).ec, std::errc::value_too_large);
+    }
+
+    template <typename F>
+    void expect_parse(const std::string &s, F expected, size_t consumed)
+    {
+        F v = F(7);
+        from_chars_result r = from_chars(s.data(), s.data() + s.size(), v);
+        ASSERT_EQ(r.ec, std::errc()) << s;
+        ASSERT_EQ(static_cast<size_t>(r.ptr - s.data()), consumed) << s;
+        ASSERT_EQ(std::memcmp(&v, &expected, sizeof(F)), 0) << s;
+    }
+
+    // 解析：超过 19 位有效数字的中点附近输入走精确比较；语法细节与 std::from_chars 一致
+    TEST(CharconvTest, FloatParse)
+    {
+        expect_parse(".5", 0.5, 2);
+        expect_parse("5.", 5.0, 2);
+        expect_parse("-0", -0.0, 2);
+        expect_parse("0e9999", 0.0, 6);
+        expect_parse("1e", 1.0, 1);
+        expect_parse("1e+", 1.0, 1);
+        expect_parse("1.5E3x", 1500.0, 5);
+        expect_parse("2.2250738585072011e-308", 2.2250738585072011e-308, 23);
+        expect_parse("4.9406564584124654e-324", 5e-324, 23);
+        expect_parse("2.4703282292062328e-324", 5e-324, 23);
+        expect_parse("1.7976931348623158e308", 1.7976931348623157e308, 22);
+        expect_parse("0.1f", 0.1f, 3);
+        expect_parse("3.4028235e38", 3.4028235e38f, 12);
+
+        // 2^53 + 1 恰在两个 double 之间：末尾的一个非零数字决定进位
+        std::string half = "9007199254740993";
+        expect_parse(half, 9007199254740992.0, half.size());
+        std::string above = half + std::string(900, '0') + "1e-901";
+        expect_parse(above, 9007199254740994.0, above.size());
+        std::string exact = half + std::string(900, '0') + "e-900";
+        expect_parse(exact, 9007199254740992.0, exact.size());
+
+        double inf = std::numeric_limits<double>::infinity();
+        expect_parse("inf", inf, 3);
+        expect_parse("-Infinity", -inf, 9);
+        expect_parse("infinit", inf, 3);
+        double n = 0;
+        const char *nan = "nan(abc_1)";
+        from_chars_result r = from_chars(nan, nan + 10, n);
+        EXPECT_EQ(r.ptr, nan + 10);
+        EXPECT_TRUE(std::isnan(n));
+
+        const char *bad[] = {"", ".", "-", "e5", "+1", "in"};
+        for (const char *b : bad)
+        {
+            double v = 7;
+            r = from_chars(b, b + std::strlen(b), v);
+            EXPECT_EQ(r.ec, std::errc::invalid_argument) << b;
+            EXPECT_EQ(r.ptr, b);
+            EXPECT_EQ(v, 7);
+        }
+        const char *range[] = {"1e400", "-1e309", "1e-400"};
+        for (const char *b : range)
+        {
+            double v = 7;
+            r = from_chars(b, b + std::strlen(b), v);
+            EXPECT_EQ(r.ec, std::errc::result_out_of_range) << b;
+            EXPECT_EQ(r.ptr, b + std::strlen(b));
+            EXPECT_EQ(v, 7);
+        }
+    }
+
+    // 与 std::from_chars 对比随机精度的 %e 输出及随机数字串
+    TEST(CharconvTest, FloatParseMatchesStd)
+    {
+        uint64_t seed = 0x9E3779B97F4A7C15ull;
+        auto next = [&seed]
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            return seed;
+        };
+        auto check = [](const std::string &s)
+        {
+            double a = 0, b = 0;
+            from_chars_result r1 = from_chars(s.data(), s.data() + s.size(), a);
+            std::from_chars_result r2 = std::from_chars(s.data(), s.data() + s.size(), b);
+            // 标准库对非规格化结果报告 out_of_range（沿用 strtod 的 ERANGE），此处只比较规格化结果
+            if (r2.ec != std::errc() || std::fpclassify(a) == FP_SUBNORMAL)
+                return;
+            ASSERT_EQ(r1.ec, std::errc()) << s;
+            ASSERT_EQ(r1.ptr, r2.ptr) << s;
+            ASSERT_EQ(std::memcmp(&a, &b, sizeof(a)), 0) << s;
+        };
+        char buf[64];
+        for (int i = 0; i < 50000; ++i)
+        {
+            uint64_t bits = next();
+            double d;
+            std::memcpy(&d, &bits, sizeof(d));
+            if (std::isnan(d) || std::isinf(d))
+                continue;
+            std::snprintf(buf, sizeof(buf), "%.*e", static_cast<int>(next() % 25), d);
+            check(buf);
+        }
+        for (int i = 0; i < 50000; ++i)
+        {
+            std::string s;
+            int n = 1 + static_cast<int>(next() % 40);
+            for (int j = 0; j < n; ++j)
+                s += static_cast<char>('0' + next() % 10);
+            if (next() % 2)
+                s.insert(next() % s.size(), ".");
+            if (next() % 2)
+                s += "e" + std::to_string(static_cast<int>(next() % 700) - 350);
+            check(s);
+        }
+    }
+
+    // to_string 与流输出
+    TEST(CharconvTest, ToStringAndStream)
+    {
+        EXPECT_EQ(to_string(0), string("0"));
+        EXPECT_EQ(to_string(-42), string("-42"));
+        EXPECT_EQ(to_string(std::numeric_limits<long long>::min()), string("-9223372036854775808"));
+        EXPECT_EQ(to_string(std::numeric_limits<unsigned long long>::max()), string("18446744073709551615"));
+        EXPECT_EQ(to_string(0.1), string("0.1"));
+        EXPECT_EQ(to_string(1e100), string("1e+100"));
+        EXPECT_EQ(to_string(-2.5f), string("-2.5"));
+        EXPECT_EQ(to_string(1.0 / 3), string("0.3333333333333333"));
+
+        std::ostringstream os;
+        string s("stream output longer than the short buffer");
+        os << s << '|' << string_view("view");
+        os.width(6);
+        os << string("ab");
+        EXPECT_EQ(os.str(), "stream output longer than the short buffer|view    ab");
+    }
+}
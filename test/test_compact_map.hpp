@@ -0,0 +1,109 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <map>
+#include "../container/map.hpp"
+#include "../container/set.hpp"
+#include "../container/string.hpp"
+namespace zstl
+{
+    // 测试夹具：为每个测试提供独立的 compact_map 实例
+    class CompactMapTest : public ::testing::Test
+    {
+    protected:
+        compact_map<int, string> m;
+    };
+
+    // 测试紧凑节点确实比普通节点小
+    TEST_F(CompactMapTest, NodeIsSmaller)
+    {
+        using value = std::pair<const int, int>;
+        EXPECT_LT(sizeof(RBCompactNode<value>), sizeof(RBNode<value>));
+        EXPECT_EQ(sizeof(RBCompactNode<value>), 3 * sizeof(void *) + sizeof(value));
+    }
+
+    // 测试颜色位与父指针互不干扰
+    TEST_F(CompactMapTest, ParentAndColorPacking)
+    {
+        RBCompactNode<int> a(1), b(2);
+        EXPECT_EQ(a.color(), Color::RED);
+        EXPECT_EQ(a.parent(), nullptr);
+        a.set_color(Color::BLACK);
+        a.set_parent(&b);
+        EXPECT_EQ(a.parent(), &b);
+        EXPECT_EQ(a.color(), Color::BLACK);
+        a.set_color(Color::RED);
+        EXPECT_EQ(a.parent(), &b);
+        EXPECT_EQ(a.color(), Color::RED);
+        a.set_parent(nullptr);
+        EXPECT_EQ(a.color(), Color::RED);
+    }
+
+    // 测试基本的插入、查找、删除与有序遍历
+    TEST_F(CompactMapTest, BasicOperations)
+    {
+        m[3] = "three";
+        m[1] = "one";
+        m[2] = "two";
+        EXPECT_EQ(m.size(), 3);
+        EXPECT_EQ(m.find(2)->second, "two");
+        EXPECT_EQ(m.erase(1), 1);
+        EXPECT_EQ(m.begin()->first, 2);
+        EXPECT_EQ((--m.end())->first, 3);
+    }
+
+    // 测试随机操作下与 std::map 对照，覆盖旋转与删除调整
+    TEST_F(CompactMapTest, RandomAgainstStdMap)
+    {
+        unsigned seed = 2024;
+        auto gen = [&seed]
+        {
+            seed = seed * 1103515245u + 12345u;
+            return (seed >> 16) & 0x7fff;
+        };
+        std::map<int, int> ref;
+        compact_map<int, int> cm;
+        for (int i = 0; i < 5000; ++i)
+        {
+            int k = gen() % 800;
+            if (gen() % 3 == 0)
+            {
+                EXPECT_EQ(cm.erase(k), ref.erase(k));
+            }
+            else
+            {
+                cm.insert({k, i});
+                ref.insert({k, i});
+            }
+        }
+        ASSERT_EQ(cm.size(), ref.size());
+        auto it = cm.begin();
+        for (auto &kv : ref)
+        {
+            ASSERT_NE(it, cm.end());
+            EXPECT_EQ(it->first, kv.first);
+            EXPECT_EQ(it->second, kv.second);
+            ++it;
+        }
+        // 拷贝后的树结构同样有效
+        compact_map<int, int> copy(cm);
+        EXPECT_EQ(copy.size(), cm.size());
+        EXPECT_EQ(copy.begin()->first, ref.begin()->first);
+    }
+
+    // 测试紧凑布局与子树大小增强组合使用
+    TEST(CompactSetTest, CombinedWithSizeAugment)
+    {
+        assoc_tree<int, tree_null_type, zstl::less<int>, alloc<int>, true, RBSizeAugment, true> s;
+        for (int i = 0; i < 100; ++i)
+            s.insert(99 - i);
+        for (int i = 0; i < 100; i += 2)
+            s.erase(i);
+        EXPECT_EQ(s.size(), 50);
+        EXPECT_EQ(*s.nth_element_at(10), 21);
+        EXPECT_EQ(s.rank(21), 10);
+
+        compact_multiset<int> ms = {3, 1, 3, 2};
+        EXPECT_EQ(ms.count(3), 2);
+        EXPECT_EQ(*ms.begin(), 1);
+    }
+}
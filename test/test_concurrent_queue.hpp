@@ -0,0 +1,129 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "../container/concurrent_queue.hpp"
+#include "../container/string.hpp"
+namespace zstl
+{
+    // 单线程下的满、空与容量取整
+    TEST(SpscQueueTest, TryPushPop)
+    {
+        spsc_queue<int> q(3);
+        EXPECT_EQ(q.capacity(), 4u);
+        EXPECT_TRUE(q.empty());
+        for (int i = 0; i < 4; ++i)
+            EXPECT_TRUE(q.try_push(i));
+        EXPECT_FALSE(q.try_push(4));
+        EXPECT_EQ(q.size_approx(), 4u);
+        int v = -1;
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(q.try_pop(v));
+            EXPECT_EQ(v, i);
+        }
+        EXPECT_FALSE(q.try_pop(v));
+    }
+
+    // 批量接口返回实际个数，跨越存储末尾回绕
+    TEST(SpscQueueTest, Batch)
+    {
+        spsc_queue<int> q(8);
+        int in[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        int out[11] = {};
+        EXPECT_EQ(q.try_push_batch(in, 5), 5u);
+        EXPECT_EQ(q.try_pop_batch(out, 3), 3u);
+        EXPECT_EQ(q.try_push_batch(in + 5, 5), 5u);
+        EXPECT_EQ(q.try_push_batch(in, 10), 1u);
+        EXPECT_EQ(q.try_pop_batch(out + 3, 10), 8u);
+        for (int i = 0; i < 10; ++i)
+            EXPECT_EQ(out[i], i);
+        EXPECT_EQ(out[10], 0);
+        EXPECT_EQ(q.try_pop_batch(out, 4), 0u);
+    }
+
+    // 析构时销毁残留元素
+    TEST(SpscQueueTest, DestroysRemaining)
+    {
+        spsc_queue<string> q(4);
+        q.try_push(string("left"));
+        q.try_emplace("over");
+        string s;
+        EXPECT_TRUE(q.try_pop(s));
+        EXPECT_EQ(s, string("left"));
+    }
+
+    // 小容量下阻塞 push / pop，消费者按顺序收到全部元素
+    TEST(SpscQueueTest, BlockingProducerConsumer)
+    {
+        constexpr int n = 200000;
+        spsc_queue<int> q(16);
+        std::thread producer([&q]
+                             {
+            for (int i = 0; i < n; ++i)
+                q.push(i); });
+        bool ordered = true;
+        for (int i = 0; i < n; ++i)
+        {
+            int v;
+            q.pop(v);
+            ordered = ordered && v == i;
+        }
+        producer.join();
+        EXPECT_TRUE(ordered);
+        EXPECT_TRUE(q.empty());
+    }
+
+    TEST(MpmcQueueTest, TryPushPop)
+    {
+        mpmc_queue<string> q(4);
+        EXPECT_EQ(q.capacity(), 4u);
+        for (int i = 0; i < 4; ++i)
+            EXPECT_TRUE(q.try_emplace("x"));
+        EXPECT_FALSE(q.try_push(string("y")));
+        string s;
+        EXPECT_TRUE(q.try_pop(s));
+        EXPECT_EQ(s, string("x"));
+        string batch[4];
+        EXPECT_EQ(q.try_pop_batch(batch, 4), 3u);
+        EXPECT_FALSE(q.try_pop(s));
+        EXPECT_TRUE(q.try_push(string("z")));
+        EXPECT_EQ(q.try_push_batch(batch, 4), 3u);
+        EXPECT_EQ(q.size_approx(), 4u);
+        EXPECT_TRUE(q.try_pop(s));
+        EXPECT_EQ(s, string("z"));
+    }
+
+    // 多生产者多消费者：每个元素恰好被取出一次
+    TEST(MpmcQueueTest, ConcurrentProducersConsumers)
+    {
+        constexpr int producers = 3, consumers = 3, per_producer = 50000;
+        mpmc_queue<int> q(64);
+        std::vector<std::thread> threads;
+        std::atomic<long long> sum{0};
+        std::atomic<int> received{0};
+        for (int p = 0; p < producers; ++p)
+            threads.emplace_back([&q, p]
+                                 {
+                for (int i = 0; i < per_producer; ++i)
+                    q.push(p * per_producer + i); });
+        for (int c = 0; c < consumers; ++c)
+            threads.emplace_back([&]
+                                 {
+                long long local = 0;
+                for (int i = 0; i < producers * per_producer / consumers; ++i)
+                {
+                    int v;
+                    q.pop(v);
+                    local += v;
+                }
+                sum += local;
+                received += producers * per_producer / consumers; });
+        for (auto &t : threads)
+            t.join();
+        long long total = static_cast<long long>(producers) * per_producer;
+        EXPECT_EQ(received.load(), total);
+        EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+        EXPECT_TRUE(q.empty());
+    }
+}
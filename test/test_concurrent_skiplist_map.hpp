@@ -0,0 +1,147 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "../container/concurrent_skiplist_map.hpp"
+#include "../container/string.hpp"
+namespace zstl
+{
+    // 测试夹具：为每个测试提供独立的并发跳表实例
+    class ConcurrentSkipListMapTest : public ::testing::Test
+    {
+    protected:
+        concurrent_skiplist_map<int, string> m;
+    };
+
+    // 测试默认构造后容器应为空
+    TEST_F(ConcurrentSkipListMapTest, InitiallyEmpty)
+    {
+        EXPECT_TRUE(m.empty());
+        EXPECT_EQ(m.size(), 0);
+        EXPECT_EQ(m.begin(), m.end());
+        EXPECT_EQ(m.find(1), m.end());
+    }
+
+    // 测试插入、重复插入与查找
+    TEST_F(ConcurrentSkipListMapTest, InsertAndFind)
+    {
+        auto p = m.insert({2, "two"});
+        EXPECT_TRUE(p.second);
+        EXPECT_EQ(p.first->first, 2);
+        EXPECT_EQ(p.first->second, "two");
+
+        auto p2 = m.emplace(2, "TWO");
+        EXPECT_FALSE(p2.second);
+        EXPECT_EQ(p2.first->second, "two");
+
+        EXPECT_TRUE(m.contains(2));
+        EXPECT_FALSE(m.contains(3));
+        EXPECT_EQ(m.find(2)->second, "two");
+        EXPECT_EQ(m.size(), 1);
+    }
+
+    // 测试有序遍历、lower_bound 与范围扫描
+    TEST_F(ConcurrentSkipListMapTest, OrderedIterationAndRange)
+    {
+        for (int v : {50, 10, 40, 20, 30})
+            m.emplace(v, "v");
+        int expect = 10;
+        for (auto &kv : m)
+        {
+            EXPECT_EQ(kv.first, expect);
+            expect += 10;
+        }
+        EXPECT_EQ(expect, 60);
+
+        EXPECT_EQ(m.lower_bound(25)->first, 30);
+        EXPECT_EQ(m.lower_bound(30)->first, 30);
+        EXPECT_EQ(m.lower_bound(51), m.end());
+
+        int sum = 0;
+        size_t n = m.for_each_range(20, 50, [&](const std::pair<const int, string> &kv)
+                                    { sum += kv.first; });
+        EXPECT_EQ(n, 3);
+        EXPECT_EQ(sum, 90);
+    }
+
+    // 测试删除
+    TEST_F(ConcurrentSkipListMapTest, Erase)
+    {
+        for (int i = 0; i < 100; ++i)
+            m.emplace(i, "v");
+        for (int i = 0; i < 100; i += 2)
+            EXPECT_EQ(m.erase(i), 1);
+        EXPECT_EQ(m.erase(0), 0);
+        EXPECT_EQ(m.size(), 50);
+        int expect = 1;
+        for (auto it = m.begin(); it != m.end(); ++it)
+        {
+            EXPECT_EQ(it->first, expect);
+            expect += 2;
+        }
+    }
+
+    // 测试迭代器存活期间被删除的节点仍可安全访问
+    TEST_F(ConcurrentSkipListMapTest, IteratorOutlivesErase)
+    {
+        m.emplace(1, "one");
+        m.emplace(2, "two");
+        m.emplace(3, "three");
+        auto it = m.find(2);
+        EXPECT_EQ(m.erase(2), 1);
+        // 节点已摘除但尚未回收
+        EXPECT_EQ(it->second, "two");
+        ++it;
+        EXPECT_EQ(it->first, 3);
+    }
+
+    // 测试多线程并发插入、删除与读取
+    TEST(ConcurrentSkipListMapStressTest, ConcurrentInsertEraseFind)
+    {
+        concurrent_skiplist_map<int, int> cm;
+        constexpr int THREADS = 4;
+        constexpr int PER_THREAD = 2000;
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < THREADS; ++t)
+        {
+            workers.emplace_back([&cm, t]
+                                 {
+                // 每个线程插入交错的键，并删除其中一半
+                for (int i = 0; i < PER_THREAD; ++i)
+                    cm.emplace(i * THREADS + t, i);
+                for (int i = 0; i < PER_THREAD; i += 2)
+                    cm.erase(i * THREADS + t);
+                // 同时查找其他线程的键
+                for (int i = 0; i < PER_THREAD; ++i)
+                    cm.contains(i * THREADS + (t + 1) % THREADS); });
+        }
+        // 读线程持续遍历，验证有序性
+        std::thread reader([&cm]
+                           {
+            for (int round = 0; round < 20; ++round)
+            {
+                int prev = -1;
+                for (auto &kv : cm)
+                {
+                    EXPECT_LT(prev, kv.first);
+                    prev = kv.first;
+                }
+            } });
+        for (auto &w : workers)
+            w.join();
+        reader.join();
+
+        EXPECT_EQ(cm.size(), THREADS * PER_THREAD / 2);
+        size_t count = 0;
+        int prev = -1;
+        for (auto &kv : cm)
+        {
+            EXPECT_LT(prev, kv.first);
+            EXPECT_EQ((kv.first / THREADS) % 2, 1);
+            prev = kv.first;
+            ++count;
+        }
+        EXPECT_EQ(count, THREADS * PER_THREAD / 2);
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <gtest/gtest.h>
 #include "../container/deque.hpp"
+#include "../algorithm/numeric.hpp"
 
 namespace zstl
 {
@@ -230,4 +231,218 @@ namespace zstl
         EXPECT_EQ(d.back(), 42);
         EXPECT_EQ(d.size(), 1);
     }
+
+    // 测试分段算法：区间跨越多个缓冲区，首尾落在缓冲区中间
+    TEST_F(DequeTest, SegmentedAlgorithms)
+    {
+        for (int i = 0; i < 1000; ++i)
+            d.push_back(i);
+        for (int i = 1; i <= 7; ++i)
+            d.push_front(-i);
+        static_assert(is_segmented_iterator_v<deque<int>::iterator>);
+        static_assert(is_segmented_iterator_v<deque<int>::const_iterator>);
+
+        // accumulate / count 与逐个遍历一致
+        long long expect = 0;
+        for (size_t i = 3; i < 990; ++i)
+            expect += d[i];
+        EXPECT_EQ(zstl::accumulate(d.begin() + 3, d.begin() + 990, 0LL), expect);
+        const deque<int> &cd = d;
+        EXPECT_EQ(zstl::accumulate(cd.begin(), cd.end(), 0LL), 499500LL - 28);
+        EXPECT_EQ(zstl::count(d.begin(), d.end(), 500), 1);
+
+        // deque -> 指针
+        int out[1007];
+        int *e = zstl::copy(d.begin(), d.end(), out);
+        EXPECT_EQ(e, out + 1007);
+        for (int i = 0; i < 1007; ++i)
+            EXPECT_EQ(out[i], d[i]);
+
+        // 指针 -> deque（目标从缓冲区中间开始）
+        for (int i = 0; i < 1007; ++i)
+            out[i] = i * 3;
+        auto it = zstl::copy(out, out + 500, d.begin() + 11);
+        EXPECT_EQ(it - d.begin(), 511);
+        for (int i = 0; i < 500; ++i)
+            EXPECT_EQ(d[11 + i], i * 3);
+        EXPECT_EQ(d[10], 3);
+        EXPECT_EQ(d[511], 504);
+
+        // deque -> deque（两端都是分段迭代器，段边界不对齐）
+        deque<int> other(600, 0);
+        auto oit = zstl::copy(d.begin() + 5, d.begin() + 605, other.begin());
+        EXPECT_TRUE(oit == other.end());
+        for (int i = 0; i < 600; ++i)
+            EXPECT_EQ(other[i], d[5 + i]);
+
+        // 目标尾后恰在缓冲区末尾：返回值应与 end() 相等
+        constexpr size_t buf = deque<int>::buffer_size;
+        deque<int> exact(buf * 2, 0);
+        auto eit = zstl::copy(out, out + buf * 2, exact.begin());
+        EXPECT_TRUE(eit == exact.end());
+        EXPECT_EQ(exact.back(), int(buf * 2 - 1) * 3);
+        auto tail = zstl::copy(out, out + buf - 3, exact.begin() + buf + 3);
+        EXPECT_TRUE(tail == exact.end());
+        EXPECT_EQ(exact[buf + 3], 0);
+
+        // fill / fill_n
+        zstl::fill(d.begin() + 20, d.begin() + 700, 7);
+        zstl::fill_n(d.begin() + 700, 5, 8);
+        EXPECT_EQ(d[19], out[8]);
+        EXPECT_EQ(zstl::count(d.begin(), d.end(), 7), 680);
+        EXPECT_EQ(zstl::count(d.begin(), d.end(), 8), 5);
+        EXPECT_EQ(d[705], 698);
+
+        // 空区间
+        EXPECT_EQ(zstl::accumulate(d.begin() + 9, d.begin() + 9, 0), 0);
+    }
+
+    // 缓冲区按字节数折算元素个数，大元素至少 1 个
+    struct DequeBigElem
+    {
+        char bytes[1000];
+        int id;
+    };
+
+    TEST_F(DequeTest, BufferSizedInBytes)
+    {
+        static_assert(deque<char>::buffer_size == DEQUE_BUFFER_BYTES);
+        static_assert(deque<int>::buffer_size == DEQUE_BUFFER_BYTES / sizeof(int));
+        static_assert(deque<DequeBigElem>::buffer_size == 1);
+        static_assert(deque<int, alloc<int>, 4096>::buffer_size == 1024);
+
+        deque<char> dc;
+        for (int i = 0; i < 2000; ++i)
+            dc.push_back(static_cast<char>(i));
+        for (int i = 0; i < 2000; ++i)
+            ASSERT_EQ(dc[i], static_cast<char>(i));
+
+        // 每个元素独占一个缓冲区，迭代器跨段仍正确
+        deque<DequeBigElem> db;
+        for (int i = 0; i < 50; ++i)
+        {
+            db.push_back(DequeBigElem{});
+            db.back().id = i;
+            db.push_front(DequeBigElem{});
+            db.front().id = -i - 1;
+        }
+        EXPECT_EQ(db.end() - db.begin(), 100);
+        EXPECT_EQ(db[0].id, -50);
+        EXPECT_EQ(db[99].id, 49);
+        EXPECT_EQ((db.begin() + 73)->id, 23);
+        EXPECT_EQ((db.end() - 27)->id, 23);
+
+        // 自定义字节数的队列用法
+        deque<int, alloc<int>, 64> dq;
+        int next = 0, expect = 0;
+        for (int round = 0; round < 100; ++round)
+        {
+            for (int k = 0; k < 7; ++k)
+                dq.push_back(next++);
+            for (int k = 0; k < 5; ++k)
+            {
+                ASSERT_EQ(dq.front(), expect++);
+                dq.pop_front();
+            }
+        }
+        EXPECT_EQ(dq.size(), 200u);
+        EXPECT_EQ(zstl::accumulate(dq.begin(), dq.end(), 0LL), (long long)(expect + next - 1) * 200 / 2);
+    }
+
+    template <typename T>
+    struct DequeCountingAlloc : alloc<T>
+    {
+        static inline int allocations = 0;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = DequeCountingAlloc<U>;
+        };
+
+        DequeCountingAlloc() = default;
+        template <typename U>
+        DequeCountingAlloc(const DequeCountingAlloc<U> &) {}
+
+        static T *allocate(size_t n)
+        {
+            ++allocations;
+            return alloc<T>::allocate(n);
+        }
+    };
+
+    // 稳态队列：缓冲区与 map 槽位都被复用，不再分配
+    TEST_F(DequeTest, SteadyStateQueueDoesNotAllocate)
+    {
+        using Q = deque<int, DequeCountingAlloc<int>, 64>;
+        Q q;
+        int next = 0, expect = 0;
+        for (int i = 0; i < 100; ++i)
+            q.push_back(next++);
+        for (int i = 0; i < 10000; ++i)
+        {
+            q.push_back(next++);
+            ASSERT_EQ(q.front(), expect++);
+            q.pop_front();
+        }
+        int warm = DequeCountingAlloc<int>::allocations;
+        for (int i = 0; i < 100000; ++i)
+        {
+            q.push_back(next++);
+            ASSERT_EQ(q.front(), expect++);
+            q.pop_front();
+        }
+        EXPECT_EQ(DequeCountingAlloc<int>::allocations, warm);
+
+        // 反方向同样复用
+        for (int i = 0; i < 100000; ++i)
+        {
+            q.push_front(--expect);
+            q.pop_back();
+        }
+        EXPECT_EQ(DequeCountingAlloc<int>::allocations, warm);
+        EXPECT_EQ(q.size(), 100u);
+        for (size_t i = 0; i < q.size(); ++i)
+            ASSERT_EQ(q[i], expect + static_cast<int>(i));
+    }
+
+    // pop / erase / clear 会析构元素
+    struct DequeLive
+    {
+        static inline int live = 0;
+        int v;
+        DequeLive(int x = 0) : v(x) { ++live; }
+        DequeLive(const DequeLive &o) : v(o.v) { ++live; }
+        DequeLive &operator=(const DequeLive &) = default;
+        ~DequeLive() { --live; }
+    };
+
+    TEST_F(DequeTest, PopAndEraseDestroyElements)
+    {
+        DequeLive::live = 0;
+        {
+            deque<DequeLive> dl;
+            for (int i = 0; i < 300; ++i)
+                dl.push_back(DequeLive(i));
+            EXPECT_EQ(DequeLive::live, 300);
+            for (int i = 0; i < 100; ++i)
+                dl.pop_front();
+            for (int i = 0; i < 50; ++i)
+                dl.pop_back();
+            EXPECT_EQ(DequeLive::live, 150);
+            dl.erase(dl.begin() + 10);
+            dl.erase(dl.end() - 10);
+            EXPECT_EQ(DequeLive::live, 148);
+            EXPECT_EQ(dl.front().v, 100);
+            EXPECT_EQ(dl[10].v, 111);
+            EXPECT_EQ(dl.back().v, 249);
+            deque<DequeLive> copy(dl);
+            EXPECT_EQ(DequeLive::live, 296);
+            copy.clear();
+            EXPECT_EQ(DequeLive::live, 148);
+            copy.push_back(DequeLive(1));
+            EXPECT_EQ(copy.size(), 1u);
+        }
+        EXPECT_EQ(DequeLive::live, 0);
+    }
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 #include "../container/forward_list.hpp"
 #include <gtest/gtest.h>
+#include <utility>
+#include <vector>
 namespace zstl
 {
     // 对空列表进行基本属性测试
@@ -173,4 +175,70 @@ namespace zstl
         ++it;
         EXPECT_EQ(*it, 2);
     }
-}
\ No newline at end of file
+
+    template <typename T>
+    std::vector<T> forward_list_values(const forward_list<T> &l)
+    {
+        std::vector<T> v;
+        for (auto it = l.begin(); it != l.end(); ++it)
+            v.push_back(*it);
+        return v;
+    }
+
+    TEST(ForwardListTest, SortAndMerge)
+    {
+        forward_list<std::pair<int, int>> l;
+        for (int i = 0; i < 500; ++i)
+            l.push_front({(i * 37) % 11, i});
+        const std::pair<int, int> *first = &l.front();
+        l.sort([](const std::pair<int, int> &a, const std::pair<int, int> &b)
+               { return a.first < b.first; });
+        auto v = forward_list_values(l);
+        EXPECT_EQ(v.size(), 500u);
+        for (size_t i = 1; i < v.size(); ++i)
+        {
+            ASSERT_LE(v[i - 1].first, v[i].first);
+            if (v[i - 1].first == v[i].first)
+                ASSERT_GT(v[i - 1].second, v[i].second); // push_front 逆序插入，稳定排序保持该次序
+        }
+        bool found = false;
+        for (auto &p : l)
+            found |= &p == first;
+        EXPECT_TRUE(found);
+
+        forward_list<int> a = {1, 4, 6};
+        forward_list<int> b = {2, 4, 5, 9};
+        a.merge(b);
+        EXPECT_EQ(forward_list_values(a), (std::vector<int>{1, 2, 4, 4, 5, 6, 9}));
+        EXPECT_TRUE(b.empty());
+        a.reverse();
+        EXPECT_EQ(forward_list_values(a), (std::vector<int>{9, 6, 5, 4, 4, 2, 1}));
+        EXPECT_EQ(a.unique(), 1u);
+        EXPECT_EQ(a.remove_if([](int x)
+                              { return x > 5; }),
+                  2u);
+        EXPECT_EQ(a.remove(a.front()), 1u);
+        EXPECT_EQ(forward_list_values(a), (std::vector<int>{4, 2, 1}));
+    }
+
+    TEST(ForwardListTest, SpliceAfter)
+    {
+        forward_list<int> a = {1, 2, 3};
+        forward_list<int> b = {10, 20, 30, 40};
+        a.splice_after(a.before_begin(), b, b.begin()); // 移动 20
+        EXPECT_EQ(forward_list_values(a), (std::vector<int>{20, 1, 2, 3}));
+        EXPECT_EQ(forward_list_values(b), (std::vector<int>{10, 30, 40}));
+
+        a.splice_after(a.begin(), b, b.before_begin(), ++b.begin()); // 移动 (before_begin, 30) 即 10
+        EXPECT_EQ(forward_list_values(a), (std::vector<int>{20, 10, 1, 2, 3}));
+        EXPECT_EQ(forward_list_values(b), (std::vector<int>{30, 40}));
+
+        a.splice_after(a.before_begin(), b);
+        EXPECT_EQ(forward_list_values(a), (std::vector<int>{30, 40, 20, 10, 1, 2, 3}));
+        EXPECT_TRUE(b.empty());
+
+        // 同一链表内移动
+        a.splice_after(a.before_begin(), a, ++a.begin());
+        EXPECT_EQ(forward_list_values(a), (std::vector<int>{20, 30, 40, 10, 1, 2, 3}));
+    }
+}
@@ -0,0 +1,137 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <set>
+#include <vector>
+#include "../container/intrusive_hash_set.hpp"
+#include "../container/intrusive_list.hpp"
+
+namespace zstl
+{
+    struct SessionIdTag;
+    struct SessionLruTag;
+
+    // 会话对象同时位于散列索引和 LRU 链表中
+    struct HashSession : intrusive_hash_hook<SessionIdTag>, intrusive_list_hook<SessionLruTag>
+    {
+        explicit HashSession(int id = 0) : id_(id) {}
+        int id_;
+    };
+
+    struct SessionHash
+    {
+        size_t operator()(const HashSession &s) const { return static_cast<size_t>(s.id_); }
+        size_t operator()(int id) const { return static_cast<size_t>(id); }
+    };
+
+    struct SessionEqual
+    {
+        bool operator()(const HashSession &a, const HashSession &b) const { return a.id_ == b.id_; }
+        bool operator()(int id, const HashSession &b) const { return id == b.id_; }
+    };
+
+    using session_index = intrusive_hash_set<HashSession, SessionHash, SessionEqual, SessionIdTag>;
+
+    TEST(IntrusiveHashSetTest, IndexAndLru)
+    {
+        std::vector<HashSession> sessions;
+        for (int i = 0; i < 1000; ++i)
+            sessions.emplace_back(i * 8); // 恒等散列、步长为 8 的键
+        session_index index;
+        intrusive_list<HashSession, SessionLruTag> lru;
+        index.reserve(sessions.size());
+        size_t buckets = index.bucket_count();
+        for (auto &s : sessions)
+        {
+            EXPECT_TRUE(index.insert_unique(s).second);
+            lru.push_back(s);
+        }
+        EXPECT_EQ(index.bucket_count(), buckets); // reserve 后插入不再扩容
+        EXPECT_EQ(index.size(), 1000u);
+        EXPECT_LE(index.load_factor(), 1.0f);
+
+        HashSession dup(16);
+        EXPECT_FALSE(index.insert_unique(dup).second);
+        EXPECT_FALSE(dup.intrusive_hash_hook<SessionIdTag>::is_linked());
+
+        // 按键查找并把会话移到 LRU 队尾
+        auto it = index.find(80);
+        ASSERT_NE(it, index.end());
+        EXPECT_EQ(&*it, &sessions[10]);
+        lru.splice(lru.end(), lru, lru.iterator_to(*it));
+        EXPECT_EQ(lru.back().id_, 80);
+        EXPECT_FALSE(index.contains(81));
+
+        // 淘汰队首：同时从两个容器摘下
+        for (int i = 0; i < 100; ++i)
+        {
+            HashSession &victim = lru.front();
+            lru.pop_front();
+            index.erase(victim);
+        }
+        EXPECT_EQ(index.size(), 900u);
+        EXPECT_EQ(lru.size(), 900u);
+        EXPECT_FALSE(index.contains(0));
+        EXPECT_TRUE(index.contains(80));
+
+        std::set<int> seen;
+        for (auto &s : index)
+            seen.insert(s.id_);
+        EXPECT_EQ(seen.size(), 900u);
+
+        lru.clear();
+        index.clear();
+        EXPECT_TRUE(index.empty());
+        EXPECT_EQ(index.begin(), index.end());
+        EXPECT_FALSE(sessions[500].intrusive_hash_hook<SessionIdTag>::is_linked());
+    }
+
+    TEST(IntrusiveHashSetTest, DuplicatesGrowthAndErase)
+    {
+        std::vector<HashSession> items;
+        for (int i = 0; i < 300; ++i)
+            items.emplace_back(i % 100);
+        session_index index;
+        for (auto &s : items)
+            index.insert_equal(s);
+        EXPECT_EQ(index.size(), 300u);
+        EXPECT_GE(index.bucket_count(), 300u);
+        EXPECT_EQ(index.count(42), 3u);
+
+        // 相等元素在遍历中相邻
+        std::vector<int> order;
+        for (auto &s : index)
+            order.push_back(s.id_);
+        for (size_t i = 0; i < order.size(); i += 3)
+        {
+            EXPECT_EQ(order[i], order[i + 1]);
+            EXPECT_EQ(order[i], order[i + 2]);
+        }
+
+        EXPECT_EQ(index.erase_key(42), 3u);
+        EXPECT_EQ(index.count(42), 0u);
+        EXPECT_FALSE(items[42].intrusive_hash_hook<SessionIdTag>::is_linked());
+
+        size_t removed = 0;
+        for (auto it = index.begin(); it != index.end();)
+        {
+            if (it->id_ % 2)
+            {
+                it = index.erase(it);
+                ++removed;
+            }
+            else
+                ++it;
+        }
+        EXPECT_EQ(removed, 150u);
+        EXPECT_EQ(index.size(), 147u);
+
+        session_index moved(std::move(index));
+        EXPECT_TRUE(index.empty());
+        EXPECT_EQ(moved.size(), 147u);
+        EXPECT_TRUE(moved.contains(10));
+        size_t disposed = 0;
+        moved.clear_and_dispose([&](HashSession *)
+                                { ++disposed; });
+        EXPECT_EQ(disposed, 147u);
+    }
+}
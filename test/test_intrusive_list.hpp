@@ -0,0 +1,104 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <vector>
+#include "../container/intrusive_list.hpp"
+
+namespace zstl
+{
+    struct IdleTag;
+    struct OwnerTag;
+
+    // 同一对象同时挂在两条链表上
+    struct ListConn : intrusive_list_hook<IdleTag>, intrusive_list_hook<OwnerTag>
+    {
+        explicit ListConn(int id = 0) : id_(id) {}
+        int id_;
+    };
+
+    template <typename L>
+    std::vector<int> intrusive_ids(const L &l)
+    {
+        std::vector<int> v;
+        for (auto &c : l)
+            v.push_back(c.id_);
+        return v;
+    }
+
+    TEST(IntrusiveListTest, LinksUserObjects)
+    {
+        ListConn conns[5] = {ListConn(0), ListConn(1), ListConn(2), ListConn(3), ListConn(4)};
+        intrusive_list<ListConn, IdleTag> idle;
+        intrusive_list<ListConn, OwnerTag> owner;
+        for (auto &c : conns)
+        {
+            idle.push_back(c);
+            owner.push_front(c);
+        }
+        EXPECT_EQ(idle.size(), 5u);
+        EXPECT_EQ(intrusive_ids(idle), (std::vector<int>{0, 1, 2, 3, 4}));
+        EXPECT_EQ(intrusive_ids(owner), (std::vector<int>{4, 3, 2, 1, 0}));
+        EXPECT_EQ(&idle.front(), &conns[0]);
+        EXPECT_EQ(&owner.front(), &conns[4]);
+
+        // 按对象 O(1) 摘下，不影响另一条链表
+        idle.erase(conns[2]);
+        EXPECT_FALSE(static_cast<intrusive_list_hook<IdleTag> &>(conns[2]).is_linked());
+        EXPECT_TRUE(static_cast<intrusive_list_hook<OwnerTag> &>(conns[2]).is_linked());
+        EXPECT_EQ(intrusive_ids(idle), (std::vector<int>{0, 1, 3, 4}));
+        EXPECT_EQ(owner.size(), 5u);
+
+        // LRU：移到队尾
+        idle.splice(idle.end(), idle, idle.iterator_to(conns[0]));
+        EXPECT_EQ(intrusive_ids(idle), (std::vector<int>{1, 3, 4, 0}));
+        EXPECT_EQ(idle.back().id_, 0);
+
+        std::vector<int> rev;
+        for (auto it = idle.rbegin(); it != idle.rend(); ++it)
+            rev.push_back(it->id_);
+        EXPECT_EQ(rev, (std::vector<int>{0, 4, 3, 1}));
+
+        idle.insert(idle.iterator_to(conns[3]), conns[2]);
+        EXPECT_EQ(intrusive_ids(idle), (std::vector<int>{1, 2, 3, 4, 0}));
+        idle.pop_front();
+        idle.pop_back();
+        EXPECT_EQ(intrusive_ids(idle), (std::vector<int>{2, 3, 4}));
+
+        std::vector<int> disposed;
+        owner.clear_and_dispose([&](ListConn *c)
+                                { disposed.push_back(c->id_); });
+        EXPECT_EQ(disposed, (std::vector<int>{4, 3, 2, 1, 0}));
+        EXPECT_TRUE(owner.empty());
+        EXPECT_FALSE(static_cast<intrusive_list_hook<OwnerTag> &>(conns[0]).is_linked());
+        idle.clear();
+        EXPECT_FALSE(static_cast<intrusive_list_hook<IdleTag> &>(conns[3]).is_linked());
+    }
+
+    TEST(IntrusiveListTest, MoveAndSwap)
+    {
+        ListConn conns[4] = {ListConn(0), ListConn(1), ListConn(2), ListConn(3)};
+        intrusive_list<ListConn, IdleTag> a, b;
+        a.push_back(conns[0]);
+        a.push_back(conns[1]);
+        b.push_back(conns[2]);
+
+        a.swap(b);
+        EXPECT_EQ(intrusive_ids(a), (std::vector<int>{2}));
+        EXPECT_EQ(intrusive_ids(b), (std::vector<int>{0, 1}));
+
+        intrusive_list<ListConn, IdleTag> c(std::move(b));
+        EXPECT_TRUE(b.empty());
+        EXPECT_EQ(intrusive_ids(c), (std::vector<int>{0, 1}));
+        c.push_back(conns[3]);
+        EXPECT_EQ(c.back().id_, 3);
+        EXPECT_EQ(&*--c.end(), &conns[3]);
+
+        // 整表 splice 与移动赋值
+        c.splice(c.begin(), a);
+        EXPECT_TRUE(a.empty());
+        EXPECT_EQ(intrusive_ids(c), (std::vector<int>{2, 0, 1, 3}));
+        a = std::move(c);
+        EXPECT_TRUE(c.empty());
+        EXPECT_EQ(a.size(), 4u);
+        EXPECT_EQ(intrusive_ids(a), (std::vector<int>{2, 0, 1, 3}));
+    }
+}
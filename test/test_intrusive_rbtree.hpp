@@ -0,0 +1,166 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <vector>
+#include "../container/intrusive_rbtree.hpp"
+
+namespace zstl
+{
+    struct DeadlineTag;
+
+    // 定时器：按到期时间排序，可直接按时间查找
+    struct TreeTimer : intrusive_rbtree_hook<DeadlineTag>
+    {
+        explicit TreeTimer(long deadline = 0, int id = 0) : deadline_(deadline), id_(id) {}
+        long deadline_;
+        int id_;
+    };
+
+    struct ByDeadline
+    {
+        bool operator()(const TreeTimer &a, const TreeTimer &b) const { return a.deadline_ < b.deadline_; }
+        bool operator()(long key, const TreeTimer &b) const { return key < b.deadline_; }
+        bool operator()(const TreeTimer &a, long key) const { return a.deadline_ < key; }
+    };
+
+    using timer_tree = intrusive_rbtree<TreeTimer, ByDeadline, DeadlineTag>;
+
+    // 检查红黑性质，返回黑高
+    inline int intrusive_black_height(const intrusive_rbtree_hook<DeadlineTag> *node)
+    {
+        if (!node)
+            return 1;
+        if (node->color() == Color::RED)
+        {
+            EXPECT_TRUE(!node->left_ || node->left_->color() == Color::BLACK);
+            EXPECT_TRUE(!node->right_ || node->right_->color() == Color::BLACK);
+        }
+        if (node->left_)
+            EXPECT_EQ(node->left_->parent(), node);
+        if (node->right_)
+            EXPECT_EQ(node->right_->parent(), node);
+        int l = intrusive_black_height(node->left_);
+        int r = intrusive_black_height(node->right_);
+        EXPECT_EQ(l, r);
+        return l + (node->color() == Color::BLACK);
+    }
+
+    inline void expect_valid_tree(timer_tree &t)
+    {
+        if (t.empty())
+            return;
+        const intrusive_rbtree_hook<DeadlineTag> *root = &t.front();
+        while (root->parent()->parent() != root)
+            root = root->parent();
+        EXPECT_EQ(root->color(), Color::BLACK);
+        intrusive_black_height(root);
+    }
+
+    TEST(IntrusiveRBTreeTest, RandomInsertEraseMatchesMultimap)
+    {
+        std::vector<std::unique_ptr<TreeTimer>> pool;
+        for (int i = 0; i < 2000; ++i)
+            pool.emplace_back(new TreeTimer(0, i));
+        timer_tree tree;
+        std::multimap<long, int> ref;
+        uint32_t x = 2463534242u;
+        auto next = [&x]
+        {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            return x;
+        };
+        for (int round = 0; round < 20000; ++round)
+        {
+            TreeTimer &t = *pool[next() % pool.size()];
+            if (t.is_linked())
+            {
+                auto range = ref.equal_range(t.deadline_);
+                for (auto it = range.first; it != range.second; ++it)
+                    if (it->second == t.id_)
+                    {
+                        ref.erase(it);
+                        break;
+                    }
+                tree.erase(t);
+                EXPECT_FALSE(t.is_linked());
+            }
+            else
+            {
+                t.deadline_ = static_cast<long>(next() % 500);
+                tree.insert_equal(t);
+                ref.emplace(t.deadline_, t.id_);
+            }
+        }
+        expect_valid_tree(tree);
+        ASSERT_EQ(tree.size(), ref.size());
+        auto it = ref.begin();
+        for (auto &t : tree)
+        {
+            ASSERT_EQ(t.deadline_, it->first);
+            ++it;
+        }
+        // 相等键按插入顺序排列，与 multimap 一致
+        it = ref.begin();
+        for (auto &t : tree)
+            ASSERT_EQ((it++)->second, t.id_);
+
+        // 按键查找
+        for (long k = 0; k < 500; k += 37)
+        {
+            EXPECT_EQ(tree.count(k), ref.count(k));
+            auto lb = tree.lower_bound(k);
+            auto rlb = ref.lower_bound(k);
+            if (rlb == ref.end())
+                EXPECT_EQ(lb, tree.end());
+            else
+                EXPECT_EQ(lb->deadline_, rlb->first);
+        }
+
+        size_t n = tree.size();
+        size_t disposed = 0;
+        tree.clear_and_dispose([&](TreeTimer *t)
+                               { EXPECT_FALSE(t->is_linked()); ++disposed; });
+        EXPECT_EQ(disposed, n);
+        EXPECT_TRUE(tree.empty());
+        EXPECT_EQ(tree.begin(), tree.end());
+    }
+
+    TEST(IntrusiveRBTreeTest, UniqueInsertFindAndMove)
+    {
+        TreeTimer timers[6] = {TreeTimer(50, 0), TreeTimer(10, 1), TreeTimer(30, 2),
+                               TreeTimer(30, 3), TreeTimer(70, 4), TreeTimer(20, 5)};
+        timer_tree tree;
+        for (auto &t : timers)
+            tree.insert_unique(t);
+        EXPECT_EQ(tree.size(), 5u);
+        EXPECT_FALSE(timers[3].is_linked());
+        EXPECT_EQ(tree.insert_unique(timers[3]).first->id_, 2);
+
+        EXPECT_EQ(tree.front().deadline_, 10);
+        EXPECT_EQ(tree.back().deadline_, 70);
+        EXPECT_EQ(tree.find(30L)->id_, 2);
+        EXPECT_EQ(tree.find(31L), tree.end());
+        EXPECT_EQ(tree.upper_bound(30L)->deadline_, 50);
+
+        // 到期处理：反复取最小元素
+        std::vector<long> order;
+        timer_tree moved(std::move(tree));
+        EXPECT_TRUE(tree.empty());
+        while (!moved.empty())
+        {
+            order.push_back(moved.front().deadline_);
+            moved.erase(moved.begin());
+            expect_valid_tree(moved);
+        }
+        EXPECT_EQ(order, (std::vector<long>{10, 20, 30, 50, 70}));
+
+        tree.insert_unique(timers[0]);
+        tree.insert_unique(timers[1]);
+        EXPECT_EQ(tree.erase_key(10L), 1u);
+        EXPECT_EQ((--tree.end())->id_, 0);
+        EXPECT_EQ(tree.rbegin()->id_, 0);
+    }
+}
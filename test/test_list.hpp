@@ -1,6 +1,9 @@
 #pragma once
 #include "gtest/gtest.h"
 #include "../container/list.hpp"
+#include <algorithm>
+#include <utility>
+#include <vector>
 namespace zstl
 {
     // 测试空链表的初始化，验证 size() 以及 begin() 与 end() 是否正确
@@ -291,4 +294,127 @@ namespace zstl
         EXPECT_EQ(l.back(), 42);
         EXPECT_EQ(l.size(), 1);
     }
+
+    // 把链表内容转成 vector 便于比较
+    template <typename L>
+    std::vector<int> list_values(const L &l)
+    {
+        std::vector<int> v;
+        for (auto it = l.begin(); it != l.end(); ++it)
+            v.push_back(*it);
+        return v;
+    }
+
+    // 排序只重接节点：元素地址不变，相等元素保持原有次序，正反向遍历一致
+    TEST(ListTest, SortRelinksNodesStably)
+    {
+        list<std::pair<int, int>> l;
+        uint32_t x = 12345;
+        for (int i = 0; i < 1000; ++i)
+        {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            l.emplace_back(static_cast<int>(x % 50), i);
+        }
+        std::vector<const std::pair<int, int> *> addrs;
+        for (auto &p : l)
+            addrs.push_back(&p);
+
+        l.sort([](const std::pair<int, int> &a, const std::pair<int, int> &b)
+               { return a.first < b.first; });
+        EXPECT_EQ(l.size(), 1000u);
+        auto prev = l.begin();
+        for (auto it = ++l.begin(); it != l.end(); ++it, ++prev)
+        {
+            ASSERT_LE(prev->first, it->first);
+            if (prev->first == it->first)
+                ASSERT_LT(prev->second, it->second);
+        }
+        std::vector<const std::pair<int, int> *> sorted_addrs;
+        for (auto &p : l)
+            sorted_addrs.push_back(&p);
+        std::sort(addrs.begin(), addrs.end());
+        std::sort(sorted_addrs.begin(), sorted_addrs.end());
+        EXPECT_EQ(addrs, sorted_addrs);
+
+        size_t n = 0;
+        for (auto it = l.rbegin(); it != l.rend(); ++it)
+            ++n;
+        EXPECT_EQ(n, 1000u);
+
+        list<int> small = {3, 1, 2};
+        small.sort();
+        EXPECT_EQ(list_values(small), (std::vector<int>{1, 2, 3}));
+        list<int> empty;
+        empty.sort();
+        EXPECT_TRUE(empty.empty());
+    }
+
+    TEST(ListTest, SpliceMovesNodes)
+    {
+        list<int> a = {1, 2, 3};
+        list<int> b = {10, 20, 30};
+        int *p20 = &*++b.begin();
+
+        // 单个节点跨链表移动，指针保持有效
+        a.splice(a.begin(), b, ++b.begin());
+        EXPECT_EQ(list_values(a), (std::vector<int>{20, 1, 2, 3}));
+        EXPECT_EQ(list_values(b), (std::vector<int>{10, 30}));
+        EXPECT_EQ(&a.front(), p20);
+        EXPECT_EQ(a.size(), 4u);
+        EXPECT_EQ(b.size(), 2u);
+
+        // 同一链表内移到队首 / 队尾（LRU 用法）
+        a.splice(a.begin(), a, --a.end());
+        EXPECT_EQ(list_values(a), (std::vector<int>{3, 20, 1, 2}));
+        a.splice(a.end(), a, a.begin());
+        EXPECT_EQ(list_values(a), (std::vector<int>{20, 1, 2, 3}));
+        a.splice(a.begin(), a, a.begin());
+        EXPECT_EQ(list_values(a), (std::vector<int>{20, 1, 2, 3}));
+        EXPECT_EQ(a.size(), 4u);
+
+        // 区间与整表
+        a.splice(a.end(), b, b.begin(), b.end());
+        EXPECT_EQ(list_values(a), (std::vector<int>{20, 1, 2, 3, 10, 30}));
+        EXPECT_TRUE(b.empty());
+        b.splice(b.end(), a);
+        EXPECT_EQ(b.size(), 6u);
+        EXPECT_TRUE(a.empty());
+        b.splice(b.begin(), b, ++b.begin(), --b.end());
+        EXPECT_EQ(list_values(b), (std::vector<int>{1, 2, 3, 10, 20, 30}));
+        EXPECT_EQ(b.back(), 30);
+    }
+
+    TEST(ListTest, MergeReverseUniqueRemove)
+    {
+        list<int> a = {1, 3, 5, 7};
+        list<int> b = {0, 2, 3, 8, 9};
+        a.merge(b);
+        EXPECT_EQ(list_values(a), (std::vector<int>{0, 1, 2, 3, 3, 5, 7, 8, 9}));
+        EXPECT_EQ(a.size(), 9u);
+        EXPECT_TRUE(b.empty());
+        EXPECT_EQ(a.back(), 9);
+
+        a.reverse();
+        EXPECT_EQ(list_values(a), (std::vector<int>{9, 8, 7, 5, 3, 3, 2, 1, 0}));
+        EXPECT_EQ(*--a.end(), 0);
+
+        EXPECT_EQ(a.unique(), 1u);
+        EXPECT_EQ(a.size(), 8u);
+        EXPECT_EQ(a.remove_if([](int v)
+                              { return v % 2 == 0; }),
+                  3u);
+        EXPECT_EQ(list_values(a), (std::vector<int>{9, 7, 5, 3, 1}));
+        // 参数引用被删元素本身
+        EXPECT_EQ(a.remove(a.front()), 1u);
+        EXPECT_EQ(list_values(a), (std::vector<int>{7, 5, 3, 1}));
+        EXPECT_EQ(a.size(), 4u);
+
+        list<int> c = {1, 2, 4, 5, 7};
+        EXPECT_EQ(c.unique([](int x, int y)
+                           { return y - x == 1; }),
+                  2u);
+        EXPECT_EQ(list_values(c), (std::vector<int>{1, 4, 7}));
+    }
 }
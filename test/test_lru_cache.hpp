@@ -0,0 +1,201 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "../container/lru_cache.hpp"
+
+namespace zstl
+{
+    TEST(LruCacheTest, EvictsLeastRecentlyUsed)
+    {
+        lru_cache<int, std::string> cache(3);
+        EXPECT_TRUE(cache.put(1, "one"));
+        cache.put(2, "two");
+        cache.put(3, "three");
+        ASSERT_NE(cache.get(1), nullptr); // 1 变为最近使用
+        cache.put(4, "four");             // 淘汰 2
+        EXPECT_FALSE(cache.contains(2));
+        EXPECT_EQ(*cache.get(1), "one");
+        EXPECT_EQ(cache.get(2), nullptr);
+        EXPECT_EQ(cache.size(), 3u);
+
+        std::vector<int> order;
+        cache.for_each([&](int k, const std::string &)
+                       { order.push_back(k); });
+        EXPECT_EQ(order, (std::vector<int>{1, 4, 3}));
+
+        // peek 不改变次序
+        EXPECT_EQ(*cache.peek(3), "three");
+        cache.put(1, "uno"); // 覆盖写入也算使用
+        cache.put(5, "five");
+        EXPECT_FALSE(cache.contains(3));
+        EXPECT_EQ(*cache.peek(1), "uno");
+
+        const cache_stats &s = cache.stats();
+        EXPECT_EQ(s.hits, 2u);
+        EXPECT_EQ(s.misses, 1u);
+        EXPECT_EQ(s.evictions, 2u);
+        EXPECT_DOUBLE_EQ(s.hit_rate(), 2.0 / 3);
+
+        EXPECT_TRUE(cache.erase(5));
+        EXPECT_FALSE(cache.erase(5));
+        cache.set_capacity(1);
+        EXPECT_EQ(cache.size(), 1u);
+        EXPECT_TRUE(cache.contains(1));
+        cache.clear();
+        EXPECT_TRUE(cache.empty());
+        EXPECT_EQ(cache.weight(), 0u);
+    }
+
+    struct StringBytes
+    {
+        size_t operator()(int, const std::string &v) const { return v.size(); }
+    };
+
+    TEST(LruCacheTest, WeightCapacityAndCallback)
+    {
+        lru_cache<int, std::string, hash<int>, equal_to<int>, StringBytes> cache(10);
+        std::vector<std::pair<int, std::string>> evicted;
+        cache.set_eviction_callback([&](const int &k, std::string &v)
+                                    { evicted.emplace_back(k, std::move(v)); });
+        cache.put(1, std::string(4, 'a'));
+        cache.put(2, std::string(4, 'b'));
+        EXPECT_EQ(cache.weight(), 8u);
+        cache.put(3, std::string(5, 'c')); // 需淘汰 1 才放得下
+        EXPECT_EQ(cache.weight(), 9u);
+        ASSERT_EQ(evicted.size(), 1u);
+        EXPECT_EQ(evicted[0].first, 1);
+        EXPECT_EQ(evicted[0].second, "aaaa");
+
+        // 单条超出容量：不缓存，已有旧值一并删除
+        EXPECT_FALSE(cache.put(2, std::string(11, 'x')));
+        EXPECT_FALSE(cache.contains(2));
+        EXPECT_EQ(cache.stats().rejections, 1u);
+        EXPECT_EQ(cache.weight(), 5u);
+
+        // 覆盖写入变重导致其它条目被淘汰
+        cache.put(4, std::string(3, 'd'));
+        cache.put(3, std::string(8, 'c'));
+        EXPECT_EQ(evicted.back().first, 4);
+        EXPECT_EQ(cache.weight(), 8u);
+        EXPECT_EQ(cache.size(), 1u);
+
+        cache.erase(3); // erase 不触发回调
+        EXPECT_EQ(evicted.size(), 2u);
+    }
+
+    TEST(TinyLfuCacheTest, FrequentKeysSurviveScan)
+    {
+        tinylfu_cache<int, int> cache(100);
+        // 热点：反复访问 0 ~ 49
+        for (int round = 0; round < 20; ++round)
+            for (int k = 0; k < 50; ++k)
+                if (!cache.get(k))
+                    cache.put(k, k);
+        EXPECT_GT(cache.frequency(7), cache.frequency(1000));
+        // 一次性扫描 5 倍容量的冷键
+        for (int k = 1000; k < 1500; ++k)
+            if (!cache.get(k))
+                cache.put(k, k);
+        EXPECT_LE(cache.weight(), 100u);
+        int hot = 0;
+        for (int k = 0; k < 50; ++k)
+            hot += cache.contains(k);
+        EXPECT_EQ(hot, 50);
+
+        // 同样的流量下 LRU 会被扫描冲掉
+        lru_cache<int, int> lru(100);
+        for (int round = 0; round < 20; ++round)
+            for (int k = 0; k < 50; ++k)
+                if (!lru.get(k))
+                    lru.put(k, k);
+        for (int k = 1000; k < 1500; ++k)
+            if (!lru.get(k))
+                lru.put(k, k);
+        EXPECT_FALSE(lru.contains(0));
+    }
+
+    // 缓存首次写满时草图不被重建，热点频率保留
+    TEST(TinyLfuCacheTest, SketchSurvivesFirstOverflow)
+    {
+        tinylfu_cache<int, int> cache(1024);
+        for (int round = 0; round < 20; ++round)
+            if (!cache.get(-1))
+                cache.put(-1, 0);
+        for (int k = 0; k < 1023; ++k)
+            cache.put(k, k);
+        EXPECT_EQ(cache.size(), 1024u);
+        unsigned before = cache.frequency(-1);
+        EXPECT_GE(before, 10u);
+        cache.put(5000, 0); // 超出容量的第一次写入
+        EXPECT_EQ(cache.frequency(-1), before);
+
+        // 按权重计时草图随条目数扩容，扩容前的计数同样保留
+        tinylfu_cache<int, std::string, hash<int>, equal_to<int>, StringBytes> weighted(1 << 20);
+        for (int round = 0; round < 12; ++round)
+            if (!weighted.get(-1))
+                weighted.put(-1, std::string("hot"));
+        unsigned hot = weighted.frequency(-1);
+        for (int k = 0; k < 5000; ++k)
+            weighted.put(k, std::string("v"));
+        EXPECT_GE(weighted.frequency(-1), hot / 2); // 扩容不清零；其间至多老化一次
+        EXPECT_GT(weighted.frequency(-1), 0u);
+    }
+
+    // 条目须放得进主区：容量 100 时主区为 99，权重 100 的条目直接拒绝而不是写入后立即淘汰
+    TEST(TinyLfuCacheTest, RejectsEntryHeavierThanMainArea)
+    {
+        tinylfu_cache<int, std::string, hash<int>, equal_to<int>, StringBytes> cache(100);
+        EXPECT_EQ(cache.max_entry_weight(), 99u);
+        EXPECT_FALSE(cache.put(1, std::string(100, 'x')));
+        EXPECT_FALSE(cache.contains(1));
+        EXPECT_EQ(cache.stats().rejections, 1u);
+        EXPECT_EQ(cache.stats().evictions, 0u);
+
+        EXPECT_TRUE(cache.put(2, std::string(99, 'y')));
+        EXPECT_TRUE(cache.contains(2));
+        EXPECT_FALSE(cache.put(2, std::string(100, 'z'))); // 覆盖成过重的值同样拒绝
+        EXPECT_FALSE(cache.contains(2));
+        EXPECT_EQ(cache.stats().rejections, 2u);
+        EXPECT_EQ(cache.weight(), 0u);
+
+        // 容量 1 时主区为空，条目留在窗口中
+        tinylfu_cache<int, int> tiny(1);
+        EXPECT_TRUE(tiny.put(1, 1));
+        EXPECT_TRUE(tiny.contains(1));
+    }
+
+    TEST(TinyLfuCacheTest, CapacityInvariantsUnderRandomLoad)
+    {
+        tinylfu_cache<int, int, hash<int>, equal_to<int>> cache(64);
+        size_t evicted = 0;
+        cache.set_eviction_callback([&](const int &k, int &v)
+                                    { EXPECT_EQ(k, v); ++evicted; });
+        uint32_t x = 88172645u;
+        size_t inserted = 0;
+        for (int i = 0; i < 50000; ++i)
+        {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            // 偏斜的键分布：低位键更常见
+            int k = static_cast<int>((x % 1000) * (x % 1000) / 1000);
+            if (!cache.get(k))
+            {
+                cache.put(k, k);
+                ++inserted;
+            }
+            ASSERT_LE(cache.size(), 64u);
+        }
+        EXPECT_EQ(cache.size(), 64u);
+        EXPECT_EQ(inserted - evicted, cache.size());
+        EXPECT_GT(cache.stats().hit_rate(), 0.1);
+
+        cache.set_capacity(10);
+        EXPECT_EQ(cache.size(), 10u);
+        EXPECT_EQ(inserted - evicted, 10u);
+        cache.clear();
+        EXPECT_TRUE(cache.empty());
+        EXPECT_EQ(cache.weight(), 0u);
+    }
+}
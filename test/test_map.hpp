@@ -2,6 +2,7 @@
 #include "../container/string.hpp"
 #include "../container/map.hpp"
 #include <gtest/gtest.h>
+#include <memory>
 namespace zstl
 {
     // 测试夹具：为每个测试提供独立的 map 实例
@@ -183,4 +184,84 @@ namespace zstl
         auto it = m.find(5);
         EXPECT_EQ(it, result.first);
     }
+
+    // 测试删除双子节点时只重链节点：其余迭代器与元素地址保持不变
+    TEST_F(MapTest, EraseKeepsOtherIteratorsValid)
+    {
+        for (int i = 0; i < 32; ++i)
+            m[i] = string(std::to_string(i).c_str());
+        // 记录所有元素的地址
+        const std::pair<const int, string> *addr[32];
+        for (int i = 0; i < 32; ++i)
+            addr[i] = &*m.find(i);
+
+        // 删除一批内部节点（大多有两个孩子）
+        for (int i = 1; i < 32; i += 2)
+        {
+            auto next = m.erase(m.find(i));
+            if (i + 1 < 32)
+                EXPECT_EQ(&*next, addr[i + 1]);
+        }
+        for (int i = 0; i < 32; i += 2)
+        {
+            auto it = m.find(i);
+            ASSERT_NE(it, m.end());
+            EXPECT_EQ(&*it, addr[i]);
+            EXPECT_EQ(it->second, string(std::to_string(i).c_str()));
+        }
+        EXPECT_EQ(m.size(), 16);
+    }
+
+    // 测试只可移动的映射值：删除不再需要拷贝/赋值元素
+    TEST_F(MapTest, EraseMoveOnlyValue)
+    {
+        map<int, std::unique_ptr<int>> mp;
+        for (int i = 0; i < 16; ++i)
+            mp.emplace(i, std::make_unique<int>(i * 10));
+        mp.erase(7);
+        mp.erase(mp.find(3), mp.find(12));
+        EXPECT_EQ(mp.size(), 7);
+        int expect[] = {0, 1, 2, 12, 13, 14, 15};
+        int idx = 0;
+        for (auto &kv : mp)
+        {
+            EXPECT_EQ(kv.first, expect[idx]);
+            EXPECT_EQ(*kv.second, expect[idx] * 10);
+            ++idx;
+        }
+    }
+
+    // 测试批量查找与批量存在性判断
+    TEST_F(MapTest, FindBatch)
+    {
+        map<int, int> mp;
+        for (int i = 0; i < 100; i += 2)
+            mp[i] = i * 10;
+        // 超过一组的键数，覆盖分组边界
+        int keys[37];
+        for (int i = 0; i < 37; ++i)
+            keys[i] = i * 3;
+        map<int, int>::iterator its[37];
+        bool found[37];
+        mp.find_batch(keys, 37, its);
+        mp.contains_batch(keys, 37, found);
+        for (int i = 0; i < 37; ++i)
+        {
+            bool expect = keys[i] % 2 == 0 && keys[i] < 100;
+            EXPECT_EQ(found[i], expect);
+            if (expect)
+            {
+                EXPECT_EQ(its[i]->first, keys[i]);
+                EXPECT_EQ(its[i]->second, keys[i] * 10);
+            }
+            else
+            {
+                EXPECT_EQ(its[i], mp.end());
+            }
+        }
+        // 空容器
+        map<int, int> empty_map;
+        empty_map.contains_batch(keys, 3, found);
+        EXPECT_FALSE(found[0] || found[1] || found[2]);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,147 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <map>
+#include "../container/map.hpp"
+#include "../container/string.hpp"
+namespace zstl
+{
+    // 测试夹具：为每个测试提供独立的 ranked_map 实例
+    class RankedMapTest : public ::testing::Test
+    {
+    protected:
+        ranked_map<int, string> m;
+    };
+
+    // 测试空容器上的顺序统计
+    TEST_F(RankedMapTest, EmptyQueries)
+    {
+        EXPECT_EQ(m.nth_element_at(0), m.end());
+        EXPECT_EQ(m.rank(10), 0);
+        EXPECT_EQ(m.count_range(0, 100), 0);
+    }
+
+    // 测试 nth_element_at 按序返回元素
+    TEST_F(RankedMapTest, NthElementAt)
+    {
+        m[30] = "c";
+        m[10] = "a";
+        m[20] = "b";
+        ASSERT_EQ(m.size(), 3);
+        EXPECT_EQ(m.nth_element_at(0)->first, 10);
+        EXPECT_EQ(m.nth_element_at(1)->second, "b");
+        EXPECT_EQ(m.nth_element_at(2)->first, 30);
+        // 越界返回 end()
+        EXPECT_EQ(m.nth_element_at(3), m.end());
+
+        // 非 const 对象可经返回的迭代器修改值，const 对象得到 const_iterator
+        m.nth_element_at(1)->second = "B";
+        const auto &cm = m;
+        static_assert(std::is_same_v<decltype(cm.nth_element_at(0)), decltype(cm.end())>);
+        EXPECT_EQ(cm.nth_element_at(1)->second, "B");
+        EXPECT_EQ(cm.nth_element_at(3), cm.end());
+    }
+
+    // 测试 rank 与 count_range
+    TEST_F(RankedMapTest, RankAndCountRange)
+    {
+        for (int i = 0; i < 10; ++i)
+            m[i * 10] = "v";
+        EXPECT_EQ(m.rank(0), 0);
+        EXPECT_EQ(m.rank(35), 4);
+        EXPECT_EQ(m.rank(40), 4);
+        EXPECT_EQ(m.rank(1000), 10);
+        // [lo, hi) 左闭右开
+        EXPECT_EQ(m.count_range(10, 40), 3);
+        EXPECT_EQ(m.count_range(15, 16), 0);
+        EXPECT_EQ(m.count_range(50, 10), 0);
+        EXPECT_EQ(m.count_range(-5, 1000), 10);
+    }
+
+    // 测试删除后子树大小仍然正确
+    TEST_F(RankedMapTest, EraseKeepsRanks)
+    {
+        for (int i = 0; i < 100; ++i)
+            m[i] = "v";
+        for (int i = 0; i < 100; i += 3)
+            m.erase(i);
+        int expected = 0;
+        for (size_t k = 0; k < m.size(); ++k)
+        {
+            if (expected % 3 == 0)
+                ++expected;
+            auto it = m.nth_element_at(k);
+            ASSERT_NE(it, m.end());
+            EXPECT_EQ(it->first, expected);
+            EXPECT_EQ(m.rank(expected), k);
+            ++expected;
+        }
+    }
+
+    // 测试拷贝后的树同样维护了子树大小
+    TEST_F(RankedMapTest, CopyKeepsRanks)
+    {
+        for (int i = 0; i < 50; ++i)
+            m[i] = "v";
+        ranked_map<int, string> copy(m);
+        for (size_t k = 0; k < copy.size(); ++k)
+            EXPECT_EQ(copy.nth_element_at(k)->first, static_cast<int>(k));
+    }
+
+    // 测试随机插入删除与 std::map 对照
+    TEST_F(RankedMapTest, RandomAgainstStdMap)
+    {
+        // 简单线性同余发生器，保证测试可复现
+        unsigned seed = 42;
+        auto gen = [&seed]
+        {
+            seed = seed * 1103515245u + 12345u;
+            return (seed >> 16) & 0x7fff;
+        };
+        std::map<int, int> ref;
+        ranked_map<int, int> rm;
+        for (int i = 0; i < 4000; ++i)
+        {
+            int k = gen() % 1000;
+            if (gen() % 3 == 0)
+            {
+                EXPECT_EQ(rm.erase(k), ref.erase(k));
+            }
+            else
+            {
+                rm.insert({k, i});
+                ref.insert({k, i});
+            }
+        }
+        ASSERT_EQ(rm.size(), ref.size());
+        size_t idx = 0;
+        for (auto &kv : ref)
+        {
+            auto it = rm.nth_element_at(idx);
+            ASSERT_NE(it, rm.end());
+            EXPECT_EQ(it->first, kv.first);
+            EXPECT_EQ(rm.rank(kv.first), idx);
+            ++idx;
+        }
+        EXPECT_EQ(rm.count_range(100, 600),
+                  static_cast<size_t>(std::distance(ref.lower_bound(100), ref.lower_bound(600))));
+    }
+
+    // 测试 ranked_multimap 的重复键统计
+    TEST(RankedMultiMapTest, DuplicateKeys)
+    {
+        ranked_multimap<int, int> mm;
+        mm.insert({1, 1});
+        mm.insert({2, 1});
+        mm.insert({2, 2});
+        mm.insert({2, 3});
+        mm.insert({5, 1});
+        EXPECT_EQ(mm.count(2), 3);
+        EXPECT_EQ(mm.rank(2), 1);
+        EXPECT_EQ(mm.rank(5), 4);
+        EXPECT_EQ(mm.count_range(2, 5), 3);
+        EXPECT_EQ(mm.nth_element_at(4)->first, 5);
+        EXPECT_EQ(mm.erase(2), 3);
+        EXPECT_EQ(mm.rank(5), 1);
+        EXPECT_EQ(mm.nth_element_at(1)->first, 5);
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <set>
+#include "../container/set.hpp"
+namespace zstl
+{
+    // 测试夹具：为每个测试提供独立的 ranked_set 实例
+    class RankedSetTest : public ::testing::Test
+    {
+    protected:
+        ranked_set<int> s;
+    };
+
+    // 测试按序选取与排名
+    TEST_F(RankedSetTest, SelectAndRank)
+    {
+        for (int v : {50, 10, 40, 20, 30})
+            s.insert(v);
+        for (size_t k = 0; k < s.size(); ++k)
+        {
+            EXPECT_EQ(*s.nth_element_at(k), static_cast<int>((k + 1) * 10));
+            EXPECT_EQ(s.rank((k + 1) * 10), k);
+        }
+        EXPECT_EQ(s.nth_element_at(5), s.end());
+        EXPECT_EQ(s.count_range(20, 50), 3);
+    }
+
+    // 测试重复插入不会改变子树大小
+    TEST_F(RankedSetTest, DuplicateInsertKeepsSize)
+    {
+        s.insert(1);
+        s.insert(1);
+        s.insert(2);
+        EXPECT_EQ(s.size(), 2);
+        EXPECT_EQ(s.rank(2), 1);
+        EXPECT_EQ(s.count(1), 1);
+        EXPECT_EQ(s.count(3), 0);
+    }
+
+    // 测试区间删除后的排名
+    TEST_F(RankedSetTest, RangeErase)
+    {
+        for (int i = 0; i < 64; ++i)
+            s.insert(i);
+        s.erase(s.lower_bound(16), s.lower_bound(48));
+        EXPECT_EQ(s.size(), 32);
+        EXPECT_EQ(*s.nth_element_at(16), 48);
+        EXPECT_EQ(s.rank(48), 16);
+        EXPECT_EQ(s.count_range(0, 64), 32);
+    }
+
+    // 测试随机操作下与 std::multiset 对照
+    TEST(RankedMultiSetTest, RandomAgainstStdMultiset)
+    {
+        unsigned seed = 7;
+        auto gen = [&seed]
+        {
+            seed = seed * 1103515245u + 12345u;
+            return (seed >> 16) & 0x7fff;
+        };
+        std::multiset<int> ref;
+        ranked_multiset<int> rs;
+        for (int i = 0; i < 3000; ++i)
+        {
+            int v = gen() % 200;
+            if (gen() % 4 == 0)
+            {
+                auto it = rs.find(v);
+                auto rit = ref.find(v);
+                ASSERT_EQ(it == rs.end(), rit == ref.end());
+                if (rit != ref.end())
+                {
+                    rs.erase(it);
+                    ref.erase(rit);
+                }
+            }
+            else
+            {
+                rs.insert(v);
+                ref.insert(v);
+            }
+        }
+        ASSERT_EQ(rs.size(), ref.size());
+        size_t idx = 0;
+        for (int v : ref)
+            EXPECT_EQ(*rs.nth_element_at(idx++), v);
+        for (int v = 0; v < 200; v += 7)
+        {
+            EXPECT_EQ(rs.rank(v), static_cast<size_t>(std::distance(ref.begin(), ref.lower_bound(v))));
+            EXPECT_EQ(rs.count(v), ref.count(v));
+        }
+    }
+}
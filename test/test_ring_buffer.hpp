@@ -0,0 +1,144 @@
+#pragma once
+#include <gtest/gtest.h>
+#include "../container/ring_buffer.hpp"
+#include "../container/queue.hpp"
+#include "../container/stack.hpp"
+#include "../container/string.hpp"
+
+namespace zstl
+{
+    // 容量取 2 的幂，两端插入删除与下标访问
+    TEST(RingBufferTest, PushPopBothEnds)
+    {
+        ring_buffer<int> rb(5);
+        EXPECT_EQ(rb.capacity(), 8u);
+        EXPECT_TRUE(rb.empty());
+        for (int i = 0; i < 4; ++i)
+            rb.push_back(i);
+        for (int i = 1; i <= 3; ++i)
+            rb.push_front(-i);
+        EXPECT_EQ(rb.size(), 7u);
+        EXPECT_EQ(rb.front(), -3);
+        EXPECT_EQ(rb.back(), 3);
+        for (int i = 0; i < 7; ++i)
+            EXPECT_EQ(rb[i], i - 3);
+        rb.pop_front();
+        rb.pop_back();
+        EXPECT_EQ(rb.front(), -2);
+        EXPECT_EQ(rb.back(), 2);
+        EXPECT_EQ(rb.capacity(), 8u);
+    }
+
+    // 跨越存储末尾回绕后，迭代器与随机访问保持逻辑顺序
+    TEST(RingBufferTest, WrapAroundIterators)
+    {
+        ring_buffer<int> rb(8);
+        for (int i = 0; i < 6; ++i)
+            rb.push_back(i);
+        for (int i = 0; i < 5; ++i)
+            rb.pop_front();
+        for (int i = 6; i < 13; ++i)
+            rb.push_back(i);
+        EXPECT_EQ(rb.size(), 8u);
+        EXPECT_TRUE(rb.full());
+        EXPECT_EQ(rb.capacity(), 8u);
+        int expect = 5;
+        for (int v : rb)
+            EXPECT_EQ(v, expect++);
+        EXPECT_EQ(rb.end() - rb.begin(), 8);
+        EXPECT_EQ(*(rb.begin() + 4), 9);
+        EXPECT_EQ(rb.begin()[7], 12);
+        EXPECT_EQ(*rb.rbegin(), 12);
+        const ring_buffer<int> &crb = rb;
+        ring_buffer<int>::const_iterator cit = rb.begin();
+        EXPECT_TRUE(cit == crb.begin());
+        EXPECT_EQ(zstl::count(crb.begin(), crb.end(), 7), 1);
+    }
+
+    // 满时按 2 倍扩容，非平凡类型按顺序搬移
+    TEST(RingBufferTest, GrowsPreservingOrder)
+    {
+        ring_buffer<string> rb;
+        EXPECT_EQ(rb.capacity(), 0u);
+        for (int i = 0; i < 3; ++i)
+        {
+            string s("b");
+            s.push_back(static_cast<char>('0' + i));
+            rb.push_back(s);
+        }
+        rb.push_front("a");
+        rb.pop_front();
+        rb.push_front("a0");
+        rb.push_front("a1");
+        EXPECT_EQ(rb.size(), 5u);
+        EXPECT_EQ(rb.capacity(), 8u);
+        const char *expect[] = {"a1", "a0", "b0", "b1", "b2"};
+        for (size_t i = 0; i < 5; ++i)
+            EXPECT_EQ(rb[i], string(expect[i]));
+
+        // 参数引用自身元素时扩容仍安全
+        ring_buffer<string> small = {"x", "y", "z", "w"};
+        EXPECT_TRUE(small.full());
+        small.push_back(small.front());
+        EXPECT_EQ(small.back(), string("x"));
+        EXPECT_EQ(small.size(), 5u);
+
+        ring_buffer<string> copy(rb);
+        EXPECT_EQ(copy.size(), 5u);
+        EXPECT_EQ(copy.front(), string("a1"));
+        ring_buffer<string> moved(std::move(copy));
+        EXPECT_TRUE(copy.empty());
+        EXPECT_EQ(moved.back(), string("b2"));
+    }
+
+    // overwrite 模式：容量固定，满时覆盖另一端最旧的元素
+    TEST(RingBufferTest, OverwriteOldest)
+    {
+        ring_buffer<int> rb(4, true);
+        for (int i = 0; i < 10; ++i)
+            rb.push_back(i);
+        EXPECT_EQ(rb.size(), 4u);
+        EXPECT_EQ(rb.capacity(), 4u);
+        for (int i = 0; i < 4; ++i)
+            EXPECT_EQ(rb[i], 6 + i);
+        rb.push_front(100);
+        EXPECT_EQ(rb.front(), 100);
+        EXPECT_EQ(rb.back(), 8);
+        EXPECT_EQ(rb.size(), 4u);
+
+        // 覆盖值来自被覆盖的元素本身
+        rb.push_back(rb.front());
+        EXPECT_EQ(rb.back(), 100);
+        EXPECT_EQ(rb.front(), 6);
+    }
+
+    // 作为 queue / stack 的底层容器
+    TEST(RingBufferTest, AdaptsQueueAndStack)
+    {
+        queue<int, ring_buffer<int>> q;
+        for (int i = 0; i < 100; ++i)
+            q.push(i);
+        for (int i = 0; i < 50; ++i)
+        {
+            EXPECT_EQ(q.front(), i);
+            q.pop();
+        }
+        EXPECT_EQ(q.size(), 50u);
+        EXPECT_EQ(q.back(), 99);
+
+        // 有界队列：只保留最近 3 个
+        queue<int, ring_buffer<int>> recent(ring_buffer<int>(3, true));
+        for (int i = 0; i < 10; ++i)
+            recent.push(i);
+        EXPECT_EQ(recent.size(), 4u); // 3 向上取整为 4
+        EXPECT_EQ(recent.front(), 6);
+
+        stack<int, ring_buffer<int>> s;
+        for (int i = 0; i < 20; ++i)
+            s.push(i);
+        EXPECT_EQ(s.top(), 19);
+        s.pop();
+        EXPECT_EQ(s.top(), 18);
+        EXPECT_EQ(s.size(), 19u);
+    }
+}
@@ -0,0 +1,188 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include "../container/rope.hpp"
+
+namespace zstl
+{
+    // 逐块拼接成 std::string，便于与参照结果比较
+    inline std::string rope_flatten(const rope &r)
+    {
+        std::string s;
+        for (auto it = r.chunk_begin(); it != r.chunk_end(); ++it)
+            s.append((*it).data(), (*it).size());
+        return s;
+    }
+
+    TEST(RopeTest, BasicConcatAndAccess)
+    {
+        rope a("hello"), b(string_view(", world"));
+        EXPECT_EQ(a.size(), 5u);
+        EXPECT_TRUE(rope().empty());
+
+        rope c = a + b;
+        EXPECT_EQ(rope_flatten(c), "hello, world");
+        EXPECT_EQ(c[7], 'w');
+        EXPECT_EQ(a.size(), 5u); // 拼接不修改操作数
+
+        c += '!';
+        c += " bye";
+        EXPECT_EQ(c.to_string(), string("hello, world! bye"));
+        EXPECT_EQ(c, rope("hello, world! bye"));
+        EXPECT_NE(c, a);
+        EXPECT_LT(a, c);
+        EXPECT_LT(rope("abc"), rope("abd"));
+
+        std::string chars;
+        for (auto it = c.begin(); it != c.end(); ++it)
+            chars += *it;
+        EXPECT_EQ(chars, "hello, world! bye");
+
+        std::ostringstream os;
+        os << c;
+        EXPECT_EQ(os.str(), "hello, world! bye");
+
+        char buf[8] = {};
+        EXPECT_EQ(c.copy(buf, 5, 7), 5u);
+        EXPECT_STREQ(buf, "world");
+    }
+
+    // 随机插入 / 删除 / 取子串 / 追加，与 std::string 对照
+    TEST(RopeTest, RandomEditsMatchStdString)
+    {
+        uint64_t state = 7;
+        auto rng = [&state]
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return static_cast<size_t>(state);
+        };
+        std::string ref;
+        rope r;
+        std::string piece;
+        for (int step = 0; step < 3000; ++step)
+        {
+            size_t len = rng() % 4 == 0 ? rng() % 2000 : rng() % 40;
+            piece.assign(len, static_cast<char>('a' + rng() % 26));
+            for (size_t i = 0; i < len; i += 7)
+                piece[i] = static_cast<char>('A' + (i + step) % 26);
+            size_t pos = ref.empty() ? 0 : rng() % (ref.size() + 1);
+            switch (rng() % 5)
+            {
+            case 0:
+                r.append(piece.data(), piece.size());
+                ref += piece;
+                break;
+            case 1:
+                r.insert(pos, piece.data(), piece.size());
+                ref.insert(pos, piece);
+                break;
+            case 2:
+            {
+                size_t n = rng() % 300;
+                r.erase(pos, n);
+                ref.erase(pos, n);
+                break;
+            }
+            case 3:
+            {
+                size_t n = rng() % 5000;
+                rope sub = r.substr(pos, n);
+                ASSERT_EQ(rope_flatten(sub), ref.substr(pos, n));
+                r.insert(ref.size() / 2, sub); // 与自身的块共享
+                ref.insert(ref.size() / 2, ref.substr(pos, n));
+                break;
+            }
+            default:
+                if (ref.size() > 200000)
+                {
+                    r = r.substr(ref.size() / 3, ref.size() / 3);
+                    ref = ref.substr(ref.size() / 3, ref.size() / 3);
+                }
+                break;
+            }
+            ASSERT_EQ(r.size(), ref.size());
+            ASSERT_LE(r.depth(), ROPE_MAX_DEPTH);
+            if (step % 97 == 0)
+            {
+                ASSERT_EQ(rope_flatten(r), ref);
+                if (!ref.empty())
+                    ASSERT_EQ(r[pos % ref.size()], ref[pos % ref.size()]);
+            }
+        }
+        EXPECT_EQ(std::string(r.to_string().c_str()), ref);
+    }
+
+    // 拷贝共享节点，修改副本不影响原值；子串引用原叶子而不复制
+    TEST(RopeTest, SharingAndZeroCopyChunks)
+    {
+        std::string big(100000, 'x');
+        big[50000] = 'y';
+        rope a(big.data(), big.size());
+        const char *leaf = (*a.chunk_begin()).data();
+
+        rope b = a;
+        b.insert(10, "inserted");
+        b.erase(0, 5);
+        EXPECT_EQ(rope_flatten(a), big);
+        EXPECT_EQ(b.size(), big.size() + 3);
+
+        rope mid = a.substr(40000, 20000);
+        auto chunk = *mid.chunk_begin();
+        EXPECT_EQ(chunk.data(), leaf + 40000);
+        EXPECT_EQ(chunk.size(), 20000u);
+        EXPECT_EQ(mid[10000], 'y');
+
+        // 自身拼接与自身插入
+        rope s("abc");
+        s += s;
+        s.insert(3, s);
+        EXPECT_EQ(rope_flatten(s), "abcabcabcabc");
+
+        a.clear();
+        EXPECT_TRUE(a.empty());
+        EXPECT_EQ(mid[10000], 'y'); // 原 rope 释放后切片仍持有叶子
+    }
+
+    // 大量追加后深度受控；短追加写入独占叶子的余量
+    TEST(RopeTest, AppendsStayBalancedAndAmortised)
+    {
+        rope r;
+        std::string ref;
+        std::string piece(1000, 'p');
+        for (int i = 0; i < 5000; ++i)
+        {
+            r.append(piece.data(), piece.size());
+            r.push_back(static_cast<char>('0' + i % 10));
+        }
+        EXPECT_EQ(r.size(), 5000u * 1001);
+        EXPECT_LE(r.depth(), ROPE_MAX_DEPTH);
+
+        size_t chunks = 0;
+        for (auto it = r.chunk_begin(); it != r.chunk_end(); ++it)
+            ++chunks;
+        EXPECT_EQ(chunks, 10000u); // 每个单字符追加进入新建的短叶子
+
+        rope t;
+        for (int i = 0; i < 10000; ++i)
+            t += 'c';
+        chunks = 0;
+        for (auto it = t.chunk_begin(); it != t.chunk_end(); ++it)
+        {
+            EXPECT_LE((*it).size(), ROPE_LEAF_MAX);
+            ++chunks;
+        }
+        EXPECT_EQ(chunks, (10000 + ROPE_LEAF_MAX - 1) / ROPE_LEAF_MAX);
+    }
+
+    TEST(RopeTest, WideRope)
+    {
+        wrope w(L"wide");
+        w.insert(2, L"--", 2);
+        EXPECT_EQ(w.size(), 6u);
+        EXPECT_EQ(w[2], L'-');
+        EXPECT_EQ(w.to_string(), wstring(L"wi--de"));
+    }
+}
@@ -0,0 +1,105 @@
+#pragma once
+#include <gtest/gtest.h>
+#include "../container/small_vector.hpp"
+#include "../container/string.hpp"
+namespace zstl
+{
+    // 记录分配次数的分配器
+    template <typename T>
+    struct SmallVecCountingAlloc : alloc<T>
+    {
+        static inline int allocations = 0;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = SmallVecCountingAlloc<U>;
+        };
+
+        static T *allocate(size_t n)
+        {
+            ++allocations;
+            return alloc<T>::allocate(n);
+        }
+    };
+
+    TEST(SmallVectorTest, StaysInlineUpToN)
+    {
+        using SV = small_vector<int, 4, SmallVecCountingAlloc<int>>;
+        SmallVecCountingAlloc<int>::allocations = 0;
+        SV v;
+        EXPECT_EQ(v.capacity(), 4u);
+        for (int i = 0; i < 4; ++i)
+            v.push_back(i);
+        EXPECT_EQ(SmallVecCountingAlloc<int>::allocations, 0);
+        // 超出内联容量后才分配
+        v.push_back(4);
+        EXPECT_EQ(SmallVecCountingAlloc<int>::allocations, 1);
+        EXPECT_GE(v.capacity(), 5u);
+        for (int i = 0; i < 5; ++i)
+            EXPECT_EQ(v[i], i);
+        // 缩回内联存储
+        v.erase(v.begin() + 1, v.end());
+        v.shrink_to_fit();
+        EXPECT_EQ(v.capacity(), 4u);
+        EXPECT_EQ(v.size(), 1u);
+        EXPECT_EQ(v[0], 0);
+        // 迭代器与 vector 一致，为原始指针
+        static_assert(std::is_same_v<SV::iterator, int *>);
+    }
+
+    TEST(SmallVectorTest, CopyMoveAndSwap)
+    {
+        small_vector<string, 2> a = {"a", "b"};
+        small_vector<string, 2> b = {"x", "y", "z"}; // 已溢出到堆
+        small_vector<string, 2> c(a);
+        EXPECT_EQ(c.size(), 2u);
+        EXPECT_EQ(c[1], "b");
+
+        // 内联状态下移动需要逐个搬移元素
+        small_vector<string, 2> d(std::move(a));
+        EXPECT_EQ(d.size(), 2u);
+        EXPECT_EQ(d[0], "a");
+        EXPECT_TRUE(a.empty());
+        EXPECT_EQ(a.capacity(), 2u);
+
+        // 堆状态下移动直接接管内存
+        const string *heap = b.begin();
+        small_vector<string, 2> e(std::move(b));
+        EXPECT_EQ(e.begin(), heap);
+        EXPECT_EQ(e.size(), 3u);
+        EXPECT_TRUE(b.empty());
+
+        // 内联与堆互换
+        d.swap(e);
+        EXPECT_EQ(d.size(), 3u);
+        EXPECT_EQ(d[2], "z");
+        EXPECT_EQ(e.size(), 2u);
+        EXPECT_EQ(e[1], "b");
+
+        e = d;
+        EXPECT_EQ(e.size(), 3u);
+        EXPECT_EQ(e[0], "x");
+        d = std::move(c);
+        EXPECT_EQ(d.size(), 2u);
+        EXPECT_EQ(d[0], "a");
+    }
+
+    TEST(SmallVectorTest, BulkOperations)
+    {
+        small_vector<int, 8> v(3, 1);
+        int arr[] = {5, 6, 7, 8, 9, 10};
+        v.insert(v.begin() + 1, arr, arr + 6);
+        ASSERT_EQ(v.size(), 9u);
+        EXPECT_EQ(v[0], 1);
+        EXPECT_EQ(v[1], 5);
+        EXPECT_EQ(v[6], 10);
+        EXPECT_EQ(v[8], 1);
+        v.assign({4, 3, 2});
+        EXPECT_EQ(v.size(), 3u);
+        EXPECT_EQ(v[2], 2);
+        v.shrink_to_fit();
+        EXPECT_EQ(v.capacity(), 8u);
+        EXPECT_EQ(v[0], 4);
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "../container/string.hpp" // 包含你实现的 string 类所在的头文件
 #include <sstream>               // 用于测试流输入输出
+#include <string>
 #include "gtest/gtest.h"         // 包含 Google Test 的头文件
 
 namespace zstl
@@ -115,4 +116,202 @@ namespace zstl
         EXPECT_EQ(w.substr(0, 2), wstring(L"你好"));
     }
 
-}
\ No newline at end of file
+
+    // ---------- 不填充的扩容 ----------
+    TEST(StringTest, ResizeUninitializedAndOverwrite)
+    {
+        string s("ab");
+        s.resize_uninitialized(5);
+        EXPECT_EQ(s.size(), 5u);
+        s[2] = 'c', s[3] = 'd', s[4] = 'e';
+        EXPECT_EQ(s, string("abcde"));
+        EXPECT_EQ(std::strlen(s.c_str()), 5u);
+
+        s.resize_and_overwrite(16, [](char *p, size_t n)
+                               {
+            EXPECT_EQ(n, 16u);
+            std::memcpy(p + 5, "xyz", 3);
+            return 8; });
+        EXPECT_EQ(s, string("abcdexyz"));
+        EXPECT_EQ(s.c_str()[8], '\0');
+
+        // 被移走后的空串同样可以扩容
+        string t(std::move(s));
+        s.resize_and_overwrite(3, [](char *p, size_t)
+                               {
+            p[0] = 'q';
+            return 1; });
+        EXPECT_EQ(s, string("q"));
+    }
+
+    // ---------- 短字符串优化 ----------
+    template <typename T>
+    struct StringCountingAlloc : alloc<T>
+    {
+        static inline int allocations = 0;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = StringCountingAlloc<U>;
+        };
+
+        static T *allocate(size_t n)
+        {
+            ++allocations;
+            return alloc<T>::allocate(n);
+        }
+    };
+
+    TEST(StringTest, ShortStringsStayInline)
+    {
+        static_assert(sizeof(string) == 32);
+        static_assert(string::SSO_CAPACITY == 15);
+        using S = basic_string<char, char_traits<char>, StringCountingAlloc<char>>;
+        StringCountingAlloc<char>::allocations = 0;
+        {
+            S empty;
+            S a("fifteen chars!!");
+            S b(a);
+            S c(std::move(b));
+            b = a;
+            a.append("");
+            EXPECT_EQ(a.capacity(), 15u);
+            EXPECT_EQ(c, a);
+            EXPECT_TRUE(b == a);
+            EXPECT_EQ(StringCountingAlloc<char>::allocations, 0);
+
+            // 超出内部缓冲区才分配
+            a.push_back('x');
+            EXPECT_EQ(StringCountingAlloc<char>::allocations, 1);
+            EXPECT_EQ(a.size(), 16u);
+            EXPECT_STREQ(a.c_str(), "fifteen chars!!x");
+            S d("sixteen chars!!!");
+            EXPECT_EQ(StringCountingAlloc<char>::allocations, 2);
+            // 堆上的串移动时窃取指针
+            S e(std::move(d));
+            EXPECT_EQ(StringCountingAlloc<char>::allocations, 2);
+            EXPECT_TRUE(d.empty());
+            EXPECT_STREQ(d.c_str(), "");
+            EXPECT_EQ(e.size(), 16u);
+        }
+    }
+
+    // 短串与堆串的各种组合下 swap / 移动赋值
+    TEST(StringTest, SwapAndMoveMixInlineAndHeap)
+    {
+        string s1("short"), s2("a much longer heap string"), s3("tiny");
+        s1.swap(s2);
+        EXPECT_EQ(s1, string("a much longer heap string"));
+        EXPECT_EQ(s2, string("short"));
+        s2.swap(s3);
+        EXPECT_EQ(s2, string("tiny"));
+        EXPECT_EQ(s3, string("short"));
+        s2.swap(s1);
+        EXPECT_EQ(s1, string("tiny"));
+        EXPECT_EQ(s2, string("a much longer heap string"));
+        string s4("another long heap allocated one");
+        s4.swap(s2);
+        EXPECT_EQ(s2, string("another long heap allocated one"));
+        s2 = std::move(s1); // 堆 <- 短
+        EXPECT_EQ(s2, string("tiny"));
+        s1 = std::move(s4); // 短（已移走）<- 堆
+        EXPECT_EQ(s1, string("a much longer heap string"));
+        s1 = s1.substr(2, 4);
+        EXPECT_EQ(s1, string("much"));
+        s1.insert(0, "very very very ");
+        EXPECT_EQ(s1, string("very very very much"));
+
+        wstring w(L"abc");
+        EXPECT_EQ(w.capacity(), wstring::SSO_CAPACITY);
+        w.append(L"defghijk");
+        EXPECT_EQ(w.size(), 11u);
+        EXPECT_TRUE(w == wstring(L"abcdefghijk"));
+    }
+
+    // ---------- 查找 ----------
+    TEST(StringTest, SearchFamilyMatchesStd)
+    {
+        // 带重复片段的长文本，覆盖 SIMD 块内、块边界与尾部
+        std::string ref;
+        for (int i = 0; i < 200; ++i)
+        {
+            ref += "2024-01-01 INFO req=";
+            ref += std::to_string(i * 7919 % 1000);
+            ref += i % 37 == 0 ? " ERROR timeout\n" : " ok\n";
+        }
+        string s(ref.c_str());
+        const char *needles[] = {"ERROR", "req=123 ", "\n", "ok\n2024", "nope", "", "I",
+                                 "INFO req=0 ERROR timeout\n2024-01-01 INFO req=919 ok\n2024-01-01 INFO"};
+        for (const char *nd : needles)
+        {
+            for (size_t pos : {size_t(0), size_t(17), size_t(1000), ref.size(), string::npos})
+            {
+                EXPECT_EQ(s.find(nd, pos == string::npos ? 0 : pos), ref.find(nd, pos == string::npos ? 0 : pos)) << nd;
+                EXPECT_EQ(s.rfind(nd, pos), ref.rfind(nd, pos)) << nd;
+                EXPECT_EQ(s.find_first_of(nd, pos == string::npos ? 0 : pos), ref.find_first_of(nd, pos == string::npos ? 0 : pos)) << nd;
+                EXPECT_EQ(s.find_last_of(nd, pos), ref.find_last_of(nd, pos)) << nd;
+            }
+        }
+        for (char c : {'E', '\n', '#', '9'})
+        {
+            EXPECT_EQ(s.find(c, 5), ref.find(c, 5));
+            EXPECT_EQ(s.rfind(c), ref.rfind(c));
+            EXPECT_EQ(s.rfind(c, 100), ref.rfind(c, 100));
+            EXPECT_EQ(s.find_last_of(c, 3000), ref.find_last_of(c, 3000));
+        }
+
+        // 周期性长模式串走 Two-Way
+        std::string periodic(300, 'a');
+        periodic[250] = 'b';
+        std::string pat(100, 'a');
+        pat += 'b';
+        string ps(periodic.c_str());
+        EXPECT_EQ(ps.find(pat.c_str()), periodic.find(pat));
+        EXPECT_EQ(ps.rfind(pat.c_str()), periodic.rfind(pat));
+        EXPECT_EQ(string("").find(""), 0u);
+        EXPECT_EQ(string("").rfind('a'), string::npos);
+
+        wstring w(L"abcabcabd");
+        EXPECT_EQ(w.find(L"abd"), 6u);
+        EXPECT_EQ(w.rfind(L"abc"), 3u);
+        EXPECT_EQ(w.find_first_of(L"dc"), 2u);
+        EXPECT_EQ(w.find_last_of(L"ab"), 7u);
+    }
+
+    // 反向子串查找：小字母表随机文本上与逐位置比较对照，覆盖 SIMD 过滤与反向 Two-Way
+    TEST(StringTest, ReverseSearchMatchesBruteForce)
+    {
+        uint32_t seed = 42;
+        auto next = [&seed]
+        { return seed = seed * 1664525u + 1013904223u, seed >> 8; };
+        for (int round = 0; round < 300; ++round)
+        {
+            size_t n = next() % 400, m = 1 + next() % 100;
+            std::string h(n, 'a'), nd(m, 'a');
+            for (auto &c : h)
+                c = static_cast<char>('a' + next() % 2);
+            for (auto &c : nd)
+                c = static_cast<char>('a' + next() % 2);
+            if (n > m && round % 2)
+                h.replace(next() % (n - m), m, nd); // 保证至少出现一次
+            std::wstring wh(h.begin(), h.end()), wnd(nd.begin(), nd.end());
+            size_t expect = h.rfind(nd);
+            auto at = [](const auto *p, const auto *base)
+            { return p ? size_t(p - base) : std::string::npos; };
+            EXPECT_EQ(at(rsearch_substr(h.data(), n, nd.data(), m), h.data()), expect);
+            EXPECT_EQ(at(two_way_rsearch(h.data(), n, nd.data(), m), h.data()), expect);
+            EXPECT_EQ(at(rsearch_substr(wh.data(), n, wnd.data(), m), wh.data()), expect);
+        }
+
+        // 重复文本上的长模式串：旧实现为 O(n·m)
+        std::string all_a(1 << 20, 'a');
+        std::string pat(200, 'a');
+        pat.back() = 'b';
+        EXPECT_EQ(rsearch_substr(all_a.data(), all_a.size(), pat.data(), pat.size()), nullptr);
+        pat.back() = 'a';
+        pat.front() = 'b';
+        all_a[1000] = 'b';
+        EXPECT_EQ(rsearch_substr(all_a.data(), all_a.size(), pat.data(), pat.size()), all_a.data() + 1000);
+    }
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include "../container/string_pool.hpp"
+#include "../container/string.hpp"
+#include "../container/map.hpp"
+#include "../container/unordered_map.hpp"
+#include "../container/vector.hpp"
+
+namespace zstl
+{
+    // 相同内容得到同一个句柄，字符只保存一份
+    TEST(StringPoolTest, InternDeduplicates)
+    {
+        string_pool pool;
+        interned_string a = pool.intern("service=api");
+        interned_string b = pool.intern(string("service=api"));
+        interned_string c = pool.intern(string_view("service=db"));
+        EXPECT_EQ(a, b);
+        EXPECT_EQ(a.data(), b.data());
+        EXPECT_NE(a, c);
+        EXPECT_EQ(pool.size(), 2u);
+        EXPECT_STREQ(a.c_str(), "service=api");
+        EXPECT_EQ(a.size(), 11u);
+        EXPECT_EQ(a.view(), string_view("service=api"));
+        EXPECT_EQ(a.hash(), b.hash());
+        EXPECT_LT(a.compare(c), 0);
+        EXPECT_EQ(a.compare(b), 0);
+
+        // 空串为空句柄，不占用池
+        interned_string e = pool.intern("");
+        EXPECT_TRUE(e.empty());
+        EXPECT_EQ(e, interned_string());
+        EXPECT_STREQ(e.c_str(), "");
+        EXPECT_EQ(pool.size(), 2u);
+
+        interned_string found;
+        EXPECT_TRUE(pool.find("service=db", found));
+        EXPECT_EQ(found, c);
+        EXPECT_FALSE(pool.find("service=web", found));
+        EXPECT_EQ(pool.size(), 2u);
+
+        std::ostringstream os;
+        os << a;
+        EXPECT_EQ(os.str(), "service=api");
+    }
+
+    // 散列表扩容与竞技场换块后句柄与字符地址不变
+    TEST(StringPoolTest, HandlesStayStableAcrossGrowth)
+    {
+        string_pool pool;
+        vector<interned_string> handles;
+        vector<const char *> addrs;
+        char buf[32];
+        for (int i = 0; i < 20000; ++i)
+        {
+            int n = std::snprintf(buf, sizeof(buf), "tag-%d", i);
+            handles.push_back(pool.intern(string_view(buf, n)));
+            addrs.push_back(handles.back().data());
+        }
+        EXPECT_EQ(pool.size(), 20000u);
+        EXPECT_GT(pool.arena_bytes(), STRING_POOL_BLOCK_BYTES);
+
+        // 超过块大小的字符串单独成块
+        std::string huge(STRING_POOL_BLOCK_BYTES * 2, 'h');
+        interned_string big = pool.intern(string_view(huge.data(), huge.size()));
+        EXPECT_EQ(big.size(), huge.size());
+        EXPECT_EQ(pool.intern(string_view(huge.data(), huge.size())), big);
+
+        for (int i = 0; i < 20000; ++i)
+        {
+            int n = std::snprintf(buf, sizeof(buf), "tag-%d", i);
+            interned_string h = pool.intern(string_view(buf, n));
+            ASSERT_EQ(h, handles[i]);
+            ASSERT_EQ(h.data(), addrs[i]);
+            ASSERT_STREQ(h.c_str(), buf);
+        }
+        EXPECT_EQ(pool.size(), 20001u);
+
+        pool.clear();
+        EXPECT_TRUE(pool.empty());
+        EXPECT_EQ(pool.arena_bytes(), 0u);
+        interned_string again = pool.intern("tag-1");
+        EXPECT_STREQ(again.c_str(), "tag-1");
+        EXPECT_EQ(pool.size(), 1u);
+    }
+
+    // 句柄作为有序 / 散列容器的键
+    TEST(StringPoolTest, HandlesAsContainerKeys)
+    {
+        string_pool pool;
+        pool.reserve(1000);
+        unordered_map<interned_string, int> counts;
+        map<interned_string, int> ordered;
+        const char *tags[] = {"host=a", "host=b", "host=c", "host=a", "host=c", "host=a"};
+        for (const char *t : tags)
+        {
+            interned_string h = pool.intern(t);
+            ++counts[h];
+            ++ordered[h];
+        }
+        EXPECT_EQ(counts.size(), 3u);
+        EXPECT_EQ(counts[pool.intern("host=a")], 3);
+        EXPECT_EQ(counts[pool.intern("host=b")], 1);
+        EXPECT_EQ(ordered.size(), 3u);
+        EXPECT_EQ(ordered[pool.intern("host=c")], 2);
+
+        EXPECT_EQ(hash<interned_string>()(pool.intern("host=a")), pool.intern("host=a").hash());
+        EXPECT_TRUE(equal_to<interned_string>()(pool.intern("host=b"), pool.intern("host=b")));
+        interned_string x = pool.intern("host=a"), y = pool.intern("host=b");
+        EXPECT_NE(less<interned_string>()(x, y), less<interned_string>()(y, x));
+    }
+}
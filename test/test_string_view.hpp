@@ -0,0 +1,185 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include "../container/string_view.hpp"
+#include "../container/string.hpp"
+#include "../container/vector.hpp"
+#include "../functor/functional.hpp"
+
+namespace zstl
+{
+    // 视图只记录指针与长度，切分不拷贝
+    TEST(StringViewTest, SliceAndCompare)
+    {
+        const char *text = "key=value;other";
+        string_view v(text);
+        EXPECT_EQ(v.size(), 15u);
+        EXPECT_EQ(v.data(), text);
+
+        string_view key = v.substr(0, v.find('='));
+        EXPECT_EQ(key, string_view("key"));
+        EXPECT_EQ(key.data(), text);
+        EXPECT_EQ(v.substr(10), string_view("other"));
+        EXPECT_EQ(v.substr(10, 100).size(), 5u);
+        EXPECT_TRUE(v.substr(15).empty());
+
+        string_view w = v;
+        w.remove_prefix(4);
+        w.remove_suffix(6);
+        EXPECT_EQ(w, string_view("value"));
+        EXPECT_EQ(w.front(), 'v');
+        EXPECT_EQ(w.back(), 'e');
+
+        EXPECT_TRUE(v.starts_with("key"));
+        EXPECT_TRUE(v.ends_with("other"));
+        EXPECT_FALSE(v.starts_with("value"));
+        EXPECT_TRUE(v.starts_with('k'));
+        EXPECT_FALSE(string_view().ends_with('x'));
+
+        EXPECT_LT(string_view("abc"), string_view("abd"));
+        EXPECT_LT(string_view("ab"), string_view("abc"));
+        EXPECT_GT(string_view("b"), string_view("abc"));
+        EXPECT_EQ(string_view("abc").compare("abc"), 0);
+        EXPECT_LT(string_view("").compare("a"), 0);
+        EXPECT_NE(string_view("abc"), string_view("ab"));
+
+        // 不依赖终止符：视图可以包含 '\0'
+        const char raw[] = {'a', '\0', 'b'};
+        string_view z(raw, 3);
+        EXPECT_EQ(z.size(), 3u);
+        EXPECT_EQ(z.find('b'), 2u);
+
+        std::ostringstream os;
+        os << key;
+        EXPECT_EQ(os.str(), "key");
+    }
+
+    // 查找族与 std::string_view 一致
+    TEST(StringViewTest, SearchMatchesStd)
+    {
+        const char *text = "GET /index.html HTTP/1.1\r\nHost: example.com\r\n\r\n";
+        string_view v(text);
+        std::string ref(text);
+        for (const char *nd : {"\r\n", "HTTP", "com", "x", "", "GET /index.html HTTP/1.1\r\nHost"})
+        {
+            for (size_t pos : {size_t(0), size_t(3), size_t(20), size_t(1000)})
+            {
+                EXPECT_EQ(v.find(nd, pos), ref.find(nd, pos)) << nd;
+                EXPECT_EQ(v.rfind(nd, pos), ref.rfind(nd, pos)) << nd;
+                EXPECT_EQ(v.find_last_of(nd, pos), ref.find_last_of(nd, pos)) << nd;
+                if (pos < ref.size())
+                    EXPECT_EQ(v.find_first_of(nd, pos), ref.find_first_of(nd, pos)) << nd;
+            }
+        }
+        EXPECT_EQ(v.rfind('\n'), ref.rfind('\n'));
+        EXPECT_EQ(v.find(':'), ref.find(':'));
+        EXPECT_EQ(v.find('#'), string_view::npos);
+    }
+
+    // 不分配的分词：每个字段都是原串上的视图
+    TEST(StringViewTest, TokeniseWithoutCopy)
+    {
+        string line("alpha,beta,,gamma");
+        string_view rest = line;
+        vector<string_view> fields;
+        for (;;)
+        {
+            size_t p = rest.find(',');
+            fields.push_back(rest.substr(0, p));
+            if (p == string_view::npos)
+                break;
+            rest.remove_prefix(p + 1);
+        }
+        ASSERT_EQ(fields.size(), 4u);
+        EXPECT_EQ(fields[0], string_view("alpha"));
+        EXPECT_EQ(fields[1], string_view("beta"));
+        EXPECT_TRUE(fields[2].empty());
+        EXPECT_EQ(fields[3], string_view("gamma"));
+        EXPECT_EQ(fields[3].data(), line.data() + 12);
+
+        // 视图与字符串的哈希一致
+        EXPECT_EQ(hash<string_view>()(fields[0]), hash<string>()(string("alpha")));
+    }
+
+    // (指针, 长度) 与视图重载
+    TEST(StringViewTest, StringPtrLenAndViewOverloads)
+    {
+        const char *text = "hello world";
+        string s(text, 5);
+        EXPECT_EQ(s, string("hello"));
+        EXPECT_EQ(s.size(), 5u);
+
+        string t(string_view(text).substr(6));
+        EXPECT_EQ(t, string("world"));
+
+        s.append(" big", 4);
+        s += string_view(text + 5, 6);
+        EXPECT_EQ(s, string("hello big world"));
+        s.append(string("!"));
+        EXPECT_EQ(s, string("hello big world!"));
+
+        s.insert(5, ",", 1);
+        s.insert(0, string_view(">> "));
+        EXPECT_EQ(s, string(">> hello, big world!"));
+
+        EXPECT_EQ(s.find("big", 0, 3), 10u);
+        EXPECT_EQ(s.find("bigger", 0, 3), 10u);
+        EXPECT_EQ(s.find(string_view("world")), 14u);
+        EXPECT_EQ(s.rfind("o", string::npos, 1), 15u);
+        EXPECT_EQ(s.rfind(string_view("l")), 17u);
+        EXPECT_EQ(s.find_first_of(string_view(",!")), 8u);
+        EXPECT_EQ(s.find_first_of(",!xyz", 0, 2), 8u);
+        EXPECT_EQ(s.find_last_of(string_view("h>")), 3u);
+        EXPECT_EQ(s.find_last_of("ow", string::npos, 1), 15u);
+
+        string_view sv = s;
+        EXPECT_EQ(sv.data(), s.data());
+        EXPECT_EQ(sv.size(), s.size());
+        EXPECT_EQ(s.compare(string_view(">> hello")), 1);
+        EXPECT_EQ(s.compare(sv), 0);
+        EXPECT_LT(s.compare(string_view("?")), 0);
+    }
+
+    // 追加 / 插入自身内容，包括触发扩容的情况
+    TEST(StringViewTest, AppendAndInsertSelfAlias)
+    {
+        string s("abcdefgh");
+        s.append(s.data() + 2, 4);
+        EXPECT_EQ(s, string("abcdefghcdef"));
+        s.append(string_view(s));
+        EXPECT_EQ(s, string("abcdefghcdefabcdefghcdef"));
+        s.append(s);
+        EXPECT_EQ(s.size(), 48u);
+        EXPECT_EQ(s.substr(24), s.substr(0, 24));
+
+        string u("0123456789");
+        u.insert(3, u.data() + 5, 5);
+        EXPECT_EQ(u, string("012567893456789"));
+    }
+
+    // 输入不受定长缓冲区限制，遵循空白分隔与 width
+    TEST(StringViewTest, StreamExtraction)
+    {
+        std::string big(10000, 'x');
+        std::istringstream in("  first\tsecond\n" + big + " tail");
+        string a, b, c, d, e;
+        in >> a >> b >> c >> d;
+        EXPECT_EQ(a, string("first"));
+        EXPECT_EQ(b, string("second"));
+        EXPECT_EQ(c.size(), 10000u);
+        EXPECT_EQ(d, string("tail"));
+        EXPECT_TRUE(in.eof());
+        EXPECT_FALSE(in.fail());
+        in >> e;
+        EXPECT_TRUE(in.fail());
+        EXPECT_TRUE(e.empty());
+
+        std::istringstream w("abcdef");
+        w.width(3);
+        w >> a;
+        EXPECT_EQ(a, string("abc"));
+        w >> a;
+        EXPECT_EQ(a, string("def"));
+    }
+}
@@ -164,4 +164,32 @@ namespace zstl
         auto it = um.find(5);
         EXPECT_EQ(it, result.first);
     }
+
+    // 测试批量查找与批量存在性判断
+    TEST_F(UnorderedMapTest, FindBatch)
+    {
+        int keys[40];
+        unordered_map<int, int>::iterator its[40];
+        bool found[40];
+        // 空表
+        for (int i = 0; i < 40; ++i)
+            keys[i] = i * 7;
+        intMap.contains_batch(keys, 40, found);
+        for (int i = 0; i < 40; ++i)
+            EXPECT_FALSE(found[i]);
+
+        for (int i = 0; i < 200; i += 2)
+            intMap[i] = i + 1;
+        intMap.find_batch(keys, 40, its);
+        intMap.contains_batch(keys, 40, found);
+        for (int i = 0; i < 40; ++i)
+        {
+            bool expect = keys[i] % 2 == 0 && keys[i] < 200;
+            EXPECT_EQ(found[i], expect);
+            if (expect)
+                EXPECT_EQ(its[i]->second, keys[i] + 1);
+            else
+                EXPECT_EQ(its[i], intMap.end());
+        }
+    }
 }
\ No newline at end of file
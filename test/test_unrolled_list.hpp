@@ -0,0 +1,166 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "../container/unrolled_list.hpp"
+
+namespace zstl
+{
+    template <typename C>
+    std::vector<typename C::value_type> unrolled_sorted(const C &c)
+    {
+        std::vector<typename C::value_type> out;
+        for (const auto &x : c)
+            out.push_back(x);
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+
+    TEST(UnrolledListTest, InsertEraseKeepsOtherIteratorsValid)
+    {
+        unrolled_list<int> ul;
+        std::vector<unrolled_list<int>::iterator> where;
+        for (int i = 0; i < 1000; ++i)
+            where.push_back(ul.insert(i));
+        EXPECT_EQ(ul.size(), 1000u);
+        std::vector<const int *> addr;
+        for (auto it : where)
+            addr.push_back(&*it);
+
+        // 删除所有奇数：偶数元素的迭代器与地址不变
+        for (int i = 1; i < 1000; i += 2)
+            ul.erase(where[i]);
+        EXPECT_EQ(ul.size(), 500u);
+        for (int i = 0; i < 1000; i += 2)
+        {
+            EXPECT_EQ(*where[i], i);
+            EXPECT_EQ(&*where[i], addr[i]);
+        }
+
+        // 新元素复用空洞，不再分配新块
+        for (int i = 0; i < 500; ++i)
+            ul.insert(-1 - i);
+        std::vector<int> expect;
+        for (int i = 0; i < 1000; i += 2)
+            expect.push_back(i);
+        for (int i = 0; i < 500; ++i)
+            expect.push_back(-1 - i);
+        std::sort(expect.begin(), expect.end());
+        EXPECT_EQ(unrolled_sorted(ul), expect);
+        for (int i = 0; i < 1000; i += 2)
+            EXPECT_EQ(&*where[i], addr[i]);
+
+        // 双向遍历一致
+        std::vector<int> fwd, bwd;
+        for (int x : ul)
+            fwd.push_back(x);
+        for (auto it = ul.rbegin(); it != ul.rend(); ++it)
+            bwd.push_back(*it);
+        std::reverse(bwd.begin(), bwd.end());
+        EXPECT_EQ(fwd, bwd);
+        EXPECT_EQ(fwd.size(), 1000u);
+    }
+
+    // 遍历按块与槽的次序：新建时依次填满各块，删除留下的空洞由之后的插入原地补上
+    TEST(UnrolledListTest, TraversalFollowsBlockOrder)
+    {
+        unrolled_list<int> ul;
+        std::vector<unrolled_list<int>::iterator> where;
+        for (int i = 0; i < 100; ++i)
+            where.push_back(ul.insert(i));
+        std::vector<int> expect;
+        for (int i = 0; i < 100; ++i)
+            expect.push_back(i);
+        auto items = [&ul]
+        {
+            std::vector<int> out;
+            for (int x : ul)
+                out.push_back(x);
+            return out;
+        };
+        EXPECT_EQ(items(), expect);
+
+        ul.erase(where[5]);
+        ul.erase(where[70]);
+        ul.insert(1000); // 首块原本已满，出现空洞后接到空闲链头，先被复用
+        ul.insert(1001); // 首块再次填满，轮到第二块里 70 号留下的空洞
+        expect[5] = 1000;
+        expect[70] = 1001;
+        EXPECT_EQ(items(), expect);
+    }
+
+    TEST(UnrolledListTest, EraseWhileIteratingAndRemoveIf)
+    {
+        unrolled_list<std::string> ul;
+        for (int i = 0; i < 300; ++i)
+            ul.emplace(std::to_string(i));
+        size_t kept = 0;
+        for (auto it = ul.begin(); it != ul.end();)
+        {
+            if (it->size() == 2)
+                it = ul.erase(it); // 10 ~ 99
+            else
+            {
+                ++it;
+                ++kept;
+            }
+        }
+        EXPECT_EQ(kept, 210u);
+        EXPECT_EQ(ul.size(), 210u);
+
+        EXPECT_EQ(ul.remove_if([](const std::string &s)
+                               { return s.back() == '0'; }),
+                  21u);
+        EXPECT_EQ(ul.size(), 189u);
+        for (const auto &s : ul)
+            EXPECT_NE(s.back(), '0');
+
+        // 整块清空后块被释放，遍历仍正确
+        auto all = ul.begin();
+        EXPECT_EQ(ul.erase(all, ul.end()), ul.end());
+        EXPECT_TRUE(ul.empty());
+        EXPECT_EQ(ul.begin(), ul.end());
+        ul.emplace("again");
+        EXPECT_EQ(*ul.begin(), "again");
+    }
+
+    TEST(UnrolledListTest, CopyMoveSwap)
+    {
+        unrolled_list<int> a{5, 3, 1, 4};
+        unrolled_list<int> b(a);
+        EXPECT_EQ(unrolled_sorted(b), (std::vector<int>{1, 3, 4, 5}));
+
+        unrolled_list<int> c(std::move(a));
+        EXPECT_TRUE(a.empty());
+        EXPECT_EQ(a.begin(), a.end());
+        EXPECT_EQ(c.size(), 4u);
+
+        unrolled_list<int> big;
+        for (int i = 0; i < 200; ++i)
+            big.insert(i);
+        swap(big, c);
+        EXPECT_EQ(c.size(), 200u);
+        EXPECT_EQ(unrolled_sorted(big), (std::vector<int>{1, 3, 4, 5}));
+        int sum = 0;
+        for (int x : c)
+            sum += x;
+        EXPECT_EQ(sum, 199 * 200 / 2);
+
+        a = c;
+        EXPECT_EQ(a.size(), 200u);
+        c.clear();
+        EXPECT_TRUE(c.empty());
+        c = std::move(a);
+        EXPECT_EQ(c.size(), 200u);
+        EXPECT_TRUE(a.empty());
+        a.insert(7);
+        EXPECT_EQ(*a.begin(), 7);
+
+        const unrolled_list<int> &ca = a;
+        unrolled_list<int>::const_iterator ci = a.begin();
+        EXPECT_EQ(ci, ca.begin());
+        ci = ca.end();
+        EXPECT_EQ(--ci, ca.begin());
+    }
+}
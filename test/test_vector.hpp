@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 #include "../container/vector.hpp"
 #include"../allocator/memory.hpp"
+#include "../container/list.hpp"
 namespace zstl
 {
     // 测试 push_back() 和 pop_back() 基本功能
@@ -54,6 +55,18 @@ namespace zstl
         {
             EXPECT_EQ(vec[i], arr[i]);
         }
+
+        // 指针所指类型与元素类型不同：逐个转换
+        vector<long> wide(arr, arr + 3);
+        EXPECT_EQ(wide.size(), 3u);
+        EXPECT_EQ(wide[2], 3L);
+        vector<double> d(4, 0.5);
+        d.assign(arr, arr + 2); // 容量足够，走原地拷贝
+        EXPECT_EQ(d.size(), 2u);
+        EXPECT_EQ(d[0], 1.0);
+        EXPECT_EQ(d[1], 2.0);
+        d.assign(arr, arr + 5);
+        EXPECT_EQ(d[4], 5.0);
     }
 
     // 测试 resize 操作（扩容和缩小）
@@ -232,4 +245,234 @@ namespace zstl
         EXPECT_EQ(v.back(), 42);
         EXPECT_EQ(v.size(), 1);
     }
+
+    // 记录存活对象数与拷贝次数的元素类型
+    struct VecTracker
+    {
+        static inline int live = 0;
+        static inline int copies = 0;
+        int v;
+        VecTracker(int x = 0) : v(x) { ++live; }
+        VecTracker(const VecTracker &o) : v(o.v) { ++live, ++copies; }
+        VecTracker(VecTracker &&o) noexcept : v(o.v) { ++live; }
+        VecTracker &operator=(const VecTracker &o) = default;
+        VecTracker &operator=(VecTracker &&o) noexcept = default;
+        ~VecTracker() { --live; }
+    };
+
+    // 移动构造可能抛出的类型：扩容时应退化为拷贝
+    struct VecThrowingMove
+    {
+        static inline int copies = 0;
+        int v;
+        VecThrowingMove(int x = 0) : v(x) {}
+        VecThrowingMove(const VecThrowingMove &o) : v(o.v) { ++copies; }
+        VecThrowingMove(VecThrowingMove &&o) : v(o.v) {}
+        VecThrowingMove &operator=(const VecThrowingMove &) = default;
+        VecThrowingMove &operator=(VecThrowingMove &&) = default;
+    };
+
+    // 扩容、插入、删除后源对象均被析构，不发生拷贝
+    TEST(VectorTest, RelocationDestroysSources)
+    {
+        VecTracker::live = VecTracker::copies = 0;
+        {
+            vector<VecTracker> v;
+            for (int i = 0; i < 100; ++i)
+                v.emplace_back(i);
+            EXPECT_EQ(VecTracker::live, 100);
+            v.insert(v.begin() + 50, VecTracker(-1));
+            EXPECT_EQ(VecTracker::live, 101);
+            v.erase(v.begin());
+            v.erase(v.end() - 1);
+            EXPECT_EQ(VecTracker::live, 99);
+            EXPECT_EQ(v[48].v, 49);
+            EXPECT_EQ(v[49].v, -1);
+            EXPECT_EQ(v[50].v, 50);
+            v.reserve(1000);
+            EXPECT_EQ(VecTracker::live, 99);
+            // 只有 insert 的 const& 参数被拷贝一次
+            EXPECT_EQ(VecTracker::copies, 1);
+        }
+        EXPECT_EQ(VecTracker::live, 0);
+    }
+
+    TEST(VectorTest, GrowthCopiesWhenMoveMayThrow)
+    {
+        VecThrowingMove::copies = 0;
+        vector<VecThrowingMove> v;
+        v.reserve(2);
+        v.emplace_back(1);
+        v.emplace_back(2);
+        v.emplace_back(3);
+        EXPECT_EQ(VecThrowingMove::copies, 2);
+        EXPECT_EQ(v[0].v, 1);
+        EXPECT_EQ(v[2].v, 3);
+    }
+
+    // 插入自身元素的引用，扩容与就地后移两条路径都应正确
+    TEST(VectorTest, InsertAliasedElement)
+    {
+        vector<int> a = {1, 2, 3, 4};
+        a.insert(a.begin(), a[2]); // 满容量，走扩容路径
+        EXPECT_EQ(a.size(), 5u);
+        EXPECT_EQ(a[0], 3);
+        a.insert(a.begin() + 1, a[4]); // 就地后移路径
+        EXPECT_EQ(a[1], 4);
+        EXPECT_EQ(a[5], 4);
+
+        vector<zstl::string> s;
+        s.reserve(8);
+        s.push_back("x");
+        s.push_back("y");
+        s.insert(s.begin(), s[1]);
+        EXPECT_EQ(s[0], "y");
+        EXPECT_EQ(s[1], "x");
+        EXPECT_EQ(s[2], "y");
+        s.emplace_back(s[0]);
+        EXPECT_EQ(s.back(), "y");
+    }
+
+    // 按值比较 vector 与期望序列
+    template <typename V, typename T>
+    void expect_vector_eq(const V &v, std::initializer_list<T> expect)
+    {
+        ASSERT_EQ(v.size(), expect.size());
+        size_t i = 0;
+        for (auto &e : expect)
+            EXPECT_EQ(v[i++], e);
+    }
+
+    TEST(VectorTest, InsertFillAndRange)
+    {
+        vector<int> v(3, 7); // 整数参数应选择 (n, val) 构造
+        expect_vector_eq(v, {7, 7, 7});
+        v.insert(v.begin() + 1, 2, 1);
+        expect_vector_eq(v, {7, 1, 1, 7, 7});
+        int arr[] = {4, 5, 6};
+        v.insert(v.end(), arr, arr + 3);
+        expect_vector_eq(v, {7, 1, 1, 7, 7, 4, 5, 6});
+        v.insert(v.begin(), {9, 8});
+        expect_vector_eq(v, {9, 8, 7, 1, 1, 7, 7, 4, 5, 6});
+        // 插入自身元素的引用
+        v.insert(v.begin(), 2, v[9]);
+        EXPECT_EQ(v[0], 6);
+        EXPECT_EQ(v[1], 6);
+        EXPECT_EQ(v[2], 9);
+
+        // 非连续迭代器
+        list<int> l = {1, 2, 3};
+        vector<int> w;
+        w.insert(w.begin(), l.begin(), l.end());
+        w.insert(w.begin() + 1, l.begin(), l.end());
+        expect_vector_eq(w, {1, 1, 2, 3, 2, 3});
+    }
+
+    // 非平凡类型在原地腾挪的两种情况：插入数少于/多于插入点之后的元素数
+    TEST(VectorTest, InsertRangeNonTrivial)
+    {
+        VecTracker::live = 0;
+        {
+            vector<VecTracker> v;
+            v.reserve(64);
+            for (int i = 0; i < 6; ++i)
+                v.emplace_back(i);
+            VecTracker src[4] = {10, 11, 12, 13};
+            v.insert(v.begin() + 1, src, src + 2); // 插入点后 5 个元素 > 2
+            v.insert(v.end() - 1, src, src + 4);   // 插入点后 1 个元素 < 4
+            int expect[] = {0, 10, 11, 1, 2, 3, 4, 10, 11, 12, 13, 5};
+            ASSERT_EQ(v.size(), 12u);
+            for (int i = 0; i < 12; ++i)
+                EXPECT_EQ(v[i].v, expect[i]);
+            EXPECT_EQ(VecTracker::live, 12 + 4);
+            v.erase(v.begin() + 2, v.begin() + 9);
+            EXPECT_EQ(VecTracker::live, 5 + 4);
+            EXPECT_EQ(v[1].v, 10);
+            EXPECT_EQ(v[2].v, 12);
+        }
+        EXPECT_EQ(VecTracker::live, 0);
+
+        vector<zstl::string> s = {"a", "b", "c"};
+        zstl::string more[] = {"x", "y"};
+        s.insert(s.begin() + 1, more, more + 2);
+        s.insert(s.begin(), 2, zstl::string("z"));
+        expect_vector_eq(s, {zstl::string("z"), zstl::string("z"), zstl::string("a"),
+                             zstl::string("x"), zstl::string("y"), zstl::string("b"), zstl::string("c")});
+    }
+
+    TEST(VectorTest, AssignAndAppendRange)
+    {
+        vector<int> v = {1, 2, 3, 4, 5};
+        size_t cap = v.capacity();
+        v.assign({7, 8});
+        expect_vector_eq(v, {7, 8});
+        EXPECT_EQ(v.capacity(), cap); // 容量足够时不重新分配
+        v.assign(4, 3);
+        expect_vector_eq(v, {3, 3, 3, 3});
+        int arr[] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+        v.assign(arr, arr + 9);
+        EXPECT_EQ(v.size(), 9u);
+        EXPECT_EQ(v.back(), 9);
+
+        vector<int> w;
+        w.append_range(arr);
+        w.append_range(v);
+        EXPECT_EQ(w.size(), 18u);
+        EXPECT_EQ(w[9], 1);
+
+        vector<zstl::string> s = {"a", "b", "c"};
+        vector<zstl::string> t = {"x"};
+        s = t;
+        expect_vector_eq(s, {zstl::string("x")});
+        t.assign({"p", "q", "r", "s", "t"});
+        EXPECT_EQ(t.size(), 5u);
+        EXPECT_EQ(t[4], "t");
+    }
+
+    TEST(VectorTest, EraseRangeAndShrinkToFit)
+    {
+        vector<int> v;
+        for (int i = 0; i < 10; ++i)
+            v.push_back(i);
+        auto it = v.erase(v.begin() + 2, v.begin() + 5);
+        EXPECT_EQ(*it, 5);
+        expect_vector_eq(v, {0, 1, 5, 6, 7, 8, 9});
+        EXPECT_EQ(v.erase(v.begin(), v.begin()), v.begin());
+        v.erase(v.begin() + 3, v.end());
+        expect_vector_eq(v, {0, 1, 5});
+        v.shrink_to_fit();
+        EXPECT_EQ(v.capacity(), 3u);
+        expect_vector_eq(v, {0, 1, 5});
+        v.clear();
+        v.shrink_to_fit();
+        EXPECT_EQ(v.capacity(), 0u);
+        v.push_back(1);
+        EXPECT_EQ(v[0], 1);
+    }
+
+    TEST(VectorTest, ResizeUninitializedAndOverwrite)
+    {
+        vector<int> v = {1, 2, 3};
+        v.resize_uninitialized(100);
+        EXPECT_EQ(v.size(), 100u);
+        EXPECT_EQ(v[2], 3); // 原有元素保留
+        for (int i = 0; i < 100; ++i)
+            v[i] = i;
+        v.resize_uninitialized(10);
+        EXPECT_EQ(v.size(), 10u);
+        EXPECT_EQ(v[9], 9);
+
+        // 模拟 read()：申请 64 个位置，只写入 5 个
+        size_t len = v.size();
+        v.resize_and_overwrite(len + 64, [len](int *p, size_t n)
+                               {
+            for (size_t i = len; i < len + 5; ++i)
+                p[i] = -1;
+            EXPECT_EQ(n, len + 64);
+            return len + 5; });
+        EXPECT_EQ(v.size(), 15u);
+        EXPECT_EQ(v[9], 9);
+        EXPECT_EQ(v[14], -1);
+        EXPECT_EQ(v.data(), &v[0]);
+    }
 }